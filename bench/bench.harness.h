@@ -0,0 +1,416 @@
+/*
+ * File: bench/bench.harness.h
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Microbenchmark Harness - Timing, Allocation Counting and Baseline Comparison
+ * Purpose: Provides a lightweight, dependency-free harness for engine and utility hot path benchmarks
+ * Reason: We need repeatable ns/op, bytes/op and allocations/op numbers to judge upgrades
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation with warm-up, repetitions, CPU pinning, JSON output
+ *               and baseline regression comparison
+ *
+ * Carry-over Context:
+ * - Allocation counters are fed by the malloc interposer in the benchmark driver;
+ *   the harness itself never allocates inside the timed loop
+ * - Results are reported as the median of all repetitions to damp scheduler noise
+ * - Next: thread-scaling and soak benchmarks reuse this output format
+ */
+
+#ifndef TERNARY_FISSION_BENCH_HARNESS_H
+#define TERNARY_FISSION_BENCH_HARNESS_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <json/json.h>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace TernaryFission {
+namespace Bench {
+
+/*
+ * Process-wide allocation counters
+ * We count every malloc-family call made while a benchmark is being timed
+ */
+struct AllocationCounters {
+    std::atomic<std::uint64_t> allocations{0};
+    std::atomic<std::uint64_t> bytes{0};
+    std::atomic<bool> enabled{false};
+};
+
+inline AllocationCounters& allocationCounters() {
+    static AllocationCounters counters;
+    return counters;
+}
+
+/*
+ * Record an allocation from the interposer
+ * We keep this branch-light because it runs on every malloc in the process
+ */
+inline void recordAllocation(std::size_t bytes) {
+    AllocationCounters& counters = allocationCounters();
+    if (counters.enabled.load(std::memory_order_relaxed)) {
+        counters.allocations.fetch_add(1, std::memory_order_relaxed);
+        counters.bytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+}
+
+/*
+ * Prevent the optimizer from discarding benchmark results
+ */
+template <typename T>
+inline void doNotOptimize(T const& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/*
+ * Harness options shared by every benchmark in a run
+ */
+struct BenchmarkOptions {
+    int warmup_iterations = 16;
+    int repetitions = 7;
+    double min_time_seconds = 0.05;
+    std::uint64_t max_iterations = 1000000;
+    int cpu = -1;                   // -1 keeps the current affinity
+    std::string filter;             // substring match on benchmark name
+    std::string output_path;
+    std::string baseline_path;
+    double regression_threshold_percent = 10.0;
+};
+
+/*
+ * Result for a single benchmark
+ */
+struct BenchmarkResult {
+    std::string name;
+    std::uint64_t iterations = 0;
+    int repetitions = 0;
+    double ns_per_op = 0.0;         // median across repetitions
+    double ns_per_op_min = 0.0;
+    double ns_per_op_max = 0.0;
+    double ns_per_op_stddev = 0.0;
+    double bytes_per_op = 0.0;
+    double allocs_per_op = 0.0;
+};
+
+/*
+ * A benchmark body runs the measured operation `iterations` times
+ */
+using BenchmarkBody = std::function<void(std::uint64_t iterations)>;
+
+struct BenchmarkCase {
+    std::string name;
+    BenchmarkBody body;
+};
+
+/*
+ * Pin the calling thread to a single CPU
+ * We return false when the platform or cgroup does not allow it
+ */
+inline bool pinToCPU(int cpu) {
+#ifdef __linux__
+    if (cpu < 0) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+/*
+ * Run one benchmark case with warm-up, calibration and repetitions
+ */
+inline BenchmarkResult runBenchmark(const BenchmarkCase& bench, const BenchmarkOptions& options) {
+    using clock = std::chrono::steady_clock;
+    BenchmarkResult result;
+    result.name = bench.name;
+
+    // We warm caches, branch predictors and lazy initialization first
+    bench.body(static_cast<std::uint64_t>(std::max(1, options.warmup_iterations)));
+
+    // We calibrate the iteration count so each repetition lasts at least min_time_seconds
+    std::uint64_t iterations = 1;
+    while (true) {
+        auto start = clock::now();
+        bench.body(iterations);
+        double elapsed = std::chrono::duration<double>(clock::now() - start).count();
+        if (elapsed >= options.min_time_seconds || iterations >= options.max_iterations) {
+            break;
+        }
+        double scale = elapsed > 0.0 ? (options.min_time_seconds / elapsed) * 1.2 : 10.0;
+        std::uint64_t next = static_cast<std::uint64_t>(iterations * std::min(10.0, std::max(2.0, scale)));
+        iterations = std::min(options.max_iterations, next);
+    }
+
+    std::vector<double> samples;
+    samples.reserve(static_cast<std::size_t>(options.repetitions));
+    AllocationCounters& counters = allocationCounters();
+    std::uint64_t total_allocations = 0;
+    std::uint64_t total_bytes = 0;
+
+    for (int rep = 0; rep < options.repetitions; ++rep) {
+        std::uint64_t allocs_before = counters.allocations.load(std::memory_order_relaxed);
+        std::uint64_t bytes_before = counters.bytes.load(std::memory_order_relaxed);
+        counters.enabled.store(true, std::memory_order_relaxed);
+
+        auto start = clock::now();
+        bench.body(iterations);
+        auto end = clock::now();
+
+        counters.enabled.store(false, std::memory_order_relaxed);
+        total_allocations += counters.allocations.load(std::memory_order_relaxed) - allocs_before;
+        total_bytes += counters.bytes.load(std::memory_order_relaxed) - bytes_before;
+
+        double ns = std::chrono::duration<double, std::nano>(end - start).count();
+        samples.push_back(ns / static_cast<double>(iterations));
+    }
+
+    std::vector<double> sorted = samples;
+    std::sort(sorted.begin(), sorted.end());
+    double mean = 0.0;
+    for (double s : samples) {
+        mean += s;
+    }
+    mean /= static_cast<double>(samples.size());
+    double variance = 0.0;
+    for (double s : samples) {
+        variance += (s - mean) * (s - mean);
+    }
+
+    double total_ops = static_cast<double>(iterations) * options.repetitions;
+    result.iterations = iterations;
+    result.repetitions = options.repetitions;
+    result.ns_per_op = sorted[sorted.size() / 2];
+    result.ns_per_op_min = sorted.front();
+    result.ns_per_op_max = sorted.back();
+    result.ns_per_op_stddev = std::sqrt(variance / static_cast<double>(samples.size()));
+    result.bytes_per_op = total_bytes / total_ops;
+    result.allocs_per_op = total_allocations / total_ops;
+    return result;
+}
+
+/*
+ * Serialize benchmark results to the machine-readable report format
+ */
+inline Json::Value resultsToJSON(const std::vector<BenchmarkResult>& results,
+                                 const BenchmarkOptions& options, bool pinned) {
+    Json::Value report;
+    report["schema"] = "ternary-fission-bench/1";
+    report["version"] = VERSION;
+    report["git_commit"] = GIT_COMMIT;
+    report["pinned_cpu"] = pinned ? options.cpu : -1;
+    report["repetitions"] = options.repetitions;
+    report["min_time_seconds"] = options.min_time_seconds;
+
+    auto now = std::chrono::system_clock::now();
+    auto time_t = std::chrono::system_clock::to_time_t(now);
+    std::stringstream timestamp_ss;
+    timestamp_ss << std::put_time(std::gmtime(&time_t), "%Y-%m-%dT%H:%M:%SZ");
+    report["timestamp"] = timestamp_ss.str();
+
+    Json::Value benchmarks(Json::arrayValue);
+    for (const auto& r : results) {
+        Json::Value entry;
+        entry["name"] = r.name;
+        entry["iterations"] = static_cast<Json::UInt64>(r.iterations);
+        entry["repetitions"] = r.repetitions;
+        entry["ns_per_op"] = r.ns_per_op;
+        entry["ns_per_op_min"] = r.ns_per_op_min;
+        entry["ns_per_op_max"] = r.ns_per_op_max;
+        entry["ns_per_op_stddev"] = r.ns_per_op_stddev;
+        entry["bytes_per_op"] = r.bytes_per_op;
+        entry["allocs_per_op"] = r.allocs_per_op;
+        benchmarks.append(entry);
+    }
+    report["benchmarks"] = benchmarks;
+    return report;
+}
+
+/*
+ * Compare a run against a stored baseline report
+ * We flag a regression when ns/op grows beyond the threshold or allocations/op increase
+ *
+ * @return: number of regressions found
+ */
+inline int compareWithBaseline(const std::vector<BenchmarkResult>& results,
+                               const Json::Value& baseline, double threshold_percent,
+                               std::ostream& out) {
+    std::map<std::string, Json::Value> baseline_by_name;
+    for (const auto& entry : baseline["benchmarks"]) {
+        baseline_by_name[entry["name"].asString()] = entry;
+    }
+
+    int regressions = 0;
+    out << "\n=== Baseline Comparison (threshold " << threshold_percent << "%) ===" << std::endl;
+    for (const auto& r : results) {
+        auto it = baseline_by_name.find(r.name);
+        if (it == baseline_by_name.end()) {
+            out << std::left << std::setw(36) << r.name << " (new, no baseline)" << std::endl;
+            continue;
+        }
+
+        double base_ns = it->second["ns_per_op"].asDouble();
+        double base_allocs = it->second["allocs_per_op"].asDouble();
+        double delta = base_ns > 0.0 ? (r.ns_per_op - base_ns) / base_ns * 100.0 : 0.0;
+        bool slower = delta > threshold_percent;
+        bool more_allocs = r.allocs_per_op > base_allocs + 0.5;
+
+        out << std::left << std::setw(36) << r.name
+            << std::right << std::setw(12) << std::fixed << std::setprecision(1) << base_ns
+            << " -> " << std::setw(12) << r.ns_per_op << " ns/op  "
+            << std::showpos << std::setw(7) << delta << "%" << std::noshowpos;
+        if (slower || more_allocs) {
+            ++regressions;
+            out << "  REGRESSION";
+            if (more_allocs) {
+                out << " (allocs/op " << base_allocs << " -> " << r.allocs_per_op << ")";
+            }
+        } else if (delta < -threshold_percent) {
+            out << "  improved";
+        }
+        out << std::endl;
+    }
+    return regressions;
+}
+
+/*
+ * Print a human-readable summary table
+ */
+inline void printResults(const std::vector<BenchmarkResult>& results, std::ostream& out) {
+    out << std::left << std::setw(36) << "benchmark"
+        << std::right << std::setw(14) << "ns/op"
+        << std::setw(10) << "+/-%"
+        << std::setw(14) << "bytes/op"
+        << std::setw(12) << "allocs/op"
+        << std::setw(12) << "iters" << std::endl;
+    for (const auto& r : results) {
+        double spread = r.ns_per_op > 0.0 ? r.ns_per_op_stddev / r.ns_per_op * 100.0 : 0.0;
+        out << std::left << std::setw(36) << r.name
+            << std::right << std::fixed
+            << std::setw(14) << std::setprecision(1) << r.ns_per_op
+            << std::setw(10) << std::setprecision(1) << spread
+            << std::setw(14) << std::setprecision(0) << r.bytes_per_op
+            << std::setw(12) << std::setprecision(2) << r.allocs_per_op
+            << std::setw(12) << r.iterations << std::endl;
+    }
+}
+
+/*
+ * Parse common harness command line options
+ * We return false and print usage on unknown arguments
+ */
+inline bool parseOptions(int argc, char* argv[], BenchmarkOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&](const char* name) -> const char* {
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for " << name << std::endl;
+                return nullptr;
+            }
+            return argv[++i];
+        };
+
+        const char* value = nullptr;
+        if (arg == "--warmup" && (value = next("--warmup"))) {
+            options.warmup_iterations = std::atoi(value);
+        } else if (arg == "--repetitions" && (value = next("--repetitions"))) {
+            options.repetitions = std::max(1, std::atoi(value));
+        } else if (arg == "--min-time" && (value = next("--min-time"))) {
+            options.min_time_seconds = std::atof(value);
+        } else if (arg == "--cpu" && (value = next("--cpu"))) {
+            options.cpu = std::atoi(value);
+        } else if (arg == "--filter" && (value = next("--filter"))) {
+            options.filter = value;
+        } else if (arg == "--output" && (value = next("--output"))) {
+            options.output_path = value;
+        } else if (arg == "--baseline" && (value = next("--baseline"))) {
+            options.baseline_path = value;
+        } else if (arg == "--threshold" && (value = next("--threshold"))) {
+            options.regression_threshold_percent = std::atof(value);
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--warmup N] [--repetitions N] [--min-time SEC]\n"
+                      << "       [--cpu N] [--filter SUBSTR] [--output FILE]\n"
+                      << "       [--baseline FILE] [--threshold PERCENT]" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * Run a suite of cases and handle output and baseline comparison
+ * We return the process exit code: 0 on success, 1 on regressions, 2 on errors
+ */
+inline int runSuite(const std::vector<BenchmarkCase>& cases, const BenchmarkOptions& options) {
+    bool pinned = pinToCPU(options.cpu);
+    if (options.cpu >= 0 && !pinned) {
+        std::cerr << "Warning: could not pin to CPU " << options.cpu << ", running unpinned" << std::endl;
+    }
+
+    std::vector<BenchmarkResult> results;
+    for (const auto& bench : cases) {
+        if (!options.filter.empty() && bench.name.find(options.filter) == std::string::npos) {
+            continue;
+        }
+        results.push_back(runBenchmark(bench, options));
+    }
+
+    printResults(results, std::cout);
+
+    Json::Value report = resultsToJSON(results, options, pinned);
+    if (!options.output_path.empty()) {
+        std::ofstream out(options.output_path);
+        if (!out) {
+            std::cerr << "Error: cannot write " << options.output_path << std::endl;
+            return 2;
+        }
+        Json::StreamWriterBuilder builder;
+        builder["indentation"] = "  ";
+        out << Json::writeString(builder, report) << std::endl;
+        std::cout << "Results written to " << options.output_path << std::endl;
+    }
+
+    if (!options.baseline_path.empty()) {
+        std::ifstream in(options.baseline_path);
+        Json::Value baseline;
+        Json::CharReaderBuilder reader;
+        std::string errors;
+        if (!in || !Json::parseFromStream(reader, in, &baseline, &errors)) {
+            std::cerr << "Error: cannot read baseline " << options.baseline_path << " " << errors << std::endl;
+            return 2;
+        }
+        int regressions = compareWithBaseline(results, baseline,
+                                              options.regression_threshold_percent, std::cout);
+        if (regressions > 0) {
+            std::cout << regressions << " regression(s) against baseline" << std::endl;
+            return 1;
+        }
+        std::cout << "No regressions against baseline" << std::endl;
+    }
+    return 0;
+}
+
+} // namespace Bench
+} // namespace TernaryFission
+
+#endif // TERNARY_FISSION_BENCH_HARNESS_H
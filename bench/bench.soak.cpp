@@ -0,0 +1,421 @@
+/*
+ * File: bench/bench.soak.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Soak Benchmark and Memory Leak Guard
+ * Purpose: Runs continuous simulation plus HTTP API churn and fails on memory growth
+ * Reason: We need headless leak detection for long-running daemon processes
+ *         (NEXT-STEPS: "memory leak detection in long-running processes")
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation with RSS/HWM, allocator and live-object sampling,
+ *               steady-state RSS slope and bytes-per-live-object thresholds
+ *
+ * Carry-over Context:
+ * - An in-process HTTPTernaryFissionServer on 127.0.0.1 shares the engine, so API churn
+ *   exercises the same code paths as the daemon
+ * - The first --settle fraction of samples is ignored while field population ramps up;
+ *   continuous mode dissipates and releases fields once per second
+ * - Overhead per live object excludes field backing bytes, which scale with --bytes-per-mev
+ * - Exit status: 0 pass, 1 threshold exceeded, 2 setup failure
+ */
+
+#include "config.ternary.fission.server.h"
+#include "http.ternary.fission.server.h"
+#include "physics.utilities.h"
+#include "system.metrics.h"
+#include "ternary.fission.simulation.engine.h"
+
+#include <httplib.h>
+#include <json/json.h>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace TernaryFission;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+struct SoakOptions {
+    double duration_seconds = 120.0;
+    double sample_interval_seconds = 1.0;
+    double settle_fraction = 0.5;
+    double events_per_second = 200.0;
+    int worker_threads = 2;
+    int api_clients = 2;
+    double api_interval_ms = 5.0;
+    double bytes_per_mev = 256.0;
+    std::size_t event_history = 10000;
+    int port = 18433;
+    double max_rss_slope_kib_per_min = 1024.0;
+    double max_bytes_per_object = 16384.0;
+    std::string output_path;
+};
+
+struct Sample {
+    double t = 0.0;
+    std::uint64_t rss_bytes = 0;
+    std::uint64_t hwm_bytes = 0;
+    std::uint64_t heap_in_use_bytes = 0;
+    std::uint64_t heap_free_bytes = 0;
+    std::uint64_t engine_fields = 0;
+    std::uint64_t field_memory_bytes = 0;
+    std::uint64_t event_history = 0;
+    std::uint64_t server_fields = 0;
+    std::uint64_t websocket_connections = 0;
+    std::uint64_t events_simulated = 0;
+    std::uint64_t api_requests = 0;
+
+    std::uint64_t liveObjects() const {
+        return engine_fields + event_history + server_fields + websocket_connections;
+    }
+};
+
+/*
+ * Allocator statistics (glibc only)
+ */
+void readAllocatorStats(Sample& sample) {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    struct mallinfo2 info = mallinfo2();
+    sample.heap_in_use_bytes = info.uordblks + info.hblkhd;
+    sample.heap_free_bytes = info.fordblks;
+#else
+    (void)sample;
+#endif
+}
+
+/*
+ * Ordinary least-squares slope of y over x
+ */
+double slope(const std::vector<double>& x, const std::vector<double>& y) {
+    if (x.size() < 2) {
+        return 0.0;
+    }
+    double mx = 0.0, my = 0.0;
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        mx += x[i];
+        my += y[i];
+    }
+    mx /= x.size();
+    my /= y.size();
+    double sxy = 0.0, sxx = 0.0;
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        sxy += (x[i] - mx) * (y[i] - my);
+        sxx += (x[i] - mx) * (x[i] - mx);
+    }
+    return sxx > 0.0 ? sxy / sxx : 0.0;
+}
+
+/*
+ * One API client: field CRUD, physics calls and occasional status polls
+ */
+void runApiClient(const SoakOptions& options, std::atomic<bool>& running,
+                  std::atomic<std::uint64_t>& requests, int client_id) {
+    httplib::Client client("127.0.0.1", options.port);
+    client.set_keep_alive(true);
+    const std::string json = "application/json";
+    std::uint64_t iteration = 0;
+
+    while (running.load()) {
+        auto created = client.Post("/api/v1/energy-fields",
+                                   "{\"energy_level_mev\":50.0,\"dissipation_rate\":0.01}", json);
+        requests.fetch_add(1, std::memory_order_relaxed);
+        if (created && created->status == 201) {
+            Json::Value body;
+            Json::CharReaderBuilder builder;
+            std::string errors;
+            std::istringstream in(created->body);
+            if (Json::parseFromStream(builder, in, &body, &errors)) {
+                std::string path = "/api/v1/energy-fields/" + body["field_id"].asString();
+                client.Get(path);
+                client.Put(path, "{\"dissipation_rate\":0.02}", json);
+                client.Delete(path);
+                requests.fetch_add(3, std::memory_order_relaxed);
+            }
+        }
+
+        client.Post("/api/v1/physics/fission", "{\"parent_mass\":235.0,\"excitation_energy\":6.5}", json);
+        client.Post("/api/v1/physics/energy", "{\"energy_mev\":5.0,\"dissipation_rounds\":2}", json);
+        client.Get("/api/v1/energy-fields");
+        requests.fetch_add(3, std::memory_order_relaxed);
+
+        // Status samples CPU for 100 ms, so we poll it sparingly
+        if ((iteration++ + static_cast<std::uint64_t>(client_id)) % 50 == 0) {
+            client.Get("/api/v1/status");
+            requests.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(options.api_interval_ms));
+    }
+}
+
+bool parseArgs(int argc, char* argv[], SoakOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h" || i + 1 >= argc) {
+            std::cerr << "Usage: " << argv[0] << " [options]\n"
+                      << "  --duration SEC              Total run time (default 120)\n"
+                      << "  --sample-interval SEC       Sampling period (default 1)\n"
+                      << "  --settle FRACTION           Leading fraction ignored (default 0.5)\n"
+                      << "  --rate EPS                  Continuous simulation rate (default 200)\n"
+                      << "  --workers N                 Engine worker threads (default 2)\n"
+                      << "  --api-clients N             HTTP churn clients (default 2)\n"
+                      << "  --api-interval-ms MS        Pause between client cycles (default 5)\n"
+                      << "  --bytes-per-mev N           Field memory scale (default 256)\n"
+                      << "  --event-history N           Engine event history limit (default 10000)\n"
+                      << "  --port PORT                 Loopback port for the server (default 18433)\n"
+                      << "  --max-rss-slope KIB_PER_MIN Steady-state RSS growth limit (default 1024)\n"
+                      << "  --max-bytes-per-object N    Overhead per live object limit (default 16384)\n"
+                      << "  --output FILE               Write samples and summary as JSON" << std::endl;
+            return false;
+        }
+        std::string value = argv[++i];
+        if (arg == "--duration") options.duration_seconds = std::atof(value.c_str());
+        else if (arg == "--sample-interval") options.sample_interval_seconds = std::atof(value.c_str());
+        else if (arg == "--settle") options.settle_fraction = std::atof(value.c_str());
+        else if (arg == "--rate") options.events_per_second = std::atof(value.c_str());
+        else if (arg == "--workers") options.worker_threads = std::max(1, std::atoi(value.c_str()));
+        else if (arg == "--api-clients") options.api_clients = std::max(0, std::atoi(value.c_str()));
+        else if (arg == "--api-interval-ms") options.api_interval_ms = std::atof(value.c_str());
+        else if (arg == "--bytes-per-mev") options.bytes_per_mev = std::atof(value.c_str());
+        else if (arg == "--event-history") options.event_history = std::strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--port") options.port = std::atoi(value.c_str());
+        else if (arg == "--max-rss-slope") options.max_rss_slope_kib_per_min = std::atof(value.c_str());
+        else if (arg == "--max-bytes-per-object") options.max_bytes_per_object = std::atof(value.c_str());
+        else if (arg == "--output") options.output_path = value;
+        else {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            return false;
+        }
+    }
+    options.settle_fraction = std::min(0.9, std::max(0.0, options.settle_fraction));
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    SoakOptions options;
+    if (!parseArgs(argc, argv, options)) {
+        return 2;
+    }
+
+    // We keep our report on the real stdout and silence per-request server logging
+    std::ostream report(std::cout.rdbuf());
+    std::ostringstream discard;
+    std::cout.rdbuf(discard.rdbuf());
+    auto drainDiscard = [&discard]() {
+        discard.str(std::string());
+        discard.clear();
+    };
+
+    g_energy_field_config.memory_per_mev = options.bytes_per_mev;
+
+    auto engine = std::make_shared<TernaryFissionSimulationEngine>(235.0, 6.5, options.worker_threads);
+    engine->setEventHistoryLimit(options.event_history);
+
+    ::setenv("TERNARY_BIND_IP", "127.0.0.1", 1);
+    ::setenv("TERNARY_BIND_PORT", std::to_string(options.port).c_str(), 1);
+    auto server = std::make_unique<HTTPTernaryFissionServer>(std::make_unique<ConfigurationManager>(""));
+    server->setSimulationEngine(engine);
+    if (!server->initialize()) {
+        std::cerr << "Failed to initialize HTTP server" << std::endl;
+        return 2;
+    }
+    std::thread server_thread([&server]() { server->start(); });
+
+    {
+        httplib::Client probe("127.0.0.1", options.port);
+        bool ready = false;
+        for (int attempt = 0; attempt < 50 && !ready; ++attempt) {
+            ready = static_cast<bool>(probe.Get("/api/v1/health"));
+            if (!ready) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
+        }
+        if (!ready) {
+            std::cerr << "Server did not come up on port " << options.port << std::endl;
+            server->stop();
+            server_thread.join();
+            return 2;
+        }
+    }
+
+    MemoryUsage baseline = getMemoryUsage();
+
+    report << "\n=== Ternary Fission Soak ===\n"
+           << "duration " << options.duration_seconds << "s, rate " << options.events_per_second
+           << " ev/s, " << options.api_clients << " API clients, " << options.bytes_per_mev
+           << " bytes/MeV, baseline RSS " << baseline.rss_bytes / 1024 << " KiB" << std::endl;
+
+    std::atomic<bool> running{true};
+    std::atomic<std::uint64_t> api_requests{0};
+    engine->startContinuousSimulation(options.events_per_second);
+
+    std::vector<std::thread> clients;
+    for (int c = 0; c < options.api_clients; ++c) {
+        clients.emplace_back(runApiClient, std::cref(options), std::ref(running), std::ref(api_requests), c);
+    }
+
+    std::vector<Sample> samples;
+    auto start = Clock::now();
+    auto next_sample = start;
+    auto end = start + std::chrono::duration_cast<Clock::duration>(
+                           std::chrono::duration<double>(options.duration_seconds));
+    auto interval = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(options.sample_interval_seconds));
+
+    report << std::setw(7) << "t(s)" << std::setw(12) << "RSS KiB" << std::setw(12) << "heap KiB"
+           << std::setw(9) << "fields" << std::setw(10) << "events" << std::setw(9) << "srv flds"
+           << std::setw(8) << "ws" << std::setw(10) << "api req" << std::endl;
+
+    while (Clock::now() < end) {
+        next_sample += interval;
+        std::this_thread::sleep_until(std::min(next_sample, end));
+        drainDiscard();
+
+        Sample sample;
+        sample.t = std::chrono::duration<double>(Clock::now() - start).count();
+        MemoryUsage mem = getMemoryUsage();
+        sample.rss_bytes = mem.rss_bytes;
+        sample.hwm_bytes = mem.peak_bytes;
+        readAllocatorStats(sample);
+        Json::Value accounting = engine->getMemoryAccountingAPI();
+        sample.engine_fields = accounting["active_energy_fields"].asUInt64();
+        sample.field_memory_bytes = accounting["field_memory_bytes"].asUInt64();
+        sample.event_history = accounting["fission_event_history"].asUInt64();
+        sample.server_fields = server->getActiveEnergyFields().size();
+        sample.websocket_connections = server->getActiveWebSocketConnections();
+        sample.events_simulated = engine->getTotalEnergyFieldsCreated();
+        sample.api_requests = api_requests.load();
+        samples.push_back(sample);
+
+        report << std::fixed << std::setprecision(1) << std::setw(7) << sample.t
+               << std::setw(12) << sample.rss_bytes / 1024 << std::setw(12) << sample.heap_in_use_bytes / 1024
+               << std::setw(9) << sample.engine_fields << std::setw(10) << sample.event_history
+               << std::setw(9) << sample.server_fields << std::setw(8) << sample.websocket_connections
+               << std::setw(10) << sample.api_requests << std::endl;
+    }
+
+    running.store(false);
+    for (auto& client : clients) {
+        client.join();
+    }
+    engine->stopContinuousSimulation();
+    server->stop();
+    server_thread.join();
+    server.reset();
+    drainDiscard();
+
+    // We analyse only the steady-state tail
+    std::size_t first = static_cast<std::size_t>(samples.size() * options.settle_fraction);
+    std::vector<double> t, rss, heap;
+    double rss_sum = 0.0, field_bytes_sum = 0.0, live_sum = 0.0;
+    for (std::size_t i = first; i < samples.size(); ++i) {
+        t.push_back(samples[i].t);
+        rss.push_back(static_cast<double>(samples[i].rss_bytes));
+        heap.push_back(static_cast<double>(samples[i].heap_in_use_bytes));
+        rss_sum += samples[i].rss_bytes;
+        field_bytes_sum += samples[i].field_memory_bytes;
+        live_sum += samples[i].liveObjects();
+    }
+    std::size_t steady_count = t.size();
+    double rss_slope_kib_per_min = slope(t, rss) * 60.0 / 1024.0;
+    double heap_slope_kib_per_min = slope(t, heap) * 60.0 / 1024.0;
+    double bytes_per_object = 0.0;
+    if (steady_count > 0 && live_sum > 0.0) {
+        double rss_mean = rss_sum / steady_count;
+        double field_bytes_mean = field_bytes_sum / steady_count;
+        double live_mean = live_sum / steady_count;
+        double overhead = rss_mean - static_cast<double>(baseline.rss_bytes) - field_bytes_mean;
+        bytes_per_object = std::max(0.0, overhead) / live_mean;
+    }
+
+    bool slope_ok = rss_slope_kib_per_min <= options.max_rss_slope_kib_per_min;
+    bool per_object_ok = bytes_per_object <= options.max_bytes_per_object;
+    bool enough_samples = steady_count >= 3;
+
+    report << std::setprecision(1)
+           << "\nSteady-state samples: " << steady_count
+           << "\nRSS slope: " << rss_slope_kib_per_min << " KiB/min (limit "
+           << options.max_rss_slope_kib_per_min << ")"
+           << "\nHeap slope: " << heap_slope_kib_per_min << " KiB/min"
+           << "\nOverhead per live object: " << bytes_per_object << " bytes (limit "
+           << options.max_bytes_per_object << ")"
+           << "\nPeak RSS: " << (samples.empty() ? 0 : samples.back().hwm_bytes / 1024) << " KiB" << std::endl;
+
+    if (!options.output_path.empty()) {
+        Json::Value json;
+        json["schema"] = "ternary-fission-soak/1";
+        Json::Value config;
+        config["duration_seconds"] = options.duration_seconds;
+        config["events_per_second"] = options.events_per_second;
+        config["api_clients"] = options.api_clients;
+        config["bytes_per_mev"] = options.bytes_per_mev;
+        config["event_history"] = static_cast<Json::UInt64>(options.event_history);
+        config["settle_fraction"] = options.settle_fraction;
+        json["config"] = config;
+
+        Json::Value summary;
+        summary["baseline_rss_bytes"] = static_cast<Json::UInt64>(baseline.rss_bytes);
+        summary["rss_slope_kib_per_min"] = rss_slope_kib_per_min;
+        summary["heap_slope_kib_per_min"] = heap_slope_kib_per_min;
+        summary["bytes_per_live_object"] = bytes_per_object;
+        summary["passed"] = slope_ok && per_object_ok && enough_samples;
+        json["summary"] = summary;
+
+        Json::Value rows(Json::arrayValue);
+        for (const auto& s : samples) {
+            Json::Value row;
+            row["t"] = s.t;
+            row["rss_bytes"] = static_cast<Json::UInt64>(s.rss_bytes);
+            row["hwm_bytes"] = static_cast<Json::UInt64>(s.hwm_bytes);
+            row["heap_in_use_bytes"] = static_cast<Json::UInt64>(s.heap_in_use_bytes);
+            row["heap_free_bytes"] = static_cast<Json::UInt64>(s.heap_free_bytes);
+            row["engine_fields"] = static_cast<Json::UInt64>(s.engine_fields);
+            row["field_memory_bytes"] = static_cast<Json::UInt64>(s.field_memory_bytes);
+            row["event_history"] = static_cast<Json::UInt64>(s.event_history);
+            row["server_fields"] = static_cast<Json::UInt64>(s.server_fields);
+            row["websocket_connections"] = static_cast<Json::UInt64>(s.websocket_connections);
+            row["events_simulated"] = static_cast<Json::UInt64>(s.events_simulated);
+            row["api_requests"] = static_cast<Json::UInt64>(s.api_requests);
+            rows.append(row);
+        }
+        json["samples"] = rows;
+
+        std::ofstream out(options.output_path);
+        Json::StreamWriterBuilder builder;
+        builder["indentation"] = "  ";
+        out << Json::writeString(builder, json) << std::endl;
+        report << "Samples written to " << options.output_path << std::endl;
+    }
+
+    engine.reset();
+    std::cout.rdbuf(report.rdbuf());
+
+    if (!enough_samples) {
+        std::cerr << "FAIL: not enough steady-state samples; increase --duration" << std::endl;
+        return 1;
+    }
+    if (!slope_ok || !per_object_ok) {
+        std::cerr << "FAIL: memory growth exceeds soak thresholds" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ Soak passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,507 @@
+/*
+ * File: bench/bench.thread.scaling.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Thread-Scaling Harness for the Simulation Engine
+ * Purpose: Runs fixed engine workloads at 1..N threads and fits Amdahl/USL models
+ * Reason: We need to know where TernaryFissionSimulationEngine stops scaling and which
+ *         lock or subsystem is responsible, release over release
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation with batch, continuous and fields workloads,
+ *               per-lock wait accounting, per-core utilization and CSV/JSON output
+ *
+ * Carry-over Context:
+ * - batch:      N threads call simulateTernaryFissionEvent (generate + field + state_mutex)
+ * - continuous: the engine's own generator thread feeding N worker threads
+ * - fields:     N threads create, dissipate and free fields (allocator + OpenSSL only)
+ * - Each point uses a fresh engine; field memory is scaled down with --bytes-per-mev
+ *   so the run measures contention rather than page faults
+ * - USL: N/C(N) - 1 = sigma*(N-1) + kappa*N*(N-1), solved by least squares;
+ *   Amdahl is the same fit with kappa = 0
+ */
+
+#include "bench.harness.h"
+
+#include "physics.utilities.h"
+#include "ternary.fission.simulation.engine.h"
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace TernaryFission;
+using namespace TernaryFission::Bench;
+
+namespace {
+
+struct ScalingOptions {
+    std::vector<int> threads;
+    std::vector<std::string> workloads = {"batch", "continuous", "fields"};
+    double duration_seconds = 1.0;
+    double warmup_seconds = 0.2;
+    double bytes_per_mev = 64.0;
+    double field_energy_mev = 10.0;
+    double continuous_rate = 100000.0;
+    std::string json_path;
+    std::string csv_path;
+};
+
+const std::vector<std::string> kLockNames = {
+    "state_mutex", "queue_mutex", "computation_time_mutex", "api_mutex"};
+
+/*
+ * Per-core jiffies from /proc/stat
+ */
+struct CpuTimes {
+    std::vector<std::uint64_t> busy;
+    std::vector<std::uint64_t> total;
+};
+
+CpuTimes readCpuTimes() {
+    CpuTimes times;
+    std::ifstream stat("/proc/stat");
+    std::string line;
+    while (std::getline(stat, line)) {
+        if (line.compare(0, 3, "cpu") != 0 || line.size() < 4 || !std::isdigit(static_cast<unsigned char>(line[3]))) {
+            continue;
+        }
+        std::istringstream in(line);
+        std::string label;
+        std::uint64_t user = 0, nice = 0, system = 0, idle = 0, iowait = 0, irq = 0, softirq = 0, steal = 0;
+        in >> label >> user >> nice >> system >> idle >> iowait >> irq >> softirq >> steal;
+        std::uint64_t total = user + nice + system + idle + iowait + irq + softirq + steal;
+        times.busy.push_back(total - idle - iowait);
+        times.total.push_back(total);
+    }
+    return times;
+}
+
+double processCpuSeconds() {
+    struct rusage usage {};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1e6 +
+           usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1e6;
+}
+
+struct ScalingPoint {
+    int threads = 0;
+    double ops_per_second = 0.0;
+    double speedup = 0.0;
+    double efficiency = 0.0;
+    double cores_used = 0.0;
+    std::vector<double> core_utilization;
+    Json::Value locks;
+};
+
+struct ScalingFit {
+    double amdahl_sigma = 0.0;
+    double usl_sigma = 0.0;
+    double usl_kappa = 0.0;
+    double usl_peak_threads = 0.0;
+    double usl_r_squared = 0.0;
+};
+
+/*
+ * Silence engine console chatter while constructing and destroying engines
+ */
+class QuietConsole {
+public:
+    QuietConsole() : saved_(std::cout.rdbuf(sink_.rdbuf())) {}
+    ~QuietConsole() { std::cout.rdbuf(saved_); }
+
+private:
+    std::ostringstream sink_;
+    std::streambuf* saved_;
+};
+
+/*
+ * Run one workload at one thread count
+ * We measure operations completed inside the window after warm-up and
+ * difference the lock counters across the same window
+ */
+ScalingPoint runPoint(const std::string& workload, int threads, const ScalingOptions& options) {
+    std::unique_ptr<TernaryFissionSimulationEngine> engine;
+    {
+        QuietConsole quiet;
+        engine = std::make_unique<TernaryFissionSimulationEngine>(
+            235.0, 6.5, workload == "continuous" ? threads : 1);
+    }
+
+    std::atomic<bool> running{true};
+    std::vector<std::atomic<std::uint64_t>> ops(static_cast<std::size_t>(threads));
+    std::vector<std::thread> drivers;
+
+    if (workload == "continuous") {
+        QuietConsole quiet;
+        engine->startContinuousSimulation(options.continuous_rate);
+    } else {
+        for (int t = 0; t < threads; ++t) {
+            drivers.emplace_back([&, t]() {
+                auto& counter = ops[static_cast<std::size_t>(t)];
+                while (running.load(std::memory_order_relaxed)) {
+                    if (workload == "batch") {
+                        TernaryFissionEvent event = engine->simulateTernaryFissionEvent(235.0, 6.5);
+                        doNotOptimize(event.q_value);
+                    } else {
+                        EnergyField field = engine->createEnergyField(options.field_energy_mev);
+                        engine->dissipateEnergyField(field, 1);
+                        std::free(field.memory_ptr);
+                    }
+                    counter.fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        }
+    }
+
+    auto completed = [&]() -> std::uint64_t {
+        if (workload == "continuous") {
+            return engine->getTotalEnergyFieldsCreated();
+        }
+        std::uint64_t sum = 0;
+        for (auto& counter : ops) {
+            sum += counter.load(std::memory_order_relaxed);
+        }
+        return sum;
+    };
+
+    std::this_thread::sleep_for(std::chrono::duration<double>(options.warmup_seconds));
+
+    Json::Value locks_before = engine->getLockWaitStatisticsAPI();
+    CpuTimes cpu_before = readCpuTimes();
+    double process_before = processCpuSeconds();
+    std::uint64_t ops_before = completed();
+    auto start = std::chrono::steady_clock::now();
+
+    std::this_thread::sleep_for(std::chrono::duration<double>(options.duration_seconds));
+
+    std::uint64_t ops_after = completed();
+    auto end = std::chrono::steady_clock::now();
+    double process_after = processCpuSeconds();
+    CpuTimes cpu_after = readCpuTimes();
+    Json::Value locks_after = engine->getLockWaitStatisticsAPI();
+
+    running.store(false);
+    for (auto& driver : drivers) {
+        driver.join();
+    }
+    {
+        QuietConsole quiet;
+        engine.reset();
+    }
+
+    double wall = std::chrono::duration<double>(end - start).count();
+    ScalingPoint point;
+    point.threads = threads;
+    point.ops_per_second = static_cast<double>(ops_after - ops_before) / wall;
+    point.cores_used = (process_after - process_before) / wall;
+
+    for (std::size_t c = 0; c < cpu_after.total.size() && c < cpu_before.total.size(); ++c) {
+        std::uint64_t total = cpu_after.total[c] - cpu_before.total[c];
+        std::uint64_t busy = cpu_after.busy[c] - cpu_before.busy[c];
+        point.core_utilization.push_back(total > 0 ? static_cast<double>(busy) / total : 0.0);
+    }
+
+    for (const auto& name : kLockNames) {
+        Json::Value lock;
+        std::uint64_t acquisitions = locks_after[name]["acquisitions"].asUInt64() -
+                                     locks_before[name]["acquisitions"].asUInt64();
+        std::uint64_t contended = locks_after[name]["contended"].asUInt64() -
+                                  locks_before[name]["contended"].asUInt64();
+        std::uint64_t wait_ns = locks_after[name]["wait_ns"].asUInt64() -
+                                locks_before[name]["wait_ns"].asUInt64();
+        lock["acquisitions"] = static_cast<Json::UInt64>(acquisitions);
+        lock["contended"] = static_cast<Json::UInt64>(contended);
+        lock["wait_ms"] = wait_ns / 1e6;
+        // Fraction of the driving threads' wall time spent blocked on this lock
+        lock["wait_fraction"] = wait_ns / (wall * 1e9 * threads);
+        point.locks[name] = lock;
+    }
+
+    return point;
+}
+
+/*
+ * Least-squares fit of the Universal Scalability Law and Amdahl's law
+ */
+ScalingFit fitScaling(const std::vector<ScalingPoint>& points) {
+    ScalingFit fit;
+    double s_aa = 0.0, s_ab = 0.0, s_bb = 0.0, s_ay = 0.0, s_by = 0.0;
+    std::vector<double> ys;
+    for (const auto& p : points) {
+        if (p.threads <= 1 || p.speedup <= 0.0) {
+            continue;
+        }
+        double n = p.threads;
+        double a = n - 1.0;
+        double b = n * (n - 1.0);
+        double y = n / p.speedup - 1.0;
+        s_aa += a * a;
+        s_ab += a * b;
+        s_bb += b * b;
+        s_ay += a * y;
+        s_by += b * y;
+        ys.push_back(y);
+    }
+    if (ys.empty()) {
+        return fit;
+    }
+
+    fit.amdahl_sigma = std::max(0.0, s_ay / s_aa);
+
+    double det = s_aa * s_bb - s_ab * s_ab;
+    if (ys.size() >= 2 && std::abs(det) > 1e-12) {
+        fit.usl_sigma = (s_ay * s_bb - s_by * s_ab) / det;
+        fit.usl_kappa = (s_aa * s_by - s_ab * s_ay) / det;
+    } else {
+        fit.usl_sigma = fit.amdahl_sigma;
+        fit.usl_kappa = 0.0;
+    }
+    if (fit.usl_kappa > 0.0 && fit.usl_sigma < 1.0) {
+        fit.usl_peak_threads = std::sqrt((1.0 - fit.usl_sigma) / fit.usl_kappa);
+    }
+
+    double mean_y = 0.0;
+    for (double y : ys) {
+        mean_y += y;
+    }
+    mean_y /= ys.size();
+    double ss_res = 0.0, ss_tot = 0.0;
+    std::size_t i = 0;
+    for (const auto& p : points) {
+        if (p.threads <= 1 || p.speedup <= 0.0) {
+            continue;
+        }
+        double n = p.threads;
+        double predicted = fit.usl_sigma * (n - 1.0) + fit.usl_kappa * n * (n - 1.0);
+        ss_res += (ys[i] - predicted) * (ys[i] - predicted);
+        ss_tot += (ys[i] - mean_y) * (ys[i] - mean_y);
+        ++i;
+    }
+    fit.usl_r_squared = ss_tot > 0.0 ? 1.0 - ss_res / ss_tot : 1.0;
+    return fit;
+}
+
+std::vector<std::string> splitList(const std::string& value) {
+    std::vector<std::string> items;
+    std::stringstream ss(value);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+bool parseArgs(int argc, char* argv[], ScalingOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h" || i + 1 >= argc) {
+            std::cerr << "Usage: " << argv[0] << " [options]\n"
+                      << "  --threads 1,2,4,8        Thread counts (default powers of two to nproc)\n"
+                      << "  --workloads LIST         batch,continuous,fields (default all)\n"
+                      << "  --duration SEC           Measured seconds per point (default 1)\n"
+                      << "  --warmup SEC             Warm-up seconds per point (default 0.2)\n"
+                      << "  --bytes-per-mev N        Field memory scale (default 64)\n"
+                      << "  --field-energy MEV       Field size for the fields workload (default 10)\n"
+                      << "  --continuous-rate EPS    Generator target for continuous (default 100000)\n"
+                      << "  --json FILE              Write JSON curves\n"
+                      << "  --csv FILE               Write CSV curves" << std::endl;
+            return false;
+        }
+        std::string value = argv[++i];
+        if (arg == "--threads") {
+            options.threads.clear();
+            for (const auto& item : splitList(value)) {
+                options.threads.push_back(std::max(1, std::atoi(item.c_str())));
+            }
+        } else if (arg == "--workloads") {
+            options.workloads = splitList(value);
+        } else if (arg == "--duration") {
+            options.duration_seconds = std::atof(value.c_str());
+        } else if (arg == "--warmup") {
+            options.warmup_seconds = std::atof(value.c_str());
+        } else if (arg == "--bytes-per-mev") {
+            options.bytes_per_mev = std::atof(value.c_str());
+        } else if (arg == "--field-energy") {
+            options.field_energy_mev = std::atof(value.c_str());
+        } else if (arg == "--continuous-rate") {
+            options.continuous_rate = std::atof(value.c_str());
+        } else if (arg == "--json") {
+            options.json_path = value;
+        } else if (arg == "--csv") {
+            options.csv_path = value;
+        } else {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            return false;
+        }
+    }
+
+    for (const auto& workload : options.workloads) {
+        if (workload != "batch" && workload != "continuous" && workload != "fields") {
+            std::cerr << "Unknown workload: " << workload << std::endl;
+            return false;
+        }
+    }
+
+    if (options.threads.empty()) {
+        int max_threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        for (int n = 1; n < max_threads; n *= 2) {
+            options.threads.push_back(n);
+        }
+        options.threads.push_back(max_threads);
+    }
+    // We always need N=1 as the speedup reference
+    options.threads.push_back(1);
+    std::sort(options.threads.begin(), options.threads.end());
+    options.threads.erase(std::unique(options.threads.begin(), options.threads.end()),
+                          options.threads.end());
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    ScalingOptions options;
+    if (!parseArgs(argc, argv, options)) {
+        return 2;
+    }
+
+    g_energy_field_config.memory_per_mev = options.bytes_per_mev;
+
+    Json::Value report;
+    report["schema"] = "ternary-fission-scaling/1";
+    report["hardware_concurrency"] = std::thread::hardware_concurrency();
+    Json::Value config;
+    config["duration_seconds"] = options.duration_seconds;
+    config["warmup_seconds"] = options.warmup_seconds;
+    config["bytes_per_mev"] = options.bytes_per_mev;
+    config["field_energy_mev"] = options.field_energy_mev;
+    config["continuous_rate"] = options.continuous_rate;
+    report["config"] = config;
+
+    std::ostringstream csv;
+    csv << "workload,threads,ops_per_second,speedup,efficiency,cores_used,core_util_mean,core_util_max";
+    for (const auto& name : kLockNames) {
+        csv << "," << name << "_contended," << name << "_wait_ms," << name << "_wait_fraction";
+    }
+    csv << "\n";
+
+    std::cout << "\n=== Ternary Fission Thread Scaling ===" << std::endl;
+
+    for (const auto& workload : options.workloads) {
+        std::vector<ScalingPoint> points;
+        std::cout << "\n[" << workload << "]\n"
+                  << std::setw(8) << "threads" << std::setw(14) << "ops/s"
+                  << std::setw(10) << "speedup" << std::setw(8) << "eff"
+                  << std::setw(8) << "cores" << "  top lock wait" << std::endl;
+
+        for (int threads : options.threads) {
+            ScalingPoint point = runPoint(workload, threads, options);
+            double base = points.empty() ? point.ops_per_second : points.front().ops_per_second;
+            point.speedup = base > 0.0 ? point.ops_per_second / base : 0.0;
+            point.efficiency = point.speedup / threads;
+
+            std::string top_lock = "-";
+            double top_fraction = 0.0;
+            for (const auto& name : kLockNames) {
+                double fraction = point.locks[name]["wait_fraction"].asDouble();
+                if (fraction > top_fraction) {
+                    top_fraction = fraction;
+                    top_lock = name;
+                }
+            }
+
+            std::cout << std::setw(8) << threads << std::fixed << std::setprecision(0)
+                      << std::setw(14) << point.ops_per_second << std::setprecision(2)
+                      << std::setw(10) << point.speedup << std::setw(8) << point.efficiency
+                      << std::setw(8) << point.cores_used << "  " << top_lock;
+            if (top_fraction > 0.0) {
+                std::cout << " (" << std::setprecision(1) << top_fraction * 100.0 << "%)";
+            }
+            std::cout << std::endl;
+            points.push_back(point);
+        }
+
+        ScalingFit fit = fitScaling(points);
+        std::cout << std::setprecision(4) << "  Amdahl serial fraction: " << fit.amdahl_sigma
+                  << "  USL sigma: " << fit.usl_sigma << "  kappa: " << fit.usl_kappa;
+        if (fit.usl_peak_threads > 0.0) {
+            std::cout << std::setprecision(1) << "  peak at ~" << fit.usl_peak_threads << " threads";
+        }
+        std::cout << std::endl;
+
+        Json::Value curve;
+        Json::Value json_points(Json::arrayValue);
+        for (const auto& point : points) {
+            Json::Value jp;
+            jp["threads"] = point.threads;
+            jp["ops_per_second"] = point.ops_per_second;
+            jp["speedup"] = point.speedup;
+            jp["efficiency"] = point.efficiency;
+            jp["cores_used"] = point.cores_used;
+            Json::Value cores(Json::arrayValue);
+            double util_sum = 0.0;
+            double util_max = 0.0;
+            for (double u : point.core_utilization) {
+                cores.append(u);
+                util_sum += u;
+                util_max = std::max(util_max, u);
+            }
+            double util_mean = point.core_utilization.empty() ? 0.0 : util_sum / point.core_utilization.size();
+            jp["core_utilization"] = cores;
+            jp["core_utilization_mean"] = util_mean;
+            jp["core_utilization_max"] = util_max;
+            jp["locks"] = point.locks;
+            json_points.append(jp);
+
+            csv << workload << "," << point.threads << "," << point.ops_per_second << ","
+                << point.speedup << "," << point.efficiency << "," << point.cores_used << ","
+                << util_mean << "," << util_max;
+            for (const auto& name : kLockNames) {
+                csv << "," << point.locks[name]["contended"].asUInt64()
+                    << "," << point.locks[name]["wait_ms"].asDouble()
+                    << "," << point.locks[name]["wait_fraction"].asDouble();
+            }
+            csv << "\n";
+        }
+        curve["points"] = json_points;
+        Json::Value json_fit;
+        json_fit["amdahl_serial_fraction"] = fit.amdahl_sigma;
+        json_fit["usl_sigma"] = fit.usl_sigma;
+        json_fit["usl_kappa"] = fit.usl_kappa;
+        json_fit["usl_peak_threads"] = fit.usl_peak_threads;
+        json_fit["usl_r_squared"] = fit.usl_r_squared;
+        curve["fit"] = json_fit;
+        report["workloads"][workload] = curve;
+    }
+
+    if (!options.json_path.empty()) {
+        std::ofstream out(options.json_path);
+        Json::StreamWriterBuilder builder;
+        builder["indentation"] = "  ";
+        out << Json::writeString(builder, report) << std::endl;
+        std::cout << "\nJSON written to " << options.json_path << std::endl;
+    }
+    if (!options.csv_path.empty()) {
+        std::ofstream out(options.csv_path);
+        out << csv.str();
+        std::cout << "CSV written to " << options.csv_path << std::endl;
+    }
+    return 0;
+}
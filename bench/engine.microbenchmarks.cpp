@@ -0,0 +1,240 @@
+/*
+ * File: bench/engine.microbenchmarks.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Engine and Physics Utility Microbenchmarks
+ * Purpose: Measures ns/op, bytes/op and allocations/op for the simulation hot paths
+ * Reason: We need a repeatable way to tell whether a change made the engine faster or slower
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation covering generateFissionEvent, createEnergyField,
+ *               encryptMemoryPattern, applyConservationLaws, fissionEventToJSON
+ *               and calculateEntropy
+ * - 2026-10-17: Added sampler cases: scalar normal/uniform/Poisson draws, the per-call
+ *               std::normal_distribution they replaced, and bulk fills of 4096 values
+ * - 2026-10-17: Added direction sampling, generateRandomMomentum and a 256-event batch
+ * - 2026-10-17: Added fragment pair sampling from the engine's yield table
+ * - 2026-10-17: Added ternary Q-values from the nuclear mass table and from the formula
+ * - 2026-10-17: Added a 256-event batch mixing three registered parents
+ *
+ * Carry-over Context:
+ * - Built and run by `make bench`; `make bench-compare` checks against bench/baseline.json
+ * - malloc/calloc/realloc are interposed (glibc only) so allocations made by OpenSSL,
+ *   jsoncpp and operator new are all counted
+ * - Field memory is released inside the timed loop so runs do not grow RSS
+ */
+
+#include "bench.harness.h"
+
+#include "nuclear.masses.h"
+#include "physics.utilities.h"
+#include "random.samplers.h"
+#include "ternary.fission.simulation.engine.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#if defined(__GLIBC__)
+// We interpose the malloc family so every heap allocation in the process is counted
+extern "C" {
+void* __libc_malloc(std::size_t size) noexcept;
+void* __libc_calloc(std::size_t count, std::size_t size) noexcept;
+void* __libc_realloc(void* ptr, std::size_t size) noexcept;
+
+void* malloc(std::size_t size) noexcept {
+    TernaryFission::Bench::recordAllocation(size);
+    return __libc_malloc(size);
+}
+
+void* calloc(std::size_t count, std::size_t size) noexcept {
+    TernaryFission::Bench::recordAllocation(count * size);
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, std::size_t size) noexcept {
+    TernaryFission::Bench::recordAllocation(size);
+    return __libc_realloc(ptr, size);
+}
+}
+#endif
+
+using namespace TernaryFission;
+using namespace TernaryFission::Bench;
+
+int main(int argc, char* argv[]) {
+    BenchmarkOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        return 2;
+    }
+
+    // We run a single worker so the engine's background threads stay idle
+    TernaryFissionSimulationEngine engine(235.0, 6.5, 1);
+    TernaryFissionEvent sample_event = engine.generateFissionEvent(235.0, 6.5);
+
+    std::vector<unsigned char> pattern_buffer(64 * 1024);
+    std::vector<double> sample_buffer(4096);
+    std::vector<int> count_buffer(4096);
+    std::vector<double> direction_y(4096);
+    std::vector<double> direction_z(4096);
+    std::vector<TernaryFissionEvent> event_batch(256);
+    std::shared_ptr<const FragmentYields> fragment_yields = engine.getFragmentYields();
+    std::shared_ptr<const NuclideRegistry> nuclides = engine.getNuclideRegistry();
+    const std::size_t mixed_order[] = {nuclides->indexOf(*nuclides->find("U-235")),
+                                       nuclides->indexOf(*nuclides->find("Pu-239")),
+                                       nuclides->indexOf(*nuclides->find("Cf-252"))};
+    std::vector<std::size_t> mixed_parents(event_batch.size());
+    for (std::size_t i = 0; i < mixed_parents.size(); ++i) {
+        mixed_parents[i] = mixed_order[i % 3];
+    }
+
+    std::vector<BenchmarkCase> cases = {
+        {"engine.generate_fission_event", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i) {
+                TernaryFissionEvent event = engine.generateFissionEvent(235.0, 6.5);
+                doNotOptimize(event.q_value);
+            }
+        }},
+        {"engine.generate_fission_events_256", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i) {
+                engine.generateFissionEvents(event_batch.data(), event_batch.size(), 235.0, 6.5);
+                doNotOptimize(event_batch[0].heavy_fragment.momentum.x);
+            }
+        }},
+        {"engine.generate_fission_events_256_mixed", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i) {
+                engine.generateFissionEvents(event_batch.data(), mixed_parents.data(), event_batch.size(), *nuclides,
+                                             6.5);
+                doNotOptimize(event_batch[0].heavy_fragment.momentum.x);
+            }
+        }},
+        {"utilities.create_energy_field_1mev", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i) {
+                EnergyField field = createEnergyField(1.0);
+                doNotOptimize(field.memory_ptr);
+                std::free(field.memory_ptr);
+            }
+        }},
+        {"utilities.encrypt_memory_pattern_64kib", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i) {
+                encryptMemoryPattern(pattern_buffer.data(), pattern_buffer.size(), i + 1);
+                doNotOptimize(pattern_buffer[0]);
+            }
+        }},
+        {"utilities.apply_conservation_laws", [&](std::uint64_t n) {
+            TernaryFissionEvent event = sample_event;
+            for (std::uint64_t i = 0; i < n; ++i) {
+                applyConservationLaws(event);
+                doNotOptimize(event.light_fragment.momentum.x);
+            }
+        }},
+        {"utilities.generate_random_momentum", [&](std::uint64_t n) {
+            FissionFragment fragment = sample_event.light_fragment;
+            for (std::uint64_t i = 0; i < n; ++i) {
+                generateRandomMomentum(fragment);
+                doNotOptimize(fragment.momentum.x);
+            }
+        }},
+        {"utilities.fission_event_to_json", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i) {
+                std::string json = fissionEventToJSON(sample_event);
+                doNotOptimize(json.size());
+            }
+        }},
+        {"utilities.calculate_entropy", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i) {
+                double entropy = calculateEntropy(static_cast<std::size_t>(1000000 + (i & 1023)),
+                                                  1000000000ULL + i);
+                doNotOptimize(entropy);
+            }
+        }},
+        {"samplers.std_normal_distribution_per_call", [&](std::uint64_t n) {
+            std::mt19937_64& rng = getThreadLocalRNG();
+            for (std::uint64_t i = 0; i < n; ++i) {
+                std::normal_distribution<double> dist(1.4, 0.15);
+                doNotOptimize(dist(rng));
+            }
+        }},
+        {"samplers.normal_random", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i) {
+                doNotOptimize(normalRandom(1.4, 0.15));
+            }
+        }},
+        {"samplers.uniform_random", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i) {
+                doNotOptimize(uniformRandom(0.0, 2.0 * M_PI));
+            }
+        }},
+        {"samplers.poisson_random_3", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i) {
+                doNotOptimize(poissonRandom(3.0));
+            }
+        }},
+        {"samplers.fill_normal_4096", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i) {
+                Sampling::fillNormal(sample_buffer.data(), sample_buffer.size(), 1.4, 0.15);
+                doNotOptimize(sample_buffer[0]);
+            }
+        }},
+        {"samplers.fill_uniform_4096", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i) {
+                Sampling::fillUniform(sample_buffer.data(), sample_buffer.size());
+                doNotOptimize(sample_buffer[0]);
+            }
+        }},
+        {"samplers.fill_poisson_4096_lambda_3", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i) {
+                Sampling::fillPoisson(count_buffer.data(), count_buffer.size(), 3.0);
+                doNotOptimize(count_buffer[0]);
+            }
+        }},
+        {"samplers.fragment_pair", [&](std::uint64_t n) {
+            Sampling::Xoshiro256& rng = Sampling::threadSampler().scalar;
+            for (std::uint64_t i = 0; i < n; ++i) {
+                doNotOptimize(fragment_yields->sample(rng()).light_mass_number);
+            }
+        }},
+        {"masses.ternary_q_value", [&](std::uint64_t n) {
+            Sampling::Xoshiro256& rng = Sampling::threadSampler().scalar;
+            const NuclearMassTable& masses = NuclearMassTable::instance();
+            const NuclearMass& parent = masses.at(92, 235);
+            const double alpha = masses.at(2, 4).binding_energy;
+            for (std::uint64_t i = 0; i < n; ++i) {
+                const FragmentPair& pair = fragment_yields->sample(rng());
+                doNotOptimize(masses.at(pair.light_atomic_number, pair.light_mass_number).binding_energy +
+                              masses.at(pair.heavy_atomic_number, pair.heavy_mass_number).binding_energy +
+                              alpha - parent.binding_energy);
+            }
+        }},
+        {"masses.ternary_q_value_formula", [&](std::uint64_t n) {
+            Sampling::Xoshiro256& rng = Sampling::threadSampler().scalar;
+            const double parent = NuclearMassTable::semiEmpiricalBindingEnergy(92, 235);
+            for (std::uint64_t i = 0; i < n; ++i) {
+                const FragmentPair& pair = fragment_yields->sample(rng());
+                doNotOptimize(
+                    NuclearMassTable::semiEmpiricalBindingEnergy(pair.light_atomic_number, pair.light_mass_number) +
+                    NuclearMassTable::semiEmpiricalBindingEnergy(pair.heavy_atomic_number, pair.heavy_mass_number) +
+                    28.295673 - parent);
+            }
+        }},
+        {"samplers.direction", [&](std::uint64_t n) {
+            Sampling::Xoshiro256& rng = Sampling::threadSampler().scalar;
+            double x, y, z;
+            for (std::uint64_t i = 0; i < n; ++i) {
+                Sampling::direction(rng, x, y, z);
+                doNotOptimize(x + y + z);
+            }
+        }},
+        {"samplers.fill_directions_4096", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i) {
+                Sampling::fillDirections(sample_buffer.data(), direction_y.data(), direction_z.data(),
+                                         sample_buffer.size());
+                doNotOptimize(direction_z[0]);
+            }
+        }},
+    };
+
+    std::cout << "\n=== Ternary Fission Microbenchmarks ===" << std::endl;
+    return runSuite(cases, options);
+}
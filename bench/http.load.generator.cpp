@@ -0,0 +1,544 @@
+/*
+ * File: bench/http.load.generator.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: HTTP Load Generator for the Ternary Fission REST API
+ * Purpose: Drives physics, energy-field CRUD and status endpoints at controlled rates
+ * Reason: We need per-route latency percentiles under load to size deployments
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation with open-loop (coordinated-omission-correct) and
+ *               closed-loop modes, weighted route mixes and JSON output
+ *
+ * Carry-over Context:
+ * - Open loop: request i is due at start + i/rate; latency is measured from the due
+ *   time, so a stalled server inflates the tail instead of silently slowing the load
+ * - Closed loop: each connection issues its next request as soon as the last one
+ *   completes (plus optional think time); latency equals service time
+ * - Each worker owns one keep-alive connection and its own histograms; results are
+ *   merged after the run so recording never contends
+ * - Created energy fields are tracked in a shared pool for get/update/delete routes;
+ *   a 404 there means another connection deleted the field first and is reported
+ *   as not_found rather than as an error
+ * - Exit status: 0 clean run, 1 errors observed, 2 usage or connection failure
+ */
+
+#include "latency.histogram.h"
+
+#include <httplib.h>
+#include <json/json.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace TernaryFission;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+/*
+ * Routes the generator knows how to drive
+ */
+enum class Route {
+    Fission,
+    Status,
+    FieldsList,
+    FieldsCreate,
+    FieldsGet,
+    FieldsUpdate,
+    FieldsDelete,
+    Count
+};
+
+const char* routeName(Route route) {
+    switch (route) {
+    case Route::Fission: return "fission";
+    case Route::Status: return "status";
+    case Route::FieldsList: return "fields-list";
+    case Route::FieldsCreate: return "fields-create";
+    case Route::FieldsGet: return "fields-get";
+    case Route::FieldsUpdate: return "fields-update";
+    case Route::FieldsDelete: return "fields-delete";
+    default: return "unknown";
+    }
+}
+
+constexpr std::size_t kRouteCount = static_cast<std::size_t>(Route::Count);
+
+struct LoadOptions {
+    std::string host = "127.0.0.1";
+    int port = 8333;
+    std::string mode = "open";          // open | closed
+    double rate = 50.0;                 // requests/second (open loop)
+    int connections = 4;
+    double duration_seconds = 10.0;
+    double warmup_seconds = 1.0;
+    double think_time_ms = 0.0;         // closed loop only
+    double timeout_seconds = 30.0;
+    std::string mix = "fission=4,status=1,fields-list=1,fields-create=2,fields-get=2,fields-update=1,fields-delete=1";
+    std::string output_path;
+    std::uint64_t seed = 0;
+};
+
+/*
+ * Per-worker, per-route statistics
+ */
+struct RouteStats {
+    LatencyHistogram latency;           // from intended start (CO-corrected)
+    LatencyHistogram service;           // from actual send
+    std::atomic<std::uint64_t> requests{0};
+    std::atomic<std::uint64_t> errors{0};
+    std::atomic<std::uint64_t> not_found{0};   // field deleted by another connection
+    std::atomic<std::uint64_t> transport_errors{0};
+};
+
+struct WorkerStats {
+    std::array<RouteStats, kRouteCount> routes;
+    std::atomic<std::uint64_t> late_starts{0};
+};
+
+/*
+ * Shared pool of energy field IDs created during the run
+ */
+class FieldPool {
+public:
+    void add(const std::string& id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ids_.push_back(id);
+    }
+
+    bool pick(std::mt19937_64& rng, std::string& id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (ids_.empty()) {
+            return false;
+        }
+        id = ids_[rng() % ids_.size()];
+        return true;
+    }
+
+    bool take(std::mt19937_64& rng, std::string& id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (ids_.empty()) {
+            return false;
+        }
+        std::size_t index = rng() % ids_.size();
+        id = ids_[index];
+        ids_[index] = ids_.back();
+        ids_.pop_back();
+        return true;
+    }
+
+private:
+    std::mutex mutex_;
+    std::vector<std::string> ids_;
+};
+
+/*
+ * Parse "name=weight,name=weight" into cumulative weights
+ */
+bool parseMix(const std::string& spec, std::array<double, kRouteCount>& weights) {
+    weights.fill(0.0);
+    std::stringstream ss(spec);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        auto eq = item.find('=');
+        std::string name = item.substr(0, eq);
+        double weight = eq == std::string::npos ? 1.0 : std::atof(item.c_str() + eq + 1);
+        bool found = false;
+        for (std::size_t r = 0; r < kRouteCount; ++r) {
+            if (name == routeName(static_cast<Route>(r))) {
+                weights[r] = std::max(0.0, weight);
+                found = true;
+            }
+        }
+        if (!found) {
+            std::cerr << "Unknown route in mix: " << name << std::endl;
+            return false;
+        }
+    }
+    double total = 0.0;
+    for (double w : weights) {
+        total += w;
+    }
+    return total > 0.0;
+}
+
+Route pickRoute(const std::array<double, kRouteCount>& weights, std::mt19937_64& rng) {
+    double total = 0.0;
+    for (double w : weights) {
+        total += w;
+    }
+    double x = std::uniform_real_distribution<double>(0.0, total)(rng);
+    for (std::size_t r = 0; r < kRouteCount; ++r) {
+        if (x < weights[r]) {
+            return static_cast<Route>(r);
+        }
+        x -= weights[r];
+    }
+    return Route::Status;
+}
+
+std::string fieldBody(std::mt19937_64& rng) {
+    std::uniform_real_distribution<double> energy(10.0, 500.0);
+    std::ostringstream body;
+    body << "{\"energy_level_mev\":" << energy(rng)
+         << ",\"stability_factor\":0.9,\"dissipation_rate\":0.01}";
+    return body.str();
+}
+
+/*
+ * Issue one request for the chosen route
+ * We return the HTTP status (0 on transport error) and fall back to a create
+ * when a route needs an existing field and the pool is empty
+ */
+int issueRequest(httplib::Client& client, Route& route, FieldPool& pool, std::mt19937_64& rng) {
+    static const std::string kJson = "application/json";
+    std::string id;
+
+    if ((route == Route::FieldsGet || route == Route::FieldsUpdate) && !pool.pick(rng, id)) {
+        route = Route::FieldsCreate;
+    }
+    if (route == Route::FieldsDelete && !pool.take(rng, id)) {
+        route = Route::FieldsCreate;
+    }
+
+    httplib::Result result;
+    switch (route) {
+    case Route::Fission: {
+        std::uniform_real_distribution<double> excitation(5.0, 8.0);
+        std::ostringstream body;
+        body << "{\"parent_mass\":235.0,\"excitation_energy\":" << excitation(rng) << "}";
+        result = client.Post("/api/v1/physics/fission", body.str(), kJson);
+        break;
+    }
+    case Route::Status:
+        result = client.Get("/api/v1/status");
+        break;
+    case Route::FieldsList:
+        result = client.Get("/api/v1/energy-fields");
+        break;
+    case Route::FieldsCreate:
+        result = client.Post("/api/v1/energy-fields", fieldBody(rng), kJson);
+        if (result && result->status == 201) {
+            Json::Value json;
+            Json::CharReaderBuilder builder;
+            std::string errors;
+            std::istringstream in(result->body);
+            if (Json::parseFromStream(builder, in, &json, &errors) && json.isMember("field_id")) {
+                pool.add(json["field_id"].asString());
+            }
+        }
+        break;
+    case Route::FieldsGet:
+        result = client.Get("/api/v1/energy-fields/" + id);
+        break;
+    case Route::FieldsUpdate:
+        result = client.Put("/api/v1/energy-fields/" + id, "{\"dissipation_rate\":0.02}", kJson);
+        break;
+    case Route::FieldsDelete:
+        result = client.Delete("/api/v1/energy-fields/" + id);
+        break;
+    default:
+        break;
+    }
+
+    return result ? result->status : 0;
+}
+
+void record(RouteStats& stats, Route route, int status, Clock::time_point intended,
+            Clock::time_point sent, Clock::time_point done) {
+    stats.requests.fetch_add(1, std::memory_order_relaxed);
+    bool by_id = route == Route::FieldsGet || route == Route::FieldsUpdate || route == Route::FieldsDelete;
+    if (status == 0) {
+        stats.transport_errors.fetch_add(1, std::memory_order_relaxed);
+    } else if (status == 404 && by_id) {
+        stats.not_found.fetch_add(1, std::memory_order_relaxed);
+    } else if (status >= 400) {
+        stats.errors.fetch_add(1, std::memory_order_relaxed);
+    }
+    stats.latency.record(static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(done - intended).count()));
+    stats.service.record(static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(done - sent).count()));
+}
+
+bool parseArgs(int argc, char* argv[], LoadOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            return false;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return false;
+        }
+        std::string value = argv[++i];
+        if (arg == "--host") options.host = value;
+        else if (arg == "--port") options.port = std::atoi(value.c_str());
+        else if (arg == "--mode") options.mode = value;
+        else if (arg == "--rate") options.rate = std::atof(value.c_str());
+        else if (arg == "--connections") options.connections = std::max(1, std::atoi(value.c_str()));
+        else if (arg == "--duration") options.duration_seconds = std::atof(value.c_str());
+        else if (arg == "--warmup") options.warmup_seconds = std::atof(value.c_str());
+        else if (arg == "--think-time-ms") options.think_time_ms = std::atof(value.c_str());
+        else if (arg == "--timeout") options.timeout_seconds = std::atof(value.c_str());
+        else if (arg == "--mix") options.mix = value;
+        else if (arg == "--output") options.output_path = value;
+        else if (arg == "--seed") options.seed = std::strtoull(value.c_str(), nullptr, 10);
+        else {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            return false;
+        }
+    }
+    if (options.mode != "open" && options.mode != "closed") {
+        std::cerr << "--mode must be 'open' or 'closed'" << std::endl;
+        return false;
+    }
+    if (options.mode == "open" && options.rate <= 0.0) {
+        std::cerr << "--rate must be positive in open-loop mode" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " [options]\n"
+              << "  --host HOST            Target host (default 127.0.0.1)\n"
+              << "  --port PORT            Target port (default 8333)\n"
+              << "  --mode open|closed     Arrival model (default open)\n"
+              << "  --rate RPS             Open-loop arrival rate (default 50)\n"
+              << "  --connections N        Concurrent connections (default 4)\n"
+              << "  --duration SEC         Measured duration (default 10)\n"
+              << "  --warmup SEC           Unrecorded warm-up (default 1)\n"
+              << "  --think-time-ms MS     Closed-loop think time (default 0)\n"
+              << "  --mix SPEC             Weighted routes, e.g. fission=4,status=1\n"
+              << "                         routes: fission status fields-list fields-create\n"
+              << "                                 fields-get fields-update fields-delete\n"
+              << "  --output FILE          Write JSON report\n"
+              << "  --seed N               RNG seed for reproducible mixes" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    LoadOptions options;
+    if (!parseArgs(argc, argv, options)) {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    std::array<double, kRouteCount> weights;
+    if (!parseMix(options.mix, weights)) {
+        std::cerr << "Invalid --mix specification" << std::endl;
+        return 2;
+    }
+
+    {
+        httplib::Client probe(options.host, options.port);
+        probe.set_connection_timeout(2, 0);
+        if (!probe.Get("/api/v1/health")) {
+            std::cerr << "Cannot reach http://" << options.host << ":" << options.port
+                      << "/api/v1/health" << std::endl;
+            return 2;
+        }
+    }
+
+    FieldPool pool;
+    std::vector<std::unique_ptr<WorkerStats>> stats;
+    for (int i = 0; i < options.connections; ++i) {
+        stats.push_back(std::make_unique<WorkerStats>());
+    }
+
+    const bool open_loop = options.mode == "open";
+    const auto interval = std::chrono::duration<double>(open_loop ? 1.0 / options.rate : 0.0);
+    const auto start = Clock::now() + std::chrono::milliseconds(50);
+    const auto measure_from = start + std::chrono::duration_cast<Clock::duration>(
+                                          std::chrono::duration<double>(options.warmup_seconds));
+    const auto stop_at = measure_from + std::chrono::duration_cast<Clock::duration>(
+                                            std::chrono::duration<double>(options.duration_seconds));
+    std::atomic<std::uint64_t> next_sequence{0};
+
+    std::cout << "Load: " << options.mode << "-loop, "
+              << (open_loop ? std::to_string(options.rate) + " req/s, " : std::string())
+              << options.connections << " connections, " << options.duration_seconds
+              << "s (+" << options.warmup_seconds << "s warm-up) against "
+              << options.host << ":" << options.port << std::endl;
+
+    std::vector<std::thread> workers;
+    for (int w = 0; w < options.connections; ++w) {
+        workers.emplace_back([&, w]() {
+            httplib::Client client(options.host, options.port);
+            client.set_keep_alive(true);
+            auto timeout_sec = static_cast<time_t>(options.timeout_seconds);
+            client.set_read_timeout(timeout_sec, 0);
+            client.set_write_timeout(timeout_sec, 0);
+
+            std::mt19937_64 rng(options.seed != 0 ? options.seed + static_cast<std::uint64_t>(w)
+                                                  : std::random_device{}());
+            WorkerStats& mine = *stats[static_cast<std::size_t>(w)];
+            std::this_thread::sleep_until(start);
+
+            while (true) {
+                Clock::time_point intended;
+                if (open_loop) {
+                    std::uint64_t seq = next_sequence.fetch_add(1, std::memory_order_relaxed);
+                    intended = start + std::chrono::duration_cast<Clock::duration>(interval * static_cast<double>(seq));
+                    if (intended >= stop_at) {
+                        break;
+                    }
+                    if (Clock::now() < intended) {
+                        std::this_thread::sleep_until(intended);
+                    } else if (intended >= measure_from) {
+                        mine.late_starts.fetch_add(1, std::memory_order_relaxed);
+                    }
+                } else {
+                    intended = Clock::now();
+                    if (intended >= stop_at) {
+                        break;
+                    }
+                }
+
+                Route route = pickRoute(weights, rng);
+                auto sent = Clock::now();
+                int status = issueRequest(client, route, pool, rng);
+                auto done = Clock::now();
+
+                if (intended >= measure_from) {
+                    record(mine.routes[static_cast<std::size_t>(route)], route, status, intended, sent, done);
+                }
+
+                if (!open_loop && options.think_time_ms > 0.0) {
+                    std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(options.think_time_ms));
+                }
+            }
+        });
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    double measured_seconds = options.duration_seconds;
+
+    // We merge per-worker statistics into the report
+    Json::Value report;
+    report["schema"] = "ternary-fission-loadgen/1";
+    Json::Value config;
+    config["target"] = options.host + ":" + std::to_string(options.port);
+    config["mode"] = options.mode;
+    config["rate"] = open_loop ? options.rate : 0.0;
+    config["connections"] = options.connections;
+    config["duration_seconds"] = options.duration_seconds;
+    config["warmup_seconds"] = options.warmup_seconds;
+    config["think_time_ms"] = options.think_time_ms;
+    config["mix"] = options.mix;
+    report["config"] = config;
+
+    auto now = std::chrono::system_clock::now();
+    auto time_t = std::chrono::system_clock::to_time_t(now);
+    std::stringstream timestamp_ss;
+    timestamp_ss << std::put_time(std::gmtime(&time_t), "%Y-%m-%dT%H:%M:%SZ");
+    report["timestamp"] = timestamp_ss.str();
+
+    Json::Value routes(Json::objectValue);
+    LatencyHistogram::Snapshot all_latency;
+    std::uint64_t total_requests = 0;
+    std::uint64_t total_errors = 0;
+    std::uint64_t late_starts = 0;
+
+    std::cout << "\n" << std::left << std::setw(15) << "route"
+              << std::right << std::setw(9) << "reqs" << std::setw(8) << "errs"
+              << std::setw(11) << "p50 ms" << std::setw(11) << "p90 ms"
+              << std::setw(11) << "p99 ms" << std::setw(11) << "p99.9 ms"
+              << std::setw(11) << "max ms" << std::endl;
+
+    for (std::size_t r = 0; r < kRouteCount; ++r) {
+        LatencyHistogram::Snapshot latency;
+        LatencyHistogram::Snapshot service;
+        std::uint64_t requests = 0;
+        std::uint64_t errors = 0;
+        std::uint64_t not_found = 0;
+        std::uint64_t transport_errors = 0;
+        for (const auto& worker : stats) {
+            const RouteStats& rs = worker->routes[r];
+            latency.merge(rs.latency.snapshot());
+            service.merge(rs.service.snapshot());
+            requests += rs.requests.load();
+            errors += rs.errors.load();
+            not_found += rs.not_found.load();
+            transport_errors += rs.transport_errors.load();
+        }
+        if (requests == 0) {
+            continue;
+        }
+
+        all_latency.merge(latency);
+        total_requests += requests;
+        total_errors += errors + transport_errors;
+
+        Json::Value route;
+        route["requests"] = static_cast<Json::UInt64>(requests);
+        route["http_errors"] = static_cast<Json::UInt64>(errors);
+        route["not_found"] = static_cast<Json::UInt64>(not_found);
+        route["transport_errors"] = static_cast<Json::UInt64>(transport_errors);
+        route["throughput_rps"] = requests / measured_seconds;
+        route["latency_ms"] = latency.toJson(1e6);
+        route["service_time_ms"] = service.toJson(1e6);
+        routes[routeName(static_cast<Route>(r))] = route;
+
+        std::cout << std::left << std::setw(15) << routeName(static_cast<Route>(r))
+                  << std::right << std::setw(9) << requests
+                  << std::setw(8) << (errors + transport_errors) << std::fixed << std::setprecision(2)
+                  << std::setw(11) << latency.percentile(0.50) / 1e6
+                  << std::setw(11) << latency.percentile(0.90) / 1e6
+                  << std::setw(11) << latency.percentile(0.99) / 1e6
+                  << std::setw(11) << latency.percentile(0.999) / 1e6
+                  << std::setw(11) << latency.max / 1e6 << std::endl;
+    }
+
+    for (const auto& worker : stats) {
+        late_starts += worker->late_starts.load();
+    }
+
+    Json::Value totals;
+    totals["requests"] = static_cast<Json::UInt64>(total_requests);
+    totals["errors"] = static_cast<Json::UInt64>(total_errors);
+    totals["throughput_rps"] = total_requests / measured_seconds;
+    totals["late_starts"] = static_cast<Json::UInt64>(late_starts);
+    totals["latency_ms"] = all_latency.toJson(1e6);
+    report["totals"] = totals;
+    report["routes"] = routes;
+
+    std::cout << "\nTotal: " << total_requests << " requests, " << total_errors << " errors, "
+              << std::setprecision(1) << total_requests / measured_seconds << " req/s";
+    if (open_loop && late_starts > 0) {
+        std::cout << " (" << late_starts << " requests started late: generator or server saturated)";
+    }
+    std::cout << std::endl;
+
+    if (!options.output_path.empty()) {
+        std::ofstream out(options.output_path);
+        if (!out) {
+            std::cerr << "Error: cannot write " << options.output_path << std::endl;
+            return 2;
+        }
+        Json::StreamWriterBuilder builder;
+        builder["indentation"] = "  ";
+        out << Json::writeString(builder, report) << std::endl;
+        std::cout << "Report written to " << options.output_path << std::endl;
+    }
+
+    return total_errors > 0 ? 1 : 0;
+}
@@ -0,0 +1,125 @@
+/*
+ * File: include/allocation.tracker.h
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Allocation Tracker - Per-Thread and Per-Scope Heap Accounting
+ * Purpose: Counts operator new/delete calls and bytes per thread and attributes them
+ *          to the active scope (HTTP route, engine phase, field step)
+ * Reason: We need to quantify the allocations each event and request costs and to
+ *         assert that steady-state hot paths do not allocate at all
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ *
+ * Carry-over Context:
+ * - Opt-in: the global operator new/delete replacements and TF_ALLOC_SCOPE exist only
+ *   when TERNARY_ALLOC_TRACKING is defined (make ALLOC_TRACKING=1); otherwise the
+ *   macro expands to nothing and the counters stay zero
+ * - Bytes are the allocator's usable size, so frees balance allocations exactly
+ * - Scopes nest and are exclusive: an allocation counts only against the innermost
+ *   scope. A free counts against the scope active on the freeing thread
+ * - Scope names must be string literals or otherwise outlive the process
+ */
+
+#ifndef TERNARY_FISSION_ALLOCATION_TRACKER_H
+#define TERNARY_FISSION_ALLOCATION_TRACKER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <json/json.h>
+
+namespace TernaryFission {
+namespace Alloc {
+
+constexpr std::size_t kMaxAllocationScopes = 128;
+
+#ifdef TERNARY_ALLOC_TRACKING
+constexpr bool kTrackingCompiledIn = true;
+#else
+constexpr bool kTrackingCompiledIn = false;
+#endif
+
+/*
+ * Running totals for the calling thread
+ */
+struct ThreadCounters {
+    std::uint64_t allocations = 0;
+    std::uint64_t frees = 0;
+    std::uint64_t bytes_allocated = 0;
+    std::uint64_t bytes_freed = 0;
+
+    ThreadCounters operator-(const ThreadCounters& start) const {
+        ThreadCounters delta;
+        delta.allocations = allocations - start.allocations;
+        delta.frees = frees - start.frees;
+        delta.bytes_allocated = bytes_allocated - start.bytes_allocated;
+        delta.bytes_freed = bytes_freed - start.bytes_freed;
+        return delta;
+    }
+};
+
+/*
+ * Totals attributed to one named scope across all threads
+ */
+struct alignas(64) ScopeStats {
+    const char* name = nullptr;
+    std::atomic<std::uint64_t> allocations{0};
+    std::atomic<std::uint64_t> frees{0};
+    std::atomic<std::uint64_t> bytes_allocated{0};
+    std::atomic<std::uint64_t> bytes_freed{0};
+};
+
+/*
+ * Snapshot of the calling thread's counters
+ */
+ThreadCounters threadCounters();
+
+/*
+ * Look up (or register) the stats slot for `name`; scopes past
+ * kMaxAllocationScopes share an "other" slot
+ */
+ScopeStats& scopeStats(const char* name);
+
+/*
+ * All scopes plus totals as JSON; "enabled" reports whether hooks are compiled in
+ */
+Json::Value allocationsToJson();
+
+/*
+ * Zero every scope's counters (per-thread counters keep running)
+ */
+void resetAllocations();
+
+/*
+ * RAII attribution of the calling thread's allocations to one scope
+ */
+class Scope {
+public:
+    explicit Scope(ScopeStats& stats);
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    ScopeStats* previous_;
+};
+
+} // namespace Alloc
+} // namespace TernaryFission
+
+#ifdef TERNARY_ALLOC_TRACKING
+#define TF_ALLOC_CONCAT_INNER(a, b) a##b
+#define TF_ALLOC_CONCAT(a, b) TF_ALLOC_CONCAT_INNER(a, b)
+#define TF_ALLOC_SCOPE_AT(name, id) \
+    static ::TernaryFission::Alloc::ScopeStats& TF_ALLOC_CONCAT(tf_alloc_stats_, id) = \
+        ::TernaryFission::Alloc::scopeStats(name); \
+    ::TernaryFission::Alloc::Scope TF_ALLOC_CONCAT(tf_alloc_scope_, id)(TF_ALLOC_CONCAT(tf_alloc_stats_, id))
+#define TF_ALLOC_SCOPE(name) TF_ALLOC_SCOPE_AT(name, __COUNTER__)
+#else
+#define TF_ALLOC_SCOPE(name) static_cast<void>(0)
+#endif
+
+#endif // TERNARY_FISSION_ALLOCATION_TRACKER_H
@@ -14,6 +14,14 @@
  * options for HTTP server binding Integrated physics parameter validation with
  * theoretical constraints Added platform-specific path handling for certificate
  * management
+ * 2026-10-17: Added slow_request_threshold_ms to LoggingConfiguration
+ * 2026-10-17: Added flight recorder settings to LoggingConfiguration
+ * 2026-10-17: Added memory governor settings to PhysicsConfiguration
+ * 2026-10-17: Added virtual_energy_fields to PhysicsConfiguration
+ * 2026-10-17: Added field fill pool settings to PhysicsConfiguration
+ * 2026-10-17: Added cpu_usage_limit and dissipation slice settings to PhysicsConfiguration
+ * 2026-10-17: Added CPU burn executor settings to PhysicsConfiguration
+ * 2026-10-17: Added fragment yield settings to PhysicsConfiguration
  *
  * Carry-over Context:
  * - This class supports the distributed daemon architecture outlined in ARCH.md
@@ -29,6 +37,7 @@
 #define CONFIG_TERNARY_FISSION_SERVER_H
 
 #include <chrono>
+#include <cstdint>
 #include <fstream>
 #include <map>
 #include <memory>
@@ -121,6 +130,26 @@ struct PhysicsConfiguration {
   bool enable_conservation_checks = true; // Enable conservation verification
   double events_per_second = 5.0;         // Default simulation rate
   int max_events_per_request = 100000;    // Maximum events in single request
+  std::uint64_t max_memory_usage = 8589934592ULL; // Field memory cap in bytes (0 = none)
+  double memory_usage_limit = 75.0;       // Field memory cap, % of usable memory (0 = none)
+  std::string memory_governor_policy = "reject"; // reject|shrink|evict_lowest_energy|evict_oldest
+  double memory_high_watermark = 0.90;    // Background eviction starts above this share of the cap
+  double memory_low_watermark = 0.75;     // Background eviction stops below this share of the cap
+  bool virtual_energy_fields = false;     // Regenerate field bytes on read instead of storing them
+  int field_fill_threads = 2;             // Async field fill threads (0 = fill on the event path)
+  std::uint64_t field_fill_max_in_flight_bytes = 1073741824ULL; // Fill backlog before events wait
+  double cpu_usage_limit = 80.0;          // Dissipation CPU cap, % of the machine (0 = none)
+  std::uint64_t dissipation_slice_bytes = 2097152ULL;     // Field bytes per dissipation slice
+  std::uint64_t dissipation_bytes_per_tick = 67108864ULL; // Dissipation bytes per 10 ms tick
+  int cpu_burn_threads = 0;               // Threads burning field CPU budgets (0 = off)
+  std::string cpu_burn_policy = "energy_weighted"; // energy_weighted|fair_share
+  double cpu_burn_limit = 50.0;           // CPU burn cap, % of the machine (0 = none)
+  double light_fragment_mean = 95.0;      // Light fragment mass hump (u)
+  double light_fragment_sigma = 5.0;
+  double heavy_fragment_mean = 140.0;     // Heavy fragment mass hump (u)
+  double heavy_fragment_sigma = 8.0;
+  double fragment_charge_sigma = 0.56;    // Charge width at fixed fragment mass
+  std::string fragment_yield_file;        // Tabulated "A Z yield" lines; empty uses the humps
 };
 
 /**
@@ -140,6 +169,9 @@ struct LoggingConfiguration {
   bool verbose_output = false;        // Enable verbose logging output
   std::string log_timestamp_format =
       "%Y-%m-%d %H:%M:%S"; // Log timestamp format
+  int slow_request_threshold_ms = 500; // Log phase breakdown above this (0 = off)
+  bool flight_recorder_enabled = true; // Keep the last 60 s of telemetry in memory
+  std::string flight_recorder_directory = "logs"; // Where flight dumps are written
 };
 
 /**
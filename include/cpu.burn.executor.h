@@ -0,0 +1,166 @@
+/*
+ * File: include/cpu.burn.executor.h
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: CPU Burn Executor - Field CPU Budgets as Real Computation
+ * Purpose: Spends each energy field's nominal CPU budget (energy_mev * cpu_cycles_per_mev)
+ *          as encryption rounds on a bounded, low-priority thread pool, scheduled fair-share
+ *          or weighted by energy, and accounts measured cycles against the budget
+ * Reason: ENERGY_TO_CPU_CYCLES was only a number in the field JSON; nothing consumed it
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ * - 2026-10-17: clear() cancels every pending budget for an engine reset
+ *
+ * Carry-over Context:
+ * - A field's budget is split into at most MAX_ENCRYPTION_ROUNDS work units; a unit runs
+ *   AES-256-CTR over a scratch block until its cycle target is met, and the scheduler
+ *   picks the next field after every unit, so preemption happens at unit boundaries
+ * - Scheduling is stride-style virtual time: a field's pass advances by measured cycles
+ *   divided by its weight (1 for fair share, energy_mev for energy weighting) and the
+ *   lowest pass runs next; new fields start at the current virtual time
+ * - The Account callback charges each unit to the field; returning false means the field
+ *   is gone and its budget is dropped
+ * - Workers run at idle priority and sleep to keep the pool within
+ *   cpu_usage_limit_percent of the machine, so HTTP threads always win the CPU
+ */
+
+#ifndef TERNARY_FISSION_CPU_BURN_EXECUTOR_H
+#define TERNARY_FISSION_CPU_BURN_EXECUTOR_H
+
+#include "latency.histogram.h"
+
+#include <json/json.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace TernaryFission {
+
+class CpuBurnExecutor {
+public:
+    enum class Policy {
+        FairShare = 0,      // Every field gets the same share of burn time
+        EnergyWeighted      // Share proportional to energy_mev
+    };
+
+    struct Settings {
+        unsigned threads = 0;                       // Burn threads (0 disables burning)
+        Policy policy = Policy::EnergyWeighted;
+        double cpu_usage_limit_percent = 50.0;      // Share of the machine for the whole pool
+        std::uint64_t min_unit_cycles = 1000000;    // Smallest work unit; small budgets use fewer units
+        std::size_t block_bytes = 16384;            // Scratch bytes encrypted per step of a unit
+    };
+
+    /*
+     * Charges measured cycles of one finished unit to a field; false if the field is gone
+     */
+    using Account = std::function<bool(std::uint64_t field_id, std::uint64_t cycles)>;
+
+    explicit CpuBurnExecutor(Account account);
+    ~CpuBurnExecutor();
+
+    CpuBurnExecutor(const CpuBurnExecutor&) = delete;
+    CpuBurnExecutor& operator=(const CpuBurnExecutor&) = delete;
+
+    /*
+     * Apply settings and restart the workers; pending budgets are kept
+     */
+    void configure(const Settings& settings);
+    Settings settings() const;
+    bool enabled() const;
+
+    /*
+     * Queue a field's CPU budget; a field already queued keeps its first budget
+     */
+    void submit(std::uint64_t field_id, double energy_mev, std::uint64_t budget_cycles);
+
+    /*
+     * Drop a field's remaining budget; a unit already running finishes first
+     */
+    void cancel(std::uint64_t field_id);
+
+    /*
+     * Cancel every pending budget, as cancel() does for one field
+     *
+     * @return: Budgets cancelled
+     */
+    std::size_t clear();
+
+    /*
+     * Stop the workers; pending budgets stay queued until the next configure()
+     */
+    void stop();
+
+    /*
+     * Wait until no budget is pending (the workers must be running)
+     */
+    void drain();
+
+    /*
+     * Per-thread duty cycle for the configured limit and thread count
+     */
+    double dutyCycle() const;
+
+    Json::Value statsToJson() const;
+    std::string toPrometheus() const;
+
+    static const char* policyName(Policy policy);
+    static bool parsePolicy(const std::string& name, Policy& policy);
+
+private:
+    struct Job {
+        double weight;
+        std::uint64_t budget_cycles;
+        std::uint64_t burned_cycles;
+        std::uint64_t unit_cycles;
+        std::uint32_t rounds_total;
+        std::uint32_t rounds_done;
+        double pass;                        // Virtual time; lowest runs next
+        bool running;
+        bool cancelled;
+    };
+
+    void workerLoop(unsigned index);
+    void finishJob(std::unordered_map<std::uint64_t, Job>::iterator it, bool completed);
+    std::uint64_t burn(std::uint64_t field_id, std::uint32_t round, std::uint64_t target_cycles,
+                       std::vector<unsigned char>& scratch, std::size_t block_bytes);
+
+    const Account account_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable work_cv_;       // Workers wait for ready jobs or stop
+    std::condition_variable idle_cv_;       // drain() waits for the last job
+    Settings settings_;
+    std::unordered_map<std::uint64_t, Job> jobs_;
+    std::set<std::pair<double, std::uint64_t>> ready_;  // (pass, field_id)
+    double virtual_time_ = 0.0;
+    bool stopping_ = false;
+    std::vector<std::thread> workers_;
+
+    std::atomic<std::uint64_t> submitted_{0};
+    std::atomic<std::uint64_t> completed_{0};
+    std::atomic<std::uint64_t> cancelled_{0};
+    std::atomic<std::uint64_t> dropped_{0};
+    std::atomic<std::uint64_t> units_{0};
+    std::atomic<std::uint64_t> budget_cycles_{0};       // Budgets of finished jobs
+    std::atomic<std::uint64_t> burned_cycles_{0};       // Measured cycles of all units
+    std::atomic<std::uint64_t> completed_budget_cycles_{0};
+    std::atomic<std::uint64_t> completed_burned_cycles_{0};
+    std::atomic<std::uint64_t> throttle_ns_{0};
+    LatencyHistogram unit_time_;
+};
+
+} // namespace TernaryFission
+
+#endif // TERNARY_FISSION_CPU_BURN_EXECUTOR_H
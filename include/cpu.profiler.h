@@ -0,0 +1,75 @@
+/*
+ * File: include/cpu.profiler.h
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Built-in Sampling CPU Profiler with Folded Stack Output
+ * Purpose: Samples on-CPU stacks with SIGPROF and aggregates them for flamegraphs
+ * Reason: We often cannot attach perf or gdb inside our containers, so the server
+ *         needs to profile itself on demand
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ *
+ * Carry-over Context:
+ * - ITIMER_PROF fires on process CPU time, so idle threads are never sampled
+ * - The SIGPROF handler walks frame pointers (the build keeps them with
+ *   -fno-omit-frame-pointer) and checks each new stack page is readable before
+ *   touching it, so a library frame without a frame pointer ends the walk cleanly
+ * - Stacks are aggregated in a fixed-size open-addressing table claimed with CAS;
+ *   samples that find no slot are counted as dropped, never allocated
+ * - Symbols come from dladdr after the run; -rdynamic exports our own symbols
+ * - Only one profile runs at a time
+ */
+
+#ifndef TERNARY_FISSION_CPU_PROFILER_H
+#define TERNARY_FISSION_CPU_PROFILER_H
+
+#include <cstdint>
+#include <string>
+
+namespace TernaryFission {
+namespace Profiler {
+
+constexpr int kMinSampleHz = 1;
+constexpr int kMaxSampleHz = 1000;
+constexpr int kMaxProfileSeconds = 300;
+constexpr int kMaxStackDepth = 64;
+
+struct CpuProfileOptions {
+    int seconds = 30;                    // Profile duration
+    int hz = 99;                         // Samples per CPU-second
+};
+
+struct CpuProfileResult {
+    std::string folded;                  // "root;caller;leaf count" lines
+    std::uint64_t samples = 0;           // Samples aggregated into stacks
+    std::uint64_t dropped = 0;           // Samples lost to a full table
+    std::uint64_t truncated = 0;         // Stacks cut at kMaxStackDepth
+    std::uint64_t unique_stacks = 0;     // Distinct stacks recorded
+    double duration_seconds = 0.0;       // Wall time profiled
+    double handler_seconds = 0.0;        // Time spent inside the SIGPROF handler
+    double overhead_percent = 0.0;       // handler_seconds / process CPU seconds
+    int hz = 0;
+};
+
+enum class CpuProfileStatus {
+    Ok,
+    Busy,                                // Another profile is running
+    InvalidArgument,
+    Failed                               // Timer or signal setup failed
+};
+
+/*
+ * Run a profile for options.seconds and block until it completes
+ */
+CpuProfileStatus runCpuProfile(const CpuProfileOptions& options, CpuProfileResult& result, std::string& error);
+
+/*
+ * Whether a profile is currently running
+ */
+bool cpuProfileRunning();
+
+} // namespace Profiler
+} // namespace TernaryFission
+
+#endif // TERNARY_FISSION_CPU_PROFILER_H
@@ -0,0 +1,119 @@
+/*
+ * File: include/cycle.clock.h
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Cycle Clock - Calibrated Time Stamp Counter Access
+ * Purpose: Provides a cheap monotonic tick source and its calibrated frequency
+ * Reason: We need timestamps cheap enough for always-available tracing and
+ *         per-field cycle accounting, where steady_clock costs too much
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation for trace ring buffers
+ *
+ * Carry-over Context:
+ * - On x86-64 we read the TSC with rdtsc; on Linux hosts with constant_tsc and
+ *   nonstop_tsc (invariant TSC) it ticks at a fixed rate across cores and P-states
+ * - Other targets fall back to steady_clock nanoseconds (1 tick = 1 ns)
+ * - ticksPerSecond() calibrates once against steady_clock (~10 ms) and caches it
+ */
+
+#ifndef TERNARY_FISSION_CYCLE_CLOCK_H
+#define TERNARY_FISSION_CYCLE_CLOCK_H
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define TERNARY_FISSION_HAVE_TSC 1
+#endif
+
+namespace TernaryFission {
+
+class CycleClock {
+public:
+    /*
+     * Current tick count
+     */
+    static inline std::uint64_t now() {
+#ifdef TERNARY_FISSION_HAVE_TSC
+        return __rdtsc();
+#else
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    /*
+     * Ticks per second, calibrated on first use
+     */
+    static double ticksPerSecond() {
+        static const double rate = calibrate();
+        return rate;
+    }
+
+    /*
+     * Tick count captured at first calibration; trace timestamps are relative to it
+     */
+    static std::uint64_t epoch() {
+        static const std::uint64_t base = (ticksPerSecond(), now());
+        return base;
+    }
+
+    static double ticksToMicroseconds(std::uint64_t ticks) {
+        return static_cast<double>(ticks) * 1e6 / ticksPerSecond();
+    }
+
+    static double ticksToNanoseconds(std::uint64_t ticks) {
+        return static_cast<double>(ticks) * 1e9 / ticksPerSecond();
+    }
+
+    /*
+     * Whether the TSC is invariant (constant rate, keeps ticking in idle states)
+     */
+    static bool isInvariant() {
+#if defined(TERNARY_FISSION_HAVE_TSC) && defined(__linux__)
+        static const bool invariant = []() {
+            std::ifstream cpuinfo("/proc/cpuinfo");
+            std::string line;
+            while (std::getline(cpuinfo, line)) {
+                if (line.rfind("flags", 0) == 0) {
+                    return line.find(" constant_tsc") != std::string::npos &&
+                           line.find(" nonstop_tsc") != std::string::npos;
+                }
+            }
+            return false;
+        }();
+        return invariant;
+#elif defined(TERNARY_FISSION_HAVE_TSC)
+        return false;
+#else
+        return true;
+#endif
+    }
+
+private:
+    static double calibrate() {
+#ifdef TERNARY_FISSION_HAVE_TSC
+        auto wall_start = std::chrono::steady_clock::now();
+        std::uint64_t tsc_start = now();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        auto wall_end = std::chrono::steady_clock::now();
+        std::uint64_t tsc_end = now();
+        double seconds = std::chrono::duration<double>(wall_end - wall_start).count();
+        if (seconds <= 0.0 || tsc_end <= tsc_start) {
+            return 1e9;
+        }
+        return static_cast<double>(tsc_end - tsc_start) / seconds;
+#else
+        return 1e9;
+#endif
+    }
+};
+
+} // namespace TernaryFission
+
+#endif // TERNARY_FISSION_CYCLE_CLOCK_H
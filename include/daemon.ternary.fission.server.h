@@ -14,6 +14,7 @@
  *             Integrated log file management with rotation and monitoring
  *             Added platform-specific process management for macOS, Ubuntu, and Debian
  *             Implemented file descriptor cleanup and security hardening
+ * 2026-10-17: SIGUSR1 toggles span tracing; the monitor thread writes the trace on stop
  *
  * Carry-over Context:
  * - This class implements Unix daemon conventions for background process operation
@@ -142,6 +143,7 @@ private:
     std::thread resource_monitor_thread_;       // Resource monitoring worker
     std::atomic<bool> resource_monitoring_;     // Resource monitoring control
     std::chrono::seconds monitoring_interval_; // Resource monitoring frequency
+    std::atomic<bool> trace_dump_pending_;      // Trace export requested by SIGUSR1
     
     // We implement daemon process management methods
     bool performDoubleFork();                   // Execute Unix double-fork process
@@ -165,7 +167,8 @@ private:
     static void signalHandlerWrapper(int sig); // Static signal handler wrapper
     void handleTerminationSignal(int sig);     // Handle SIGTERM/SIGINT gracefully
     void handleReloadSignal(int sig);           // Handle SIGHUP configuration reload
-    void handleInfoSignal(int sig);             // Handle SIGUSR1/SIGUSR2 status info
+    void handleInfoSignal(int sig);             // Handle SIGUSR2 status info
+    void handleTraceSignal(int sig);            // Handle SIGUSR1 trace toggle
     
     // We implement log management methods
     bool initializeLogFiles();                  // Initialize all log file streams
@@ -177,6 +180,7 @@ private:
     // We implement resource monitoring methods
     void resourceMonitorWorker();               // Resource monitoring background worker
     void collectSystemMetrics();                // Collect CPU/memory/FD statistics
+    void writePendingTrace();                   // Export trace after SIGUSR1 stop
     uint64_t getCurrentMemoryUsage();          // Get current process memory usage
     double getCurrentCPUUsage();               // Get current process CPU usage
     uint64_t getOpenFileDescriptorCount();     // Count open file descriptors
@@ -0,0 +1,142 @@
+/*
+ * File: include/dissipation.scheduler.h
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Dissipation Scheduler - Time-Sliced Entropy Passes over Field Memory
+ * Purpose: Applies the entropy pass of energy field dissipation in fixed-size slices,
+ *          round-robin across fields with a per-field cursor, under a per-tick byte
+ *          budget and a CPU duty cycle derived from cpu_usage_limit
+ * Reason: Dissipating a 1 GB field in one call stalled the engine state lock and
+ *         flushed the caches of every other thread
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ * - 2026-10-17: clear() drops pending passes for an engine reset
+ *
+ * Carry-over Context:
+ * - The scheduler never touches field memory itself; the owner's SliceFunction looks
+ *   the field up by ID under its own lock and applies one slice, so a lock holder
+ *   waits behind at most one slice
+ * - A SliceFunction returning false means the field is gone and its pass is dropped
+ * - Scheduling a field that already has a pass pending extends the pass, up to two
+ *   passes of backlog per field; further requests are counted as coalesced
+ * - cpu_usage_limit_percent is a share of the whole machine; the scheduler's one
+ *   thread is throttled to min(1, percent / 100 * hardware threads) of wall time
+ */
+
+#ifndef TERNARY_FISSION_DISSIPATION_SCHEDULER_H
+#define TERNARY_FISSION_DISSIPATION_SCHEDULER_H
+
+#include "latency.histogram.h"
+
+#include <json/json.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+namespace TernaryFission {
+
+class DissipationScheduler {
+public:
+    struct Settings {
+        std::size_t slice_bytes = 2 * 1024 * 1024;      // Bytes per slice (one lock hold)
+        std::size_t bytes_per_tick = 64 * 1024 * 1024;  // Slice bytes processed per tick at most
+        double cpu_usage_limit_percent = 80.0;          // Share of the machine for dissipation
+        int tick_ms = 10;                               // Scheduling period
+    };
+
+    /*
+     * Applies entropy to [offset, offset + length) of a field; false if the field is gone
+     */
+    using SliceFunction = std::function<bool(std::uint64_t field_id, std::size_t offset, std::size_t length)>;
+
+    DissipationScheduler(SliceFunction slice, const Settings& settings);
+    ~DissipationScheduler();
+
+    DissipationScheduler(const DissipationScheduler&) = delete;
+    DissipationScheduler& operator=(const DissipationScheduler&) = delete;
+
+    Settings settings() const;
+    void configure(const Settings& settings);
+
+    /*
+     * Fraction of wall time the scheduler thread may run for the configured limit
+     */
+    double dutyCycle() const;
+
+    /*
+     * Queue one entropy pass over a field of `bytes`
+     */
+    void schedule(std::uint64_t field_id, std::size_t bytes);
+
+    /*
+     * Process up to one tick's byte budget on the calling thread; returns bytes processed
+     */
+    std::size_t runTick();
+
+    /*
+     * Start or stop the background thread; stop() leaves pending passes queued
+     */
+    void start();
+    void stop();
+
+    /*
+     * Wait until no pass is pending (the background thread must be running)
+     */
+    void drain();
+
+    /*
+     * Drop every pending pass; a slice in progress finishes and is not requeued
+     *
+     * @return: Passes dropped
+     */
+    std::size_t clear();
+
+    Json::Value statsToJson() const;
+    std::string toPrometheus() const;
+
+private:
+    struct Pass {
+        std::size_t field_bytes;
+        std::size_t cursor;                 // Next byte to process; wraps at field_bytes
+        std::size_t remaining;              // Bytes left in the scheduled passes
+    };
+
+    void threadLoop();
+    std::size_t runSlices(std::size_t budget_bytes, std::uint64_t deadline_ticks);
+
+    const SliceFunction slice_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable idle_cv_;
+    Settings settings_;
+    std::unordered_map<std::uint64_t, Pass> passes_;
+    std::deque<std::uint64_t> order_;       // Round-robin order of fields with passes pending
+    std::size_t backlog_bytes_ = 0;
+    std::size_t slicing_ = 0;               // Slices in progress
+    bool running_ = false;
+    std::thread thread_;
+
+    std::atomic<std::uint64_t> passes_scheduled_{0};
+    std::atomic<std::uint64_t> passes_coalesced_{0};
+    std::atomic<std::uint64_t> passes_completed_{0};
+    std::atomic<std::uint64_t> passes_dropped_{0};
+    std::atomic<std::uint64_t> slices_{0};
+    std::atomic<std::uint64_t> bytes_processed_{0};
+    std::atomic<std::uint64_t> busy_ticks_{0};
+    std::atomic<std::uint64_t> throttle_ns_{0};
+    LatencyHistogram slice_time_;
+};
+
+} // namespace TernaryFission
+
+#endif // TERNARY_FISSION_DISSIPATION_SCHEDULER_H
@@ -0,0 +1,108 @@
+/*
+ * File: include/epoch.barrier.h
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Epoch Barrier - Quiescing In-Flight Work Before a Reset
+ * Purpose: Counts the workers and API callers inside the current epoch and lets a reset
+ *          close the epoch, wait for that count to reach zero, swap state and reopen
+ * Reason: A reset that only advanced the epoch left calls already past their epoch check
+ *         (field creation, portal starts) free to land their work in the new epoch
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ *
+ * Carry-over Context:
+ * - enter() blocks while a reset holds the barrier closed, so only one epoch ever has
+ *   callers inside it
+ * - Scopes nest per thread: a call that holds a scope may call another guarded call
+ *   without counting twice, which would deadlock against a waiting reset
+ * - A thread holding a scope must not quiesce the same barrier; quiesce() throws
+ *   std::logic_error instead of waiting on itself
+ * - Scopes cover work that commits to engine state; pool threads that only touch fields
+ *   by ID are not counted and already tolerate their field disappearing
+ */
+
+#ifndef TERNARY_FISSION_EPOCH_BARRIER_H
+#define TERNARY_FISSION_EPOCH_BARRIER_H
+
+#include "profiled.mutex.h"
+
+#include <json/json.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+
+namespace TernaryFission {
+
+class EpochBarrier {
+public:
+    explicit EpochBarrier(const char* name);
+
+    EpochBarrier(const EpochBarrier&) = delete;
+    EpochBarrier& operator=(const EpochBarrier&) = delete;
+
+    /*
+     * Membership of the calling thread in the current epoch; released on destruction
+     */
+    class Scope {
+    public:
+        explicit Scope(EpochBarrier& barrier);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        EpochBarrier& barrier_;
+        bool counted_;
+    };
+
+    /*
+     * Close the epoch, wait for its callers to leave, run swap, then reopen; swap runs
+     * with no caller inside any epoch. New callers wait until the barrier reopens
+     *
+     * @return: Time spent waiting for the old epoch's callers, in microseconds
+     * @throws std::logic_error: The calling thread holds a scope on this barrier
+     */
+    template <typename Fn>
+    double quiesce(Fn swap) {
+        const double waited_us = close();
+        try {
+            swap();
+        } catch (...) {
+            open();
+            throw;
+        }
+        open();
+        return waited_us;
+    }
+
+    /*
+     * Callers inside the current epoch
+     */
+    std::size_t active() const;
+
+    Json::Value statsToJson() const;
+
+private:
+    bool enter();
+    void leave();
+    double close();
+    void open();
+    bool heldByThisThread() const;
+
+    mutable ProfiledMutex mutex_;
+    std::condition_variable_any cv_;
+    std::size_t active_ = 0;
+    bool closed_ = false;
+
+    std::uint64_t quiesces_ = 0;
+    std::uint64_t entries_blocked_ = 0;
+    double total_wait_us_ = 0.0;
+    double max_wait_us_ = 0.0;
+};
+
+} // namespace TernaryFission
+
+#endif // TERNARY_FISSION_EPOCH_BARRIER_H
@@ -0,0 +1,122 @@
+/*
+ * File: include/field.fill.pool.h
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Field Fill Pool - Asynchronous Energy Field Materialization
+ * Purpose: Allocates and fills energy field buffers on dedicated threads so the
+ *          fission event path only registers field metadata; bytes queued or being
+ *          filled are bounded and reported as the fill backlog
+ * Reason: processFissionEvent paid for a ~200 MB mapping and AES fill per event, which
+ *         tied event throughput to memory bandwidth
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ * - 2026-10-17: clear() discards queued fields for an engine reset
+ *
+ * Carry-over Context:
+ * - submit() takes a field from describeEnergyField(); a worker runs
+ *   materializeEnergyField() on its own copy and hands the result to the completion
+ *   callback, which installs it (or releases it if the field is gone)
+ * - submit() blocks while the backlog would exceed max_in_flight_bytes, unless the
+ *   backlog is empty, so a single oversized field still goes through
+ * - Workers call the memory governor, which may run the engine's reclaimer; the
+ *   completion callback must not be invoked with a lock the reclaimer takes
+ * - The destructor finishes queued fields before joining
+ */
+
+#ifndef TERNARY_FISSION_FIELD_FILL_POOL_H
+#define TERNARY_FISSION_FIELD_FILL_POOL_H
+
+#include "latency.histogram.h"
+#include "physics.constants.definitions.h"
+
+#include <json/json.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace TernaryFission {
+
+class FieldFillPool {
+public:
+    /*
+     * Receives each field after materialization; rejected is set when the memory
+     * governor refused it, in which case the field holds no memory
+     */
+    using Completion = std::function<void(EnergyField& field, bool rejected)>;
+
+    FieldFillPool(unsigned threads, std::size_t max_in_flight_bytes, Completion completion);
+    ~FieldFillPool();
+
+    FieldFillPool(const FieldFillPool&) = delete;
+    FieldFillPool& operator=(const FieldFillPool&) = delete;
+
+    /*
+     * Queue a described field for allocation and fill
+     */
+    void submit(const EnergyField& field);
+
+    /*
+     * Wait until no field is queued or being filled
+     */
+    void drain();
+
+    /*
+     * Discard queued fields; fields already filling still reach the completion
+     *
+     * @return: Fields discarded
+     */
+    std::size_t clear();
+
+    unsigned threads() const { return static_cast<unsigned>(workers_.size()); }
+    std::size_t maxInFlightBytes() const { return max_in_flight_bytes_; }
+
+    /*
+     * Backlog, completions, backpressure waits and queue/fill latency
+     */
+    Json::Value statsToJson() const;
+    std::string toPrometheus() const;
+
+private:
+    struct Job {
+        EnergyField field;
+        std::uint64_t queued_ticks;
+    };
+
+    void workerLoop();
+
+    const std::size_t max_in_flight_bytes_;
+    const Completion completion_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable work_cv_;       // Workers wait for jobs
+    std::condition_variable space_cv_;      // Submitters and drain() wait for the backlog to fall
+    std::deque<Job> queue_;
+    std::size_t in_flight_bytes_ = 0;       // Queued plus filling
+    std::size_t filling_ = 0;
+    bool stopping_ = false;
+    std::vector<std::thread> workers_;
+
+    std::size_t peak_in_flight_bytes_ = 0;
+    std::atomic<std::uint64_t> submitted_{0};
+    std::atomic<std::uint64_t> completed_{0};
+    std::atomic<std::uint64_t> rejected_{0};
+    std::atomic<std::uint64_t> failed_{0};
+    std::atomic<std::uint64_t> discarded_{0};
+    std::atomic<std::uint64_t> backpressure_waits_{0};
+    std::atomic<std::uint64_t> backpressure_ticks_{0};
+    LatencyHistogram queue_wait_;
+    LatencyHistogram fill_time_;
+};
+
+} // namespace TernaryFission
+
+#endif // TERNARY_FISSION_FIELD_FILL_POOL_H
@@ -0,0 +1,119 @@
+/*
+ * File: include/field.memory.h
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Energy Field Backing Memory - Huge-Page and Prefaulted Mappings
+ * Purpose: Allocates large energy field buffers with mmap, preferring explicit huge
+ *          pages (MAP_HUGETLB) or transparent huge pages (MADV_HUGEPAGE), with optional
+ *          prefaulting and NUMA-local placement, and counts the page faults they cost
+ * Reason: Fields are hundreds of MB; with malloc each 4 KiB page faults separately on
+ *         first touch and the fill and dissipation passes miss the TLB constantly
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ * - 2026-10-17: Added the Virtual backing for fields whose bytes are regenerated on read
+ *
+ * Carry-over Context:
+ * - Buffers below mmap_threshold_bytes stay on malloc; larger ones fall back
+ *   HugeTlb -> TransparentHuge -> Mmap -> Malloc as each step fails
+ * - MAP_HUGETLB needs reserved pages (vm.nr_hugepages); after the first failure we
+ *   stop trying until configure() is called again
+ * - Prefault uses MADV_POPULATE_WRITE when the kernel has it, otherwise touches one
+ *   byte per page from up to prefault_threads threads
+ * - NUMA placement binds the range preferred to the calling thread's node before the
+ *   first touch; it is skipped on single-node machines
+ * - Settings come from TERNARY_FIELD_MEMORY (auto|hugetlb|thp|mmap|malloc),
+ *   TERNARY_FIELD_PREFAULT=1 and TERNARY_FIELD_NUMA_LOCAL=0 at startup, or configure()
+ * - Virtual fields never call allocate(); they are only counted, with zero live bytes
+ *   and their logical size reported separately
+ */
+
+#ifndef TERNARY_FISSION_FIELD_MEMORY_H
+#define TERNARY_FISSION_FIELD_MEMORY_H
+
+#include "physics.constants.definitions.h"
+
+#include <json/json.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace TernaryFission {
+namespace FieldMemory {
+
+enum class Backing : std::uint8_t {
+    None = 0,
+    Malloc,
+    Mmap,
+    TransparentHuge,
+    HugeTlb,
+    Virtual             // No buffer; bytes are regenerated from the field id on read
+};
+
+enum class Mode : std::uint8_t {
+    Auto,               // HugeTlb, then TransparentHuge, then Mmap, then Malloc
+    HugeTlb,
+    TransparentHuge,
+    Mmap,
+    Malloc
+};
+
+const char* backingName(Backing backing);
+const char* modeName(Mode mode);
+
+struct Settings {
+    Mode mode = Mode::Auto;
+    std::size_t mmap_threshold_bytes = 2 * 1024 * 1024; // Smaller buffers use malloc
+    bool prefault = false;                              // Fault pages in at allocation
+    unsigned prefault_threads = 4;                      // Touch threads when MADV_POPULATE_WRITE is missing
+    bool numa_local = true;                             // Prefer the allocating thread's node
+};
+
+Settings settings();
+void configure(const Settings& settings);
+
+/*
+ * One field buffer; mapped_bytes is what release() must unmap
+ */
+struct Block {
+    void* memory = nullptr;
+    std::size_t mapped_bytes = 0;
+    Backing backing = Backing::None;
+    std::uint64_t faults = 0;           // Page faults taken while allocating (including prefault)
+};
+
+/*
+ * Allocate `bytes` of field memory; memory is nullptr if every backing failed
+ */
+Block allocate(std::size_t bytes);
+
+/*
+ * Return a buffer obtained from allocate()
+ */
+void release(void* memory, std::size_t mapped_bytes, Backing backing);
+
+/*
+ * Count or uncount a virtual field of `logical_bytes`; nothing is allocated
+ */
+void registerVirtual(std::size_t logical_bytes);
+void unregisterVirtual(std::size_t logical_bytes);
+
+/*
+ * Minor plus major page faults taken so far by the calling thread
+ */
+std::uint64_t threadPageFaults();
+
+/*
+ * Backing, fault counts and the fault reduction against 4 KiB pages for one field
+ */
+Json::Value fieldMemoryToJson(const EnergyField& field);
+
+/*
+ * Settings, live buffers per backing and huge-page fallbacks as JSON
+ */
+Json::Value statsToJson();
+
+} // namespace FieldMemory
+} // namespace TernaryFission
+
+#endif // TERNARY_FISSION_FIELD_MEMORY_H
@@ -0,0 +1,151 @@
+/*
+ * File: include/flight.recorder.h
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Flight Recorder - Always-On Telemetry Rings with Anomaly Dumps
+ * Purpose: Keeps the last ~60 s of coarse spans, metric samples and log lines in
+ *          fixed per-thread rings and dumps them to a file on SIGUSR2, on an API
+ *          call, or when the watchdog sees an event-rate drop, latency spike or
+ *          RSS jump
+ * Reason: We want the telemetry around a stall or memory spike after the fact,
+ *         without having had tracing switched on when it happened
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ *
+ * Carry-over Context:
+ * - Always on by default; a record is one 128-byte slot write on the calling
+ *   thread's ring, and engine phases shorter than the minimum span are skipped
+ * - Rings are leased per thread and returned at thread exit, so memory is
+ *   ring capacity x peak thread count and never grows with uptime
+ * - Names and categories must be string literals (we store the pointers); span
+ *   detail and log text are copied and truncated to kRecordTextBytes - 1
+ * - Dumps are Chrome trace-event JSON (chrome://tracing, ui.perfetto.dev) written
+ *   to a temporary file and renamed into place, so readers never see a partial dump
+ * - requestDump() is async-signal-safe; the watchdog thread performs the write
+ */
+
+#ifndef TERNARY_FISSION_FLIGHT_RECORDER_H
+#define TERNARY_FISSION_FLIGHT_RECORDER_H
+
+#include "cycle.clock.h"
+
+#include <json/json.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace TernaryFission {
+namespace Flight {
+
+constexpr double kWindowSeconds = 60.0;
+constexpr std::size_t kRecordTextBytes = 72;
+
+// We keep the enable flag and span floor global so the filter is two loads
+extern std::atomic<bool> g_flight_enabled;
+extern std::atomic<std::uint64_t> g_min_span_ns;
+
+inline bool isEnabled() {
+    return g_flight_enabled.load(std::memory_order_relaxed);
+}
+
+/*
+ * True if a span of `ticks` is long enough to be kept
+ */
+inline bool wantsSpan(std::uint64_t ticks) {
+    return isEnabled() &&
+           CycleClock::ticksToNanoseconds(ticks) >= static_cast<double>(g_min_span_ns.load(std::memory_order_relaxed));
+}
+
+void setEnabled(bool enabled);
+
+/*
+ * Record a completed span; `detail` (optional) is copied
+ */
+void recordSpan(const char* name, const char* category, std::uint64_t start_ticks, std::uint64_t end_ticks,
+                const char* detail = nullptr);
+
+/*
+ * Record one metric sample at the current time
+ */
+void recordMetric(const char* name, double value);
+
+/*
+ * Record one log line at the current time; `message` is copied
+ */
+void recordLog(const char* category, const char* message);
+
+inline void recordLog(const char* category, const std::string& message) {
+    recordLog(category, message.c_str());
+}
+
+/*
+ * Records per thread ring (fixed at first use)
+ */
+std::size_t ringCapacity();
+
+/*
+ * Directory that dumps are written to (created on first dump)
+ */
+void setDumpDirectory(const std::string& directory);
+std::string dumpDirectory();
+
+/*
+ * Serialize the last kWindowSeconds of records as Chrome trace-event JSON
+ */
+std::string dumpJson(const char* reason);
+
+/*
+ * Write dumpJson() atomically to flight-<pid>-<unix time>-<n>-<reason>.json in the
+ * dump directory; returns the path, or an empty string on I/O error
+ */
+std::string writeDump(const char* reason);
+
+/*
+ * Ask the watchdog thread to write a dump (async-signal-safe); `reason` must be a literal
+ */
+void requestDump(const char* reason);
+
+/*
+ * Route `signal_number` to requestDump("signal")
+ */
+bool installSignalHandler(int signal_number);
+
+/*
+ * Anomaly thresholds for the watchdog
+ */
+struct WatchdogConfig {
+    int sample_interval_ms = 1000;          // Metric sample period
+    int warmup_samples = 5;                 // Samples before anomalies are reported
+    double min_events_per_second = 1.0;     // Ignore rate drops below this baseline
+    double rate_drop_fraction = 0.5;        // Drop below (1 - fraction) x baseline
+    double latency_spike_factor = 4.0;      // Interval mean above factor x baseline
+    double min_latency_spike_ms = 1.0;      // Ignore spikes below this mean
+    std::uint64_t rss_jump_bytes = 256ULL * 1024 * 1024; // Growth within rss_window_samples
+    int rss_window_samples = 10;
+    int cooldown_seconds = 60;              // Minimum gap between automatic dumps
+};
+
+/*
+ * Start or stop the watchdog thread (samples metrics, detects anomalies and
+ * writes requested dumps); start is a no-op while it is running
+ */
+void startWatchdog(const WatchdogConfig& config = WatchdogConfig());
+void stopWatchdog();
+
+/*
+ * Forget rate and latency baselines, e.g. after the target event rate changes
+ */
+void resetWatchdogBaselines();
+
+/*
+ * Recorder, ring and watchdog state as JSON
+ */
+Json::Value statusToJson();
+
+} // namespace Flight
+} // namespace TernaryFission
+
+#endif // TERNARY_FISSION_FLIGHT_RECORDER_H
@@ -0,0 +1,135 @@
+/*
+ * File: include/fragment.yields.h
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Fragment Yields - Alias-Table Sampling of Fission Fragment Pairs
+ * Purpose: Tabulates (A, Z) yields of light/heavy fragment pairs for one parent nucleus,
+ *          built from the configured double-humped mass model or read from a data file,
+ *          and samples a pair in O(1) through a Walker/Vose alias table
+ * Reason: The engine split the parent with a hard-coded normalRandom(1.4, 0.15) mass ratio
+ *         and ignored light/heavy_fragment_mean/sigma from the configuration
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ *
+ * Carry-over Context:
+ * - A table holds the light fragment of each pair; the heavy partner is the complement
+ *   after the alpha particle: A_L + A_H = A - 4 and Z_L + Z_H = Z - 2
+ * - The model weights a light mass a by the light hump at a plus the heavy hump at its
+ *   partner A - 4 - a, so both configured peaks show in the yields; charges are Gaussian
+ *   around the unchanged charge density a * (Z - 2) / (A - 4) with width charge_sigma
+ * - Yield files hold one "A Z yield" light fragment per line; '#' starts a comment
+ * - sample() takes one 64-bit draw: the high half picks the column, the low half decides
+ *   between the column and its alias. Tables are immutable once built and are shared
+ *   read-only across threads through shared_ptr<const FragmentYields>
+ */
+
+#ifndef TERNARY_FISSION_FRAGMENT_YIELDS_H
+#define TERNARY_FISSION_FRAGMENT_YIELDS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace TernaryFission {
+
+/*
+ * Walker/Vose alias table over weighted outcomes
+ */
+class AliasTable {
+public:
+    AliasTable() = default;
+
+    /*
+     * Build from non-negative weights; they need not be normalized
+     *
+     * @throws std::invalid_argument: No weights, a negative weight or a zero total
+     */
+    explicit AliasTable(const std::vector<double>& weights);
+
+    /*
+     * Outcome for one 64-bit draw
+     */
+    inline std::uint32_t sample(std::uint64_t bits) const {
+        const std::uint32_t column = static_cast<std::uint32_t>(((bits >> 32) * columns_.size()) >> 32);
+        const Column& entry = columns_[column];
+        // We select with a mask; as a branch the coin mispredicts on about half the draws
+        const std::uint32_t keep = 0U - static_cast<std::uint32_t>((bits & 0xFFFFFFFFULL) < entry.threshold);
+        return entry.alias ^ ((entry.alias ^ column) & keep);
+    }
+
+    std::size_t size() const { return columns_.size(); }
+
+    /*
+     * Probability the table assigns to an outcome, reconstructed from its columns
+     */
+    double probability(std::size_t outcome) const;
+
+private:
+    struct Column {
+        std::uint64_t threshold;  // Keep the column below this; 2^32 keeps it always
+        std::uint32_t alias;
+    };
+
+    std::vector<Column> columns_;
+};
+
+/*
+ * Light and heavy fragment of one sampled split
+ */
+struct FragmentPair {
+    std::uint16_t light_mass_number;
+    std::uint16_t light_atomic_number;
+    std::uint16_t heavy_mass_number;
+    std::uint16_t heavy_atomic_number;
+};
+
+/*
+ * Double-humped mass model and optional yield file (configuration keys of the same names)
+ */
+struct FragmentYieldModel {
+    double light_fragment_mean = 95.0;
+    double light_fragment_sigma = 5.0;
+    double heavy_fragment_mean = 140.0;
+    double heavy_fragment_sigma = 8.0;
+    double charge_sigma = 0.56;       // Width of the charge distribution at fixed A
+    std::string yield_file;           // Tabulated yields; empty uses the model above
+};
+
+class FragmentYields {
+public:
+    /*
+     * Yields of one parent from the model, or from model.yield_file when it is set
+     *
+     * @throws std::invalid_argument: The parent cannot split into two fragments and an alpha
+     * @throws std::runtime_error: The yield file cannot be read or has no valid pairs
+     */
+    static std::shared_ptr<const FragmentYields> build(int parent_atomic_number, int parent_mass_number,
+                                                       const FragmentYieldModel& model);
+
+    /*
+     * Yields from explicit light fragments and weights
+     */
+    FragmentYields(int parent_atomic_number, int parent_mass_number, std::vector<FragmentPair> pairs,
+                   const std::vector<double>& weights);
+
+    inline const FragmentPair& sample(std::uint64_t bits) const { return pairs_[table_.sample(bits)]; }
+
+    int parentAtomicNumber() const { return parent_atomic_number_; }
+    int parentMassNumber() const { return parent_mass_number_; }
+    std::size_t size() const { return pairs_.size(); }
+    const FragmentPair& pair(std::size_t index) const { return pairs_[index]; }
+    double probability(std::size_t index) const { return table_.probability(index); }
+
+private:
+    int parent_atomic_number_;
+    int parent_mass_number_;
+    std::vector<FragmentPair> pairs_;
+    AliasTable table_;
+};
+
+} // namespace TernaryFission
+
+#endif // TERNARY_FISSION_FRAGMENT_YIELDS_H
@@ -15,6 +15,17 @@
  *             Added WebSocket support for real-time monitoring
  *             Implemented CORS, logging, and metrics middleware
  *             Added comprehensive error handling and JSON serialization
+ * 2026-10-17: Added trace start/stop/export handlers
+ * 2026-10-17: Added profile counter handlers
+ * 2026-10-17: Added CPU profile handler
+ * 2026-10-17: Server mutexes are ProfiledMutex; added lock profile handlers
+ * 2026-10-17: Added allocation profile handlers
+ * 2026-10-17: Added request timing middleware and batch fission handler
+ * 2026-10-17: Added Prometheus metrics handler
+ * 2026-10-17: Added flight recorder handlers
+ * 2026-10-17: Added engine field list and field byte range handlers
+ * 2026-10-17: Added portal load list and cancel handlers
+ * 2026-10-17: Added the nuclide registry list handler
  *
  * Carry-over Context:
  * - This class implements the HTTP server functionality for daemon mode operations
@@ -32,6 +43,7 @@
 #include "physics.constants.definitions.h"
 #include "ternary.fission.simulation.engine.h"
 #include "media.streaming.h"
+#include "profiled.mutex.h"
 #include <httplib.h>
 #include <json/json.h>
 #include <string>
@@ -118,7 +130,7 @@ struct WebSocketConnection {
     std::string client_ip;                      // Client IP address
     bool active = true;                         // Connection active status
     std::queue<std::string> message_queue;      // Outbound message queue
-    std::mutex queue_mutex;                     // Message queue synchronization
+    ProfiledMutex queue_mutex{"http.websocket_queue_mutex"}; // Message queue synchronization
 };
 
 /**
@@ -133,7 +145,7 @@ struct HTTPServerMetrics {
     std::atomic<uint64_t> active_connections{0}; // Current active connections
     std::atomic<uint64_t> websocket_connections{0}; // Active WebSocket connections
     std::map<std::string, uint64_t> endpoint_counters; // Per-endpoint request counts
-    std::mutex metrics_mutex;                   // Metrics synchronization
+    ProfiledMutex metrics_mutex{"http.metrics_mutex"}; // Metrics synchronization
     
     // We provide methods for metrics updates
     void incrementRequests();
@@ -156,7 +168,7 @@ private:
     std::unique_ptr<httplib::SSLServer> https_server_;        // HTTPS server instance
 #endif
     std::shared_ptr<TernaryFissionSimulationEngine> simulation_engine_; // Physics engine
-    std::mutex simulation_mutex_;                // Simulation state synchronization
+    ProfiledMutex simulation_mutex_{"http.simulation_mutex"}; // Simulation state synchronization
 
     // We manage external media streaming process
     std::unique_ptr<MediaStreamingManager> media_streaming_manager_;
@@ -170,12 +182,12 @@ private:
     
     // We manage energy fields and monitoring
     std::map<std::string, std::unique_ptr<EnergyFieldResponse>> energy_fields_;
-    mutable std::mutex fields_mutex_;                   // Energy fields synchronization
+    mutable ProfiledMutex fields_mutex_{"http.fields_mutex"}; // Energy fields synchronization
     std::atomic<int64_t> field_id_counter_;     // Field ID generation counter
     
     // We handle WebSocket connections
     std::map<std::string, std::unique_ptr<WebSocketConnection>> websocket_connections_;
-    mutable std::mutex websocket_mutex_; // WebSocket synchronization
+    mutable ProfiledMutex websocket_mutex_{"http.websocket_mutex"}; // WebSocket synchronization
     std::thread websocket_broadcast_thread_;    // WebSocket broadcast worker
     std::atomic<bool> websocket_broadcasting_;  // WebSocket broadcast control
     
@@ -183,6 +195,7 @@ private:
     std::unique_ptr<HTTPServerMetrics> metrics_; // Server performance metrics
     std::thread metrics_collection_thread_;     // Metrics collection worker
     std::atomic<bool> metrics_collecting_;      // Metrics collection control
+    int slow_request_threshold_ms_;             // Slow-request log threshold (0 = off)
     
     // We provide middleware implementations
     void setupMiddleware();                     // Configure all middleware
@@ -190,11 +203,15 @@ private:
     void corsMiddleware(const httplib::Request& req, httplib::Response& res);    // CORS handling
     void metricsMiddleware(const httplib::Request& req, httplib::Response& res); // Metrics collection
     void authenticationMiddleware(const httplib::Request& req, httplib::Response& res); // Auth validation
+    void requestTimingMiddleware(const httplib::Request& req, httplib::Response& res); // Open phase timers
+    void serverTimingMiddleware(const httplib::Request& req, httplib::Response& res); // Server-Timing header
+    void requestCompletionLogger(const httplib::Request& req, const httplib::Response& res); // Slow-request log
     
     // We implement API endpoint handlers
     void setupAPIEndpoints();                   // Configure all API endpoints
     void handleHealthCheck(const httplib::Request& req, httplib::Response& res); // Health endpoint
     void handleSystemStatus(const httplib::Request& req, httplib::Response& res); // Status endpoint
+    void handleMetrics(const httplib::Request& req, httplib::Response& res); // Prometheus metrics
     void handleEnergyFieldsList(const httplib::Request& req, httplib::Response& res); // Fields list
     void handleEnergyFieldCreate(const httplib::Request& req, httplib::Response& res); // Create field
     void handleEnergyFieldGet(const httplib::Request& req, httplib::Response& res); // Get field
@@ -204,13 +221,31 @@ private:
     void handleSimulationStop(const httplib::Request& req, httplib::Response& res); // Stop simulation
     void handleSimulationReset(const httplib::Request& req, httplib::Response& res); // Reset simulation
     void handlePortalTrigger(const httplib::Request& req, httplib::Response& res); // Trigger portal load
+    void handlePortalLoadsList(const httplib::Request& req, httplib::Response& res); // Active portal loads
+    void handlePortalLoadCancel(const httplib::Request& req, httplib::Response& res); // Cancel portal load
     void handleStreamStart(const httplib::Request& req, httplib::Response& res); // Start media streaming
     void handleStreamStop(const httplib::Request& req, httplib::Response& res);  // Stop media streaming
     void handleStreamProxy(const httplib::Request& req, httplib::Response& res); // Proxy media stream
     void handleFissionCalculation(const httplib::Request& req, httplib::Response& res); // Fission calc
+    void handleFissionBatch(const httplib::Request& req, httplib::Response& res); // Batch fission calc
+    void handleNuclidesList(const httplib::Request& req, httplib::Response& res); // Registered parents
     void handleConservationLaws(const httplib::Request& req, httplib::Response& res); // Conservation check
     void handleEnergyGeneration(const httplib::Request& req, httplib::Response& res); // Energy generation
     void handleFieldStatistics(const httplib::Request& req, httplib::Response& res); // Field statistics
+    void handlePhysicsFieldsList(const httplib::Request& req, httplib::Response& res); // Engine fields
+    void handlePhysicsFieldBytes(const httplib::Request& req, httplib::Response& res); // Field byte range
+    void handleTraceStart(const httplib::Request& req, httplib::Response& res); // Start span tracing
+    void handleTraceStop(const httplib::Request& req, httplib::Response& res); // Stop span tracing
+    void handleTraceDump(const httplib::Request& req, httplib::Response& res); // Chrome trace export
+    void handleProfileCounters(const httplib::Request& req, httplib::Response& res); // Phase counters
+    void handleProfileCountersUpdate(const httplib::Request& req, httplib::Response& res); // Toggle/reset counters
+    void handleCpuProfile(const httplib::Request& req, httplib::Response& res); // Sampling CPU profile
+    void handleLockProfiles(const httplib::Request& req, httplib::Response& res); // Per-lock contention
+    void handleLockProfilesReset(const httplib::Request& req, httplib::Response& res); // Reset lock profiles
+    void handleAllocationProfile(const httplib::Request& req, httplib::Response& res); // Per-scope allocations
+    void handleAllocationProfileReset(const httplib::Request& req, httplib::Response& res); // Reset allocations
+    void handleFlightRecorderStatus(const httplib::Request& req, httplib::Response& res); // Flight recorder state
+    void handleFlightRecorderDump(const httplib::Request& req, httplib::Response& res); // Write a flight dump
     
     // We handle WebSocket connections and broadcasting
     void setupWebSocketEndpoints();             // Configure WebSocket endpoints
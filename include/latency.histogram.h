@@ -0,0 +1,196 @@
+/*
+ * File: include/latency.histogram.h
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Log-Linear Latency Histogram - HDR-style Percentile Tracking
+ * Purpose: Records latencies into fixed log-linear buckets and reports percentiles
+ * Reason: We need bounded-memory, lock-free latency distributions for load tests and
+ *         server-side telemetry instead of averages that hide tail behaviour
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation for the HTTP load generator
+ *
+ * Carry-over Context:
+ * - Values are unsigned integers (we use nanoseconds); relative error is below
+ *   1/32 (~3%) per bucket, matching a 2-significant-digit HDR histogram
+ * - record() is thread-safe and lock-free; hot paths should still shard
+ *   histograms per thread to avoid cache-line contention
+ * - Snapshot is a plain copy used for merging, percentiles and JSON output
+ */
+
+#ifndef TERNARY_FISSION_LATENCY_HISTOGRAM_H
+#define TERNARY_FISSION_LATENCY_HISTOGRAM_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <json/json.h>
+
+namespace TernaryFission {
+
+class LatencyHistogram {
+public:
+    static constexpr unsigned kSubBucketBits = 5;
+    static constexpr std::uint64_t kSubBucketCount = 1ULL << kSubBucketBits;
+    static constexpr unsigned kMaxValueBits = 40;               // ~18 minutes in ns
+    static constexpr std::uint64_t kMaxValue = (1ULL << kMaxValueBits) - 1;
+    static constexpr std::size_t kBucketCount =
+        static_cast<std::size_t>((kMaxValueBits - kSubBucketBits + 1) * kSubBucketCount);
+
+    /*
+     * Plain, non-atomic copy of a histogram
+     * We use snapshots to merge shards and to compute percentiles
+     */
+    struct Snapshot {
+        std::vector<std::uint64_t> counts = std::vector<std::uint64_t>(kBucketCount, 0);
+        std::uint64_t total = 0;
+        std::uint64_t sum = 0;
+        std::uint64_t min = std::numeric_limits<std::uint64_t>::max();
+        std::uint64_t max = 0;
+
+        void merge(const Snapshot& other) {
+            for (std::size_t i = 0; i < kBucketCount; ++i) {
+                counts[i] += other.counts[i];
+            }
+            total += other.total;
+            sum += other.sum;
+            min = std::min(min, other.min);
+            max = std::max(max, other.max);
+        }
+
+        double mean() const {
+            return total > 0 ? static_cast<double>(sum) / static_cast<double>(total) : 0.0;
+        }
+
+        /*
+         * Value at quantile q in [0,1]
+         * We report the upper edge of the bucket, clamped to the observed maximum
+         */
+        std::uint64_t percentile(double q) const {
+            if (total == 0) {
+                return 0;
+            }
+            q = std::min(1.0, std::max(0.0, q));
+            std::uint64_t rank = static_cast<std::uint64_t>(q * static_cast<double>(total) + 0.5);
+            rank = std::max<std::uint64_t>(1, std::min(rank, total));
+            std::uint64_t seen = 0;
+            for (std::size_t i = 0; i < kBucketCount; ++i) {
+                seen += counts[i];
+                if (seen >= rank) {
+                    return std::min(max, std::max(min, bucketUpperBound(i)));
+                }
+            }
+            return max;
+        }
+
+        /*
+         * Serialize the summary with values divided by `scale` (e.g. 1e3 for ns -> us)
+         */
+        Json::Value toJson(double scale = 1.0) const {
+            Json::Value json;
+            json["count"] = static_cast<Json::UInt64>(total);
+            json["min"] = total > 0 ? static_cast<double>(min) / scale : 0.0;
+            json["max"] = static_cast<double>(max) / scale;
+            json["mean"] = mean() / scale;
+            json["p50"] = static_cast<double>(percentile(0.50)) / scale;
+            json["p90"] = static_cast<double>(percentile(0.90)) / scale;
+            json["p99"] = static_cast<double>(percentile(0.99)) / scale;
+            json["p999"] = static_cast<double>(percentile(0.999)) / scale;
+            json["p9999"] = static_cast<double>(percentile(0.9999)) / scale;
+            return json;
+        }
+    };
+
+    LatencyHistogram() {
+        reset();
+    }
+
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    /*
+     * Record one value (thread-safe, lock-free)
+     */
+    void record(std::uint64_t value) {
+        value = std::min(value, kMaxValue);
+        counts_[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+        total_.fetch_add(1, std::memory_order_relaxed);
+        sum_.fetch_add(value, std::memory_order_relaxed);
+
+        std::uint64_t current_min = min_.load(std::memory_order_relaxed);
+        while (value < current_min &&
+               !min_.compare_exchange_weak(current_min, value, std::memory_order_relaxed)) {
+        }
+        std::uint64_t current_max = max_.load(std::memory_order_relaxed);
+        while (value > current_max &&
+               !max_.compare_exchange_weak(current_max, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    std::uint64_t count() const {
+        return total_.load(std::memory_order_relaxed);
+    }
+
+    Snapshot snapshot() const {
+        Snapshot snap;
+        for (std::size_t i = 0; i < kBucketCount; ++i) {
+            snap.counts[i] = counts_[i].load(std::memory_order_relaxed);
+        }
+        snap.total = total_.load(std::memory_order_relaxed);
+        snap.sum = sum_.load(std::memory_order_relaxed);
+        snap.min = min_.load(std::memory_order_relaxed);
+        snap.max = max_.load(std::memory_order_relaxed);
+        return snap;
+    }
+
+    void reset() {
+        for (auto& c : counts_) {
+            c.store(0, std::memory_order_relaxed);
+        }
+        total_.store(0, std::memory_order_relaxed);
+        sum_.store(0, std::memory_order_relaxed);
+        min_.store(std::numeric_limits<std::uint64_t>::max(), std::memory_order_relaxed);
+        max_.store(0, std::memory_order_relaxed);
+    }
+
+    /*
+     * Map a value to its log-linear bucket
+     * Values below kSubBucketCount map 1:1; above that each power of two is
+     * split into kSubBucketCount linear sub-buckets
+     */
+    static std::size_t bucketIndex(std::uint64_t value) {
+        if (value < kSubBucketCount) {
+            return static_cast<std::size_t>(value);
+        }
+        unsigned msb = 63u - static_cast<unsigned>(__builtin_clzll(value));
+        unsigned shift = msb - kSubBucketBits;
+        std::uint64_t sub = (value >> shift) - kSubBucketCount;
+        return static_cast<std::size_t>((shift + 1) * kSubBucketCount + sub);
+    }
+
+    static std::uint64_t bucketUpperBound(std::size_t index) {
+        if (index < kSubBucketCount) {
+            return index;
+        }
+        std::uint64_t shift = index / kSubBucketCount - 1;
+        std::uint64_t sub = index % kSubBucketCount;
+        std::uint64_t lower = (kSubBucketCount + sub) << shift;
+        return lower + (1ULL << shift) - 1;
+    }
+
+private:
+    std::array<std::atomic<std::uint64_t>, kBucketCount> counts_;
+    std::atomic<std::uint64_t> total_;
+    std::atomic<std::uint64_t> sum_;
+    std::atomic<std::uint64_t> min_;
+    std::atomic<std::uint64_t> max_;
+};
+
+} // namespace TernaryFission
+
+#endif // TERNARY_FISSION_LATENCY_HISTOGRAM_H
@@ -0,0 +1,141 @@
+/*
+ * File: include/memory.governor.h
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Memory Governor - Budget Enforcement for Energy Field Backing Memory
+ * Purpose: Tracks bytes committed to field buffers against a cap taken from
+ *          max_memory_usage and memory_usage_limit, and applies a policy when a new
+ *          field does not fit: reject it, shrink it, or evict the lowest-energy or
+ *          oldest fields; a background thread reclaims down from a high watermark
+ * Reason: A burst of high-energy events could commit more field memory than the
+ *         node has and get the process OOM-killed
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ *
+ * Carry-over Context:
+ * - The cap is the smaller of max_bytes and memory_usage_limit_percent of usable
+ *   memory (physical RAM, or the cgroup v2 memory.max when lower); 0 for both
+ *   means unlimited, which is the default until configure() is called
+ * - admit() reserves bytes before the buffer is allocated and release() returns
+ *   them; createEnergyField/releaseEnergyField are the only callers
+ * - Eviction goes through a reclaimer registered by the owner of the live fields
+ *   (the engine); admit() may call it, so admit() must not be called while
+ *   holding a lock the reclaimer takes
+ * - Background reclamation only runs under the evict policies; reject and shrink
+ *   never destroy existing fields
+ */
+
+#ifndef TERNARY_FISSION_MEMORY_GOVERNOR_H
+#define TERNARY_FISSION_MEMORY_GOVERNOR_H
+
+#include <json/json.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+
+namespace TernaryFission {
+namespace Governor {
+
+enum class Policy : std::uint8_t {
+    Reject,             // Refuse fields that do not fit
+    Shrink,             // Materialize what fits, down to min_field_bytes
+    EvictLowestEnergy,  // Evict the lowest-energy fields to make room
+    EvictOldest         // Evict the oldest fields to make room
+};
+
+const char* policyName(Policy policy);
+bool parsePolicy(const std::string& text, Policy& policy);
+
+struct Settings {
+    std::uint64_t max_bytes = 0;                // Absolute cap on committed field bytes (0 = none)
+    double memory_usage_limit_percent = 0.0;    // Cap as a percentage of usable memory (0 = none)
+    Policy policy = Policy::Reject;
+    double high_watermark = 0.90;               // Background reclaim starts above this fraction of the cap
+    double low_watermark = 0.75;                // and stops once below this fraction
+    std::size_t min_field_bytes = 1024 * 1024;  // Smallest shrunk field worth materializing
+    int reclaim_interval_ms = 250;              // Background watermark check period
+};
+
+Settings settings();
+void configure(const Settings& settings);
+
+/*
+ * Effective cap in bytes (0 = unlimited) and bytes currently committed
+ */
+std::uint64_t limitBytes();
+std::uint64_t committedBytes();
+
+enum class Decision : std::uint8_t {
+    Admitted,
+    AdmittedAfterEviction,
+    Shrunk,
+    Rejected
+};
+
+const char* decisionName(Decision decision);
+
+struct Grant {
+    std::size_t bytes = 0;              // Bytes reserved; 0 when rejected
+    Decision decision = Decision::Rejected;
+};
+
+/*
+ * Thrown by createEnergyField when the governor rejects a field
+ */
+class MemoryBudgetExceeded : public std::runtime_error {
+public:
+    explicit MemoryBudgetExceeded(const std::string& message) : std::runtime_error(message) {}
+};
+
+/*
+ * Reserve up to `requested` bytes for a new field under the configured policy
+ */
+Grant admit(std::size_t requested);
+
+/*
+ * Return bytes reserved by admit() when the field's buffer is freed (or never allocated)
+ */
+void release(std::size_t bytes);
+
+/*
+ * Evicts fields under `policy` until at least `bytes_needed` are released; returns
+ * the bytes released and the number of fields evicted through `fields_evicted`
+ */
+using Reclaimer = std::function<std::size_t(std::size_t bytes_needed, Policy policy, std::size_t& fields_evicted)>;
+
+/*
+ * Register the reclaimer of `owner`; clearing waits for a reclaim in progress
+ */
+void setReclaimer(const void* owner, Reclaimer reclaimer);
+void clearReclaimer(const void* owner);
+
+/*
+ * Start or stop the background watermark reclaimer thread
+ */
+void startReclaimer();
+void stopReclaimer();
+
+/*
+ * Run one watermark check now; returns bytes reclaimed
+ */
+std::size_t reclaimToWatermark();
+
+/*
+ * Zero decision counters (committed bytes are kept)
+ */
+void resetStatistics();
+
+/*
+ * Settings, committed/peak bytes and decision counters
+ */
+Json::Value statsToJson();
+std::string toPrometheus();
+
+} // namespace Governor
+} // namespace TernaryFission
+
+#endif // TERNARY_FISSION_MEMORY_GOVERNOR_H
@@ -0,0 +1,82 @@
+/*
+ * File: include/nuclear.masses.h
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Nuclear Masses - Binding Energy and Mass Excess Lookup Table
+ * Purpose: Holds the binding energy and atomic mass excess of every (Z, A) with A <= 300
+ *          in one flat array indexed directly by (Z, A), so the engine reads each nucleus
+ *          of an event with a single load
+ * Reason: FissionFragment::binding_energy was never filled and the Q-value came from a
+ *         931.5 x mass deficit over masses that were themselves a proportional split
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ *
+ * Carry-over Context:
+ * - Entries come from the semi-empirical mass formula (volume, surface, Coulomb, asymmetry
+ *   and pairing terms) with the measured values of the A <= 4 nuclei, where the formula
+ *   is meaningless; the alpha particle therefore carries its real 28.296 MeV
+ * - The table is triangular: row A holds Z = 0..A at offset A(A+1)/2 + Z, 45,451 entries
+ *   of 16 bytes. It is built once on first use and is read-only afterwards
+ * - Mass excesses are atomic, Delta = Z * Delta(1H) + N * Delta(n) - B, so Q-values of
+ *   splits that conserve Z and N are the same from either column
+ */
+
+#ifndef TERNARY_FISSION_NUCLEAR_MASSES_H
+#define TERNARY_FISSION_NUCLEAR_MASSES_H
+
+#include <cstddef>
+#include <vector>
+
+namespace TernaryFission {
+
+/*
+ * Binding energy and atomic mass excess of one nucleus, both in MeV
+ */
+struct NuclearMass {
+    double binding_energy;
+    double mass_excess;
+};
+
+class NuclearMassTable {
+public:
+    static constexpr int kMaxMassNumber = 300;
+    static constexpr double kHydrogenMassExcess = 7.288971;  // MeV, 1H atom
+    static constexpr double kNeutronMassExcess = 8.071318;   // MeV
+
+    /*
+     * Shared table, built on the first call
+     */
+    static const NuclearMassTable& instance();
+
+    static bool covers(int atomic_number, int mass_number) {
+        return mass_number >= 1 && mass_number <= kMaxMassNumber && atomic_number >= 0 &&
+               atomic_number <= mass_number;
+    }
+
+    /*
+     * Entry for a covered nucleus; callers check covers() for untrusted input
+     */
+    inline const NuclearMass& at(int atomic_number, int mass_number) const {
+        return entries_[offset(atomic_number, mass_number)];
+    }
+
+    /*
+     * Semi-empirical binding energy in MeV, without the light-nucleus overrides
+     */
+    static double semiEmpiricalBindingEnergy(int atomic_number, int mass_number);
+
+private:
+    NuclearMassTable();
+
+    static inline std::size_t offset(int atomic_number, int mass_number) {
+        return static_cast<std::size_t>(mass_number) * (mass_number + 1) / 2 +
+               static_cast<std::size_t>(atomic_number);
+    }
+
+    std::vector<NuclearMass> entries_;
+};
+
+} // namespace TernaryFission
+
+#endif // TERNARY_FISSION_NUCLEAR_MASSES_H
@@ -0,0 +1,104 @@
+/*
+ * File: include/nuclide.registry.h
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Nuclide Registry - Precomputed Per-Parent Fission Data
+ * Purpose: Holds, for each fissioning parent the engine knows ("U-235", "Cf-252", ...),
+ *          its Z and A, atomic mass, binding energy, the Q-value constant of its ternary
+ *          splits, its ternary-particle probabilities and its fragment yield table
+ * Reason: The engine hard-coded Z = 92 and derived everything from a double parent mass,
+ *         so Pu-239 or Cf-252 runs split with uranium charges and yields
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ * - 2026-10-17: Added findByMassNumber for callers that pass only a parent mass
+ *
+ * Carry-over Context:
+ * - Everything a nuclide needs per event is computed once when the registry is built;
+ *   an event reads its Nuclide and the NuclearMassTable and nothing else
+ * - Built-in parents carry representative mass-hump positions (thermal neutron induced,
+ *   Cf-252 spontaneous) and ternary-to-binary ratios; widths and charge_sigma come from
+ *   the configured model. The engine's default parent takes its whole model, including
+ *   yield_file, from the configuration
+ * - Registries are immutable and shared read-only through shared_ptr<const NuclideRegistry>;
+ *   Nuclide pointers stay valid for as long as the registry they came from
+ * - Symbols are "<element>-<A>"; parsing is case-insensitive and the dash is optional
+ */
+
+#ifndef TERNARY_FISSION_NUCLIDE_REGISTRY_H
+#define TERNARY_FISSION_NUCLIDE_REGISTRY_H
+
+#include "fragment.yields.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace TernaryFission {
+
+/*
+ * Precomputed data of one fissioning parent
+ */
+struct Nuclide {
+    std::string symbol;            // "Cf-252"
+    int atomic_number;
+    int mass_number;
+    double mass;                   // Atomic mass in AMU, from the mass table
+    double binding_energy;         // MeV
+    double q_value_offset;         // B(alpha) - B(parent): Q = E* + B(light) + B(heavy) + offset
+    double ternary_probability;    // Ternary fissions per fission
+    double alpha_fraction;         // Share of ternary particles that are alphas
+    std::shared_ptr<const FragmentYields> yields;
+};
+
+class NuclideRegistry {
+public:
+    /*
+     * Built-in parents plus the default parent, whose yields come from default_model
+     *
+     * @throws std::invalid_argument, std::runtime_error: The default parent's yields
+     *         could not be built
+     */
+    static std::shared_ptr<const NuclideRegistry> build(int default_atomic_number, int default_mass_number,
+                                                        const FragmentYieldModel& default_model);
+
+    /*
+     * Parent for a symbol or for (Z, A); null when the registry does not hold it
+     */
+    const Nuclide* find(const std::string& symbol) const;
+    const Nuclide* find(int atomic_number, int mass_number) const;
+
+    /*
+     * Parent with mass number A, preferring the default parent when several share it;
+     * null when none has it
+     */
+    const Nuclide* findByMassNumber(int mass_number) const;
+
+    const Nuclide& defaultNuclide() const { return nuclides_[default_index_]; }
+    std::size_t size() const { return nuclides_.size(); }
+    const Nuclide& at(std::size_t index) const { return nuclides_[index]; }
+    std::size_t indexOf(const Nuclide& nuclide) const {
+        return static_cast<std::size_t>(&nuclide - nuclides_.data());
+    }
+
+    /*
+     * Parse "Cf-252", "cf252" or "CF-252"; false for an unknown element or a bad A
+     */
+    static bool parseSymbol(const std::string& symbol, int& atomic_number, int& mass_number);
+
+    /*
+     * Canonical "<element>-<A>" symbol
+     */
+    static std::string symbolFor(int atomic_number, int mass_number);
+
+private:
+    NuclideRegistry() = default;
+
+    std::vector<Nuclide> nuclides_;
+    std::size_t default_index_ = 0;
+};
+
+} // namespace TernaryFission
+
+#endif // TERNARY_FISSION_NUCLIDE_REGISTRY_H
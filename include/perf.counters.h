@@ -0,0 +1,175 @@
+/*
+ * File: include/perf.counters.h
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Per-Phase Cycle and Hardware Counter Accounting
+ * Purpose: Measures TSC cycles per engine phase and, optionally, perf_event_open
+ *          instructions, cycles and cache misses per phase
+ * Reason: We want capacity planning to use measured hardware cost instead of the
+ *         nominal energy_mev * cpu_cycles_per_mev figure
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ * - 2026-10-17: Conservation, queue wait and lock wait phases; per-thread latency
+ *               histograms with JSON and Prometheus export
+ * - 2026-10-17: Phase call/cycle accessors; long phases feed the flight recorder
+ *
+ * Carry-over Context:
+ * - TSC accounting is always on: two rdtsc reads and a few relaxed atomic adds per phase
+ * - Hardware counters are off by default; enable them with setHardwareCountersEnabled(),
+ *   PUT /api/v1/profile/counters or TERNARY_PERF_COUNTERS=1
+ * - Hardware counters need perf_event_paranoid <= 2 (user-space only counting); when
+ *   perf_event_open fails we report the reason and keep TSC accounting
+ * - Phases nest (allocate/encrypt run inside process), so totals are inclusive
+ * - Every recorded phase also lands in the calling thread's latency histogram shard;
+ *   shards are merged on read, so recording never touches a shared cache line
+ * - QueueWait and LockWait are recorded directly with recordPhase() because they are
+ *   measured across threads or from ProfiledMutex totals rather than by a scope
+ */
+
+#ifndef TERNARY_FISSION_PERF_COUNTERS_H
+#define TERNARY_FISSION_PERF_COUNTERS_H
+
+#include "cycle.clock.h"
+#include "physics.constants.definitions.h"
+
+#include <json/json.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace TernaryFission {
+namespace Perf {
+
+enum class Phase : int {
+    Generate = 0,
+    Process,
+    Allocate,
+    Encrypt,
+    Dissipate,
+    Conservation,
+    QueueWait,
+    LockWait,
+    Count
+};
+
+const char* phaseName(Phase phase);
+
+/*
+ * Hardware counter values read from a perf_event_open group
+ */
+struct HardwareSample {
+    std::uint64_t cycles = 0;
+    std::uint64_t instructions = 0;
+    std::uint64_t cache_references = 0;
+    std::uint64_t cache_misses = 0;
+};
+
+// We keep the enable flag global so the disabled check is a single load
+extern std::atomic<bool> g_hardware_counters_enabled;
+
+/*
+ * Enable or disable hardware counters; returns false (and records why) if
+ * perf_event_open is unavailable
+ */
+bool setHardwareCountersEnabled(bool enabled);
+bool hardwareCountersEnabled();
+std::string hardwareCountersError();
+
+/*
+ * Read the calling thread's counter group; returns false if unavailable
+ */
+bool readHardwareSample(HardwareSample& sample);
+
+/*
+ * Accumulate one completed phase
+ */
+void recordPhase(Phase phase, std::uint64_t tsc_cycles, const HardwareSample* hardware);
+
+/*
+ * Running call count and TSC cycle total of one phase
+ */
+std::uint64_t phaseCalls(Phase phase);
+std::uint64_t phaseTscCycles(Phase phase);
+
+/*
+ * Zero all phase totals and latency histograms
+ */
+void resetPhaseCounters();
+
+/*
+ * Phase totals, TSC calibration and hardware counter state as JSON
+ */
+Json::Value phaseCountersToJson();
+
+/*
+ * Merged per-phase latency percentiles in microseconds
+ */
+Json::Value phaseLatenciesToJson();
+
+/*
+ * Per-phase latency as Prometheus summaries (ternary_fission_engine_phase_latency_seconds)
+ */
+std::string phaseLatenciesToPrometheus();
+
+/*
+ * Measured cycles of one energy field as JSON
+ */
+Json::Value fieldCyclesToJson(const EnergyField& field);
+
+/*
+ * Scoped phase measurement
+ * stop() returns the TSC cycles spent in the phase so callers can charge them to a field
+ */
+class PhaseScope {
+public:
+    explicit PhaseScope(Phase phase) : phase_(phase), stopped_(false), hardware_(false) {
+        if (g_hardware_counters_enabled.load(std::memory_order_relaxed)) {
+            hardware_ = readHardwareSample(hardware_start_);
+        }
+        start_ = CycleClock::now();
+    }
+
+    ~PhaseScope() {
+        stop();
+    }
+
+    std::uint64_t stop() {
+        if (stopped_) {
+            return elapsed_;
+        }
+        elapsed_ = CycleClock::now() - start_;
+        stopped_ = true;
+
+        HardwareSample end;
+        if (hardware_ && readHardwareSample(end)) {
+            HardwareSample delta;
+            delta.cycles = end.cycles - hardware_start_.cycles;
+            delta.instructions = end.instructions - hardware_start_.instructions;
+            delta.cache_references = end.cache_references - hardware_start_.cache_references;
+            delta.cache_misses = end.cache_misses - hardware_start_.cache_misses;
+            recordPhase(phase_, elapsed_, &delta);
+        } else {
+            recordPhase(phase_, elapsed_, nullptr);
+        }
+        return elapsed_;
+    }
+
+    PhaseScope(const PhaseScope&) = delete;
+    PhaseScope& operator=(const PhaseScope&) = delete;
+
+private:
+    Phase phase_;
+    bool stopped_;
+    bool hardware_;
+    std::uint64_t start_ = 0;
+    std::uint64_t elapsed_ = 0;
+    HardwareSample hardware_start_;
+};
+
+} // namespace Perf
+} // namespace TernaryFission
+
+#endif // TERNARY_FISSION_PERF_COUNTERS_H
@@ -14,6 +14,14 @@
  *             Added complete C++ standard library headers for GCC 12.2/13.3 compatibility
  *             Ensures proper Ubuntu 24.04 and Debian 12 compatibility
  * 2025-07-31: Updated EnergyField defaults and cleaned legacy references
+ * 2026-10-17: SimulationState::fission_events is a deque so history can be bounded as a FIFO
+ * 2026-10-17: EnergyField carries measured allocation/encryption/dissipation TSC cycles
+ * 2026-10-17: EnergyField records its backing (FieldMemory::Backing), mapped size and page faults
+ * 2026-10-17: EnergyField records the bytes requested before the memory governor shrank it
+ * 2026-10-17: EnergyField counts dissipation passes as an entropy epoch for virtual fields
+ * 2026-10-17: EnergyField carries a FieldState so fields can be registered before they are filled
+ * 2026-10-17: EnergyField records cycles spent burning its CPU budget
+ * 2026-10-17: TernaryFissionEvent records the Z and A of its parent nucleus
  *
  * Carry-over Context:
  * - We use these constants throughout the C++ simulation engine
@@ -31,6 +39,7 @@
 #include <cstdint>      // For uint64_t, int64_t, etc.
 #include <cmath>        // For mathematical functions
 #include <vector>       // For std::vector
+#include <deque>        // For bounded event history
 #include <memory>       // For smart pointers
 #include <chrono>       // For time measurements
 #include <random>       // For random number generation
@@ -142,6 +151,8 @@ namespace TernaryFission {
     struct TernaryFissionEvent {
         std::uint64_t event_id;            // Unique event identifier
         std::uint64_t energy_field_id;     // Associated energy field identifier
+        int parent_atomic_number;          // Z of the fissioning nucleus
+        int parent_mass_number;            // A of the fissioning nucleus
 
         FissionFragment light_fragment;    // Lighter fission fragment
         FissionFragment heavy_fragment;    // Heavier fission fragment
@@ -163,6 +174,7 @@ namespace TernaryFission {
         std::chrono::high_resolution_clock::time_point timestamp;
 
         TernaryFissionEvent() : event_id(0), energy_field_id(0),
+                               parent_atomic_number(0), parent_mass_number(0),
                                total_kinetic_energy(0.0), q_value(0.0),
                                binding_energy_released(0.0),
                                momentum_conserved(false), energy_conserved(false),
@@ -176,24 +188,46 @@ namespace TernaryFission {
      * We model the energy field as computational resource consumption
      * Memory allocation and CPU cycles represent energy field intensity
      */
+    /**
+     * We register fields before their memory is filled when materialization is asynchronous
+     */
+    enum class FieldState : std::uint8_t {
+        Active = 0,        // Memory allocated and filled (or virtual)
+        Materializing      // Registered; the fill pool has not allocated and filled it yet
+    };
+
     struct EnergyField {
         std::uint64_t field_id;                                            // Unique field identifier
         double energy_mev;                                                 // Energy level in MeV
         std::size_t memory_bytes;                                         // Bytes allocated to represent energy
-        std::uint64_t cpu_cycles;                                         // CPU cycles used for calculations
+        std::uint64_t cpu_cycles;                                         // Measured TSC cycles (sum of phases below)
+        std::uint64_t allocation_cycles;                                  // TSC cycles spent allocating backing memory
+        std::uint64_t encryption_cycles;                                  // TSC cycles spent encrypting the pattern
+        std::uint64_t dissipation_cycles;                                 // TSC cycles spent in dissipation passes
+        std::uint64_t burn_cycles;                                        // TSC cycles spent burning the CPU budget
         double entropy_factor;                                            // Thermodynamic entropy component
         double dissipation_rate;                                          // Energy dissipation rate
         double stability_factor;                                          // Field stability coefficient
         double interaction_strength;                                      // Interaction strength coefficient
         std::chrono::high_resolution_clock::time_point creation_time;     // Creation timestamp
         void* memory_ptr;                                                 // Pointer to allocated memory
+        std::size_t memory_requested_bytes;                               // Bytes asked for before the memory governor decided
+        std::size_t memory_mapped_bytes;                                  // Bytes actually mapped (rounded to the page size)
+        std::uint8_t memory_backing;                                      // FieldMemory::Backing of memory_ptr
+        std::uint64_t allocation_faults;                                  // Page faults while allocating (and prefaulting)
+        std::uint64_t fill_faults;                                        // Page faults while writing the encrypted pattern
+        std::uint32_t entropy_epoch;                                      // Dissipation passes applied to the pattern
+        FieldState state;                                                 // Active, or waiting for the fill pool
 
         EnergyField() : field_id(0), energy_mev(0.0),
                        memory_bytes(0), cpu_cycles(0),
+                       allocation_cycles(0), encryption_cycles(0), dissipation_cycles(0), burn_cycles(0),
                        entropy_factor(1.0), dissipation_rate(0.0),
                        stability_factor(1.0), interaction_strength(0.0),
                        creation_time(std::chrono::high_resolution_clock::now()),
-                       memory_ptr(nullptr) {}
+                       memory_ptr(nullptr), memory_requested_bytes(0), memory_mapped_bytes(0), memory_backing(0),
+                       allocation_faults(0), fill_faults(0), entropy_epoch(0),
+                       state(FieldState::Active) {}
     };
 
     /**
@@ -201,7 +235,7 @@ namespace TernaryFission {
      * This allows us to monitor and control the entire emulation process
      */
     struct SimulationState {
-        std::vector<TernaryFissionEvent> fission_events;
+        std::deque<TernaryFissionEvent> fission_events;
         std::vector<EnergyField> active_energy_fields;
 
         // System-wide metrics
@@ -14,6 +14,17 @@
  * - 2025-07-30: FIXED missing standard library includes causing size_t compilation errors
  *               Added complete C++ standard library headers for GCC 12.2/13.3 compatibility
  *               Ensures proper Ubuntu 24.04 and Debian 12 compatibility
+ * - 2026-10-17: Declared encryptMemoryPattern so benchmarks can reach it directly
+ * - 2026-10-17: Added releaseEnergyField to free field backing memory
+ * - 2026-10-17: Added virtual fields: generateFieldBytes regenerates any byte range of a
+ *               field from (field_id, entropy_epoch) and readEnergyFieldBytes reads slices
+ * - 2026-10-17: Split createEnergyField into describeEnergyField and materializeEnergyField
+ *               so the fill can run off the event path; added fieldStateName
+ * - 2026-10-17: Added dissipateEnergyFieldState and dissipateEnergyFieldSlice for
+ *               time-sliced dissipation
+ * - 2026-10-17: uniformRandom/normalRandom/poissonRandom use random.samplers.h; bulk
+ *               callers should use the Sampling::fill* APIs directly
+ * - 2026-10-17: Added applyConservationLaws overload taking the heavy fragment direction
  *
  * Leave-off Context:
  * - Header provides complete interface for physics utilities
@@ -123,6 +134,33 @@ void allocateEnergyField(EnergyField& field, double energy_mev);
  */
 void dissipateEnergyField(EnergyField& field);
 
+/*
+ * Dissipate a field's energy, entropy and stability without the memory pass
+ * We advance entropy_epoch; the buffer is updated by dissipateEnergyFieldSlice
+ *
+ * @param field: Energy field to dissipate
+ * @return: false if the field has no energy left to dissipate
+ */
+bool dissipateEnergyFieldState(EnergyField& field);
+
+/*
+ * Apply the entropy pass to [offset, offset + length) of a field's buffer
+ * We clamp the range to memory_bytes; fields without a buffer are left alone
+ *
+ * @param field: Energy field whose buffer is updated
+ * @param offset: First byte of the slice
+ * @param length: Slice length in bytes
+ */
+void dissipateEnergyFieldSlice(EnergyField& field, size_t offset, size_t length);
+
+/*
+ * Release the backing memory of an energy field
+ * We free memory_ptr and zero the size; safe to call more than once
+ *
+ * @param field: Energy field whose memory is released
+ */
+void releaseEnergyField(EnergyField& field);
+
 /*
  * Generate random momentum for a fission fragment
  * We create realistic momentum vectors for physics simulation
@@ -140,6 +178,68 @@ void generateRandomMomentum(FissionFragment& fragment);
  */
 EnergyField createEnergyField(double energy_mev);
 
+/*
+ * Describe an energy field without allocating its memory
+ * We assign the ID, logical size and properties; materializeEnergyField does the rest
+ *
+ * @param energy_mev: Energy level in MeV
+ * @return: Field with memory_bytes set and no backing memory
+ */
+EnergyField describeEnergyField(double energy_mev);
+
+/*
+ * Allocate and fill the memory of a described field
+ * We admit the bytes with the memory governor, allocate, write the encrypted
+ * pattern and derive entropy from the measured cost
+ *
+ * @param field: Field from describeEnergyField
+ * @throws Governor::MemoryBudgetExceeded: The governor rejected the field
+ */
+void materializeEnergyField(EnergyField& field);
+
+/*
+ * Name of a field state for JSON output
+ */
+const char* fieldStateName(FieldState state);
+
+/*
+ * Fill energy field memory with an AES-encrypted pattern
+ * We derive the key from the field ID so each field has a distinct pattern
+ *
+ * @param memory_ptr: Field memory to fill
+ * @param memory_size: Size of the memory region in bytes
+ * @param field_id: Field identifier used as key material
+ */
+void encryptMemoryPattern(void* memory_ptr, std::size_t memory_size, std::uint64_t field_id);
+
+/*
+ * Generate bytes [offset, offset + length) of a field's pattern
+ * We encrypt with AES-256-CTR so any range can be produced without the bytes before it;
+ * at entropy_epoch 0 the output equals what encryptMemoryPattern writes, and later
+ * epochs flip each byte with the probability accumulated over that many passes
+ *
+ * @param field_id: Field identifier used as key material
+ * @param entropy_epoch: Dissipation passes applied so far
+ * @param entropy_factor: Current entropy factor of the field
+ * @param offset: First byte to generate
+ * @param out: Destination of `length` bytes
+ * @param length: Number of bytes to generate
+ */
+void generateFieldBytes(std::uint64_t field_id, std::uint32_t entropy_epoch, double entropy_factor,
+                        std::size_t offset, void* out, std::size_t length);
+
+/*
+ * Read a slice of an energy field's memory
+ * We copy from the buffer of a materialized field and regenerate a virtual one
+ *
+ * @param field: Energy field to read
+ * @param offset: First byte to read
+ * @param out: Destination buffer
+ * @param length: Bytes wanted; clamped to the end of the field
+ * @return: Bytes written to out
+ */
+std::size_t readEnergyFieldBytes(const EnergyField& field, std::size_t offset, void* out, std::size_t length);
+
 /*
  * Apply conservation laws to a fission event
  * We adjust fragment properties to ensure conservation
@@ -148,6 +248,15 @@ EnergyField createEnergyField(double energy_mev);
  */
 void applyConservationLaws(TernaryFissionEvent& event);
 
+/*
+ * Apply conservation laws with the heavy fragment along a given direction
+ * We take the direction from the caller so batches can draw them in bulk
+ *
+ * @param event: Ternary fission event to normalize
+ * @param heavy_direction: Unit vector for the heavy fragment momentum
+ */
+void applyConservationLaws(TernaryFissionEvent& event, const Vector3& heavy_direction);
+
 /*
  * Calculate field interference between two energy fields
  * We model quantum interference effects between fields
@@ -259,6 +368,7 @@ struct EnergyFieldConfig {
     double interaction_range = INTERACTION_RANGE;
     double energy_threshold = ENERGY_THRESHOLD;
     bool use_memory_pool = true;
+    bool virtual_fields = false;  // Regenerate field bytes on read instead of storing them
     std::size_t memory_pool_block_size = 1024 * 1024;  // 1MB default
     std::size_t memory_pool_max_blocks = 1000;
 };
@@ -8,6 +8,7 @@ namespace TernaryFission {
 struct MemoryUsage {
     double percent;
     uint64_t peak_bytes;
+    uint64_t rss_bytes;
 };
 
 // We sample CPU usage over a short interval and return percentage [0,100]
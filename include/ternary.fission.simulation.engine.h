@@ -11,6 +11,32 @@
  *               Added all public/private methods and member variables
  *               Fixed missing standard library includes for GCC 12.2/13.3 compatibility
  *               Ensures proper Ubuntu 24.04 and Debian 12 compatibility
+ * - 2026-10-17: Made generateFissionEvent public for the microbenchmark suite
+ * - 2026-10-17: Added lock wait statistics for the engine mutexes
+ * - 2026-10-17: Bounded event history, field memory release and memory accounting
+ * - 2026-10-17: Added measured field cycle totals (getFieldCyclesAPI)
+ * - 2026-10-17: Engine mutexes are named ProfiledMutex instances
+ * - 2026-10-17: Added generateFissionEvents batch API over caller-owned storage
+ * - 2026-10-17: Queued events carry their enqueue tick for queue wait latency
+ * - 2026-10-17: Registers evictEnergyFields as the memory governor's reclaimer
+ * - 2026-10-17: Added readEnergyFieldBytes for slices of materialized and virtual fields
+ * - 2026-10-17: Event fields are materialized asynchronously by a FieldFillPool
+ * - 2026-10-17: Entropy passes over field memory run in slices on a DissipationScheduler
+ * - 2026-10-17: Field CPU budgets are burned by a CpuBurnExecutor
+ * - 2026-10-17: Portal loads are tracked by ID and expired by a TimerWheel; added
+ *               extendPortalLoad, cancelPortalLoad and getPortalLoadsAPI
+ * - 2026-10-17: Added reset(), an in-place reset behind an epoch barrier that keeps
+ *               worker threads, pools and configuration
+ * - 2026-10-17: Added a generateFissionEvent overload taking the heavy fragment direction
+ * - 2026-10-17: Added configureFragmentYields; fragment pairs come from alias-table yields
+ * - 2026-10-17: Parents come from a NuclideRegistry; added nuclide overloads of the generate
+ *               and simulate calls and a mixed-parent batch that groups events per nuclide
+ * - 2026-10-17: startPortalLoad and extendPortalLoad let governor rejections propagate
+ * - 2026-10-17: startPortalLoad returns 0 when a reset ran while the portal was starting
+ * - 2026-10-17: Mass-only generate and simulate calls resolve their parent by mass number
+ * - 2026-10-17: reset() waits behind an EpochBarrier for in-flight workers and API callers
+ * - 2026-10-17: Added simulateTernaryFissionEvents for count events of one parent
+ * - 2026-10-17: Batch overloads share sampleHeavyDirections
  *
  * Leave-off Context:
  * - Header provides complete interface for simulation engine
@@ -37,13 +63,24 @@
 #include <thread>       // For threading
 #include <condition_variable> // For thread coordination
 #include <queue>        // For event queue
+#include <unordered_map> // For portal loads by ID
 #include <json/json.h>  // For JSON API responses
 
 #include "physics.constants.definitions.h"
 #include "physics.utilities.h"
+#include "profiled.mutex.h"
+#include "memory.governor.h"
+#include "dissipation.scheduler.h"
+#include "cpu.burn.executor.h"
+#include "timer.wheel.h"
+#include "epoch.barrier.h"
+#include "fragment.yields.h"
+#include "nuclide.registry.h"
 
 namespace TernaryFission {
 
+class FieldFillPool;
+
 /**
  * We implement the main ternary fission simulation engine
  * This class manages the complete physics simulation system
@@ -88,6 +125,80 @@ public:
     TernaryFissionEvent simulateTernaryFissionEvent();
     Json::Value simulateTernaryFissionEventAPI(const Json::Value& request);
 
+    /**
+     * Simulate events for registered parents, one symbol ("Cf-252") per event
+     * We generate each nuclide's events as one uniform batch, then process them and
+     * return them in request order
+     *
+     * @param nuclides: Parent symbol of each event
+     * @param excitation_energy: Nuclear excitation energy in MeV
+     * @return: Processed events in the order of nuclides
+     * @throws std::invalid_argument: A symbol is not in the registry; nothing is simulated
+     */
+    std::vector<TernaryFissionEvent> simulateTernaryFissionEvents(const std::vector<std::string>& nuclides,
+                                                                  double excitation_energy);
+    TernaryFissionEvent simulateTernaryFissionEvent(const std::string& nuclide, double excitation_energy);
+
+    /**
+     * Simulate count events of one registered parent
+     * We generate them in a single grouped batch; the nuclide must outlive the call
+     */
+    std::vector<TernaryFissionEvent> simulateTernaryFissionEvents(const Nuclide& nuclide, std::size_t count,
+                                                                  double excitation_energy);
+
+    /**
+     * Generate a ternary fission event without processing it
+     * We create realistic fission events with proper physics; no energy field is
+     * allocated and no engine state is touched, which lets benchmarks measure the
+     * event kernel in isolation
+     *
+     * @param parent_mass: Parent nucleus mass
+     * @param excitation_energy: Nuclear excitation energy
+     * @return: Generated fission event
+     */
+    TernaryFissionEvent generateFissionEvent(double parent_mass, double excitation_energy);
+
+    /**
+     * Generate a fission event with the heavy fragment along a given unit direction
+     * We let generateFissionEvents supply directions drawn with Sampling::fillDirections
+     */
+    TernaryFissionEvent generateFissionEvent(double parent_mass, double excitation_energy,
+                                             const Vector3& heavy_direction);
+
+    /**
+     * Generate a batch of events into caller-owned storage
+     * We reuse the caller's buffer so a steady-state batch performs no heap
+     * allocations; like generateFissionEvent, no engine state is touched
+     *
+     * @param events: Buffer with room for at least count events
+     * @param count: Number of events to generate
+     * @param parent_mass: Parent nucleus mass
+     * @param excitation_energy: Nuclear excitation energy
+     * @return: Number of events written
+     */
+    std::size_t generateFissionEvents(TernaryFissionEvent* events, std::size_t count,
+                                      double parent_mass, double excitation_energy);
+
+    /**
+     * Generate events of one registered parent
+     * We take Z, A, yields and Q constants from the nuclide; it must outlive the call
+     */
+    TernaryFissionEvent generateFissionEvent(const Nuclide& nuclide, double excitation_energy);
+    std::size_t generateFissionEvents(TernaryFissionEvent* events, std::size_t count, const Nuclide& nuclide,
+                                      double excitation_energy);
+
+    /**
+     * Generate a batch that mixes parents
+     * We run the event kernel over one nuclide's events at a time and write each event
+     * to its own slot, so the batch stays allocation-free
+     *
+     * @param parents: Index into registry of each event's parent
+     * @throws std::out_of_range: An index is outside the registry; nothing is generated
+     */
+    std::size_t generateFissionEvents(TernaryFissionEvent* events, const std::size_t* parents,
+                                      std::size_t count, const NuclideRegistry& registry,
+                                      double excitation_energy);
+
     /**
      * Create an energy field with specified energy
      * We allocate computational resources to represent energy
@@ -118,24 +229,47 @@ public:
 
     /**
      * Start a timed portal load at specified power level
-     * We create an energy field load that persists for the given duration
+     * We create an energy field load that persists for the given duration;
+     * additional power stretches the duration by additional / power
      *
      * @param duration_seconds: Duration of the load
      * @param power_level_mev: Energy level in MeV
+     * @param additional_power_mev: Extra energy in MeV held by the same portal
+     * @return: Portal ID, or 0 if a reset ran while the portal was starting
+     * @throws Governor::MemoryBudgetExceeded: The memory governor rejected the field
+     */
+    std::uint64_t startPortalLoad(double duration_seconds, double power_level_mev,
+                                  double additional_power_mev = 0.0);
+
+    /**
+     * Add power to an active portal load
+     * We create a field for the extra energy and push the portal's end out
+     * by duration * additional / power, as for additional power at start
+     *
+     * @param portal_id: Portal to extend
+     * @param additional_power_mev: Extra energy in MeV
+     * @return: False if the portal is not active or a reset ran meanwhile
+     * @throws Governor::MemoryBudgetExceeded: The memory governor rejected the field
      */
-    void startPortalLoad(double duration_seconds, double power_level_mev);
+    bool extendPortalLoad(std::uint64_t portal_id, double additional_power_mev);
 
     /**
-     * Store current portal event state
-     * We record timing and estimated power for status queries
+     * End a portal load early and release its fields
+     *
+     * @return: False if the portal is not active
      */
-    void setPortalEventState(std::chrono::system_clock::time_point start,
-                             std::chrono::system_clock::time_point end,
-                             double estimated_power_mev);
+    bool cancelPortalLoad(std::uint64_t portal_id);
+
+    /**
+     * List active portal loads with their fields and remaining time
+     *
+     * @return: JSON object with portals and timer wheel statistics
+     */
+    Json::Value getPortalLoadsAPI() const;
 
     /**
      * Get current portal event state
-     * We provide estimated power and remaining duration
+     * We sum estimated power over active portals and report the longest remaining duration
      */
     void getPortalEventState(double& estimated_power_mev,
                              int& remaining_seconds) const;
@@ -145,6 +279,153 @@ public:
     Json::Value getSystemStatusAPI() const;
     Json::Value getEnergyFieldsAPI() const;
 
+    /**
+     * Get contention counters for the engine mutexes
+     * We report acquisitions, contended acquisitions and blocked nanoseconds
+     * for state_mutex, queue_mutex, computation_time_mutex and api_mutex
+     *
+     * @return: JSON object keyed by mutex name
+     */
+    Json::Value getLockWaitStatisticsAPI() const;
+
+    /**
+     * Get live object counts and field memory held by the engine
+     * We report active fields, their backing bytes and retained event history
+     *
+     * @return: JSON object with live object counts
+     */
+    Json::Value getMemoryAccountingAPI() const;
+
+    /**
+     * Get measured TSC cycles summed over the active energy fields
+     * We report allocation, encryption and dissipation cycles next to the
+     * nominal energy_mev * cpu_cycles_per_mev budget
+     *
+     * @return: JSON object with per-phase cycle totals
+     */
+    Json::Value getFieldCyclesAPI() const;
+
+    /**
+     * Evict active energy fields to release backing memory
+     * We evict the lowest-energy or oldest fields first, per policy, until at
+     * least bytes_needed are released; the memory governor calls this
+     *
+     * @param bytes_needed: Bytes of field memory to release
+     * @param policy: EvictLowestEnergy or EvictOldest
+     * @param fields_evicted: Set to the number of fields evicted
+     * @return: Bytes released
+     */
+    std::size_t evictEnergyFields(std::size_t bytes_needed, Governor::Policy policy,
+                                  std::size_t& fields_evicted);
+
+    /**
+     * Read a byte range of an active energy field
+     * We regenerate virtual fields outside the state lock and copy
+     * materialized ones under it
+     *
+     * @param field_id: Field to read
+     * @param offset: First byte of the range
+     * @param length: Bytes wanted; clamped to the end of the field
+     * @param out: Receives the bytes
+     * @return: False if no active field has this ID
+     */
+    bool readEnergyFieldBytes(std::uint64_t field_id, std::size_t offset, std::size_t length,
+                              std::string& out) const;
+
+    /**
+     * Configure asynchronous field materialization for fission events
+     * We register event fields as materializing and let the fill pool
+     * allocate and fill them; the previous pool finishes its queue first
+     *
+     * @param threads: Fill threads (0 fills synchronously on the event path)
+     * @param max_in_flight_bytes: Field bytes queued or filling before submitters wait
+     */
+    void configureFieldFill(unsigned threads, std::size_t max_in_flight_bytes);
+
+    /**
+     * Wait until every submitted field has been materialized
+     */
+    void drainFieldFill();
+
+    /**
+     * Get fill pool backlog, completions and latency
+     *
+     * @return: JSON object with fill pool statistics
+     */
+    Json::Value getFieldFillAPI() const;
+    std::string getFieldFillPrometheus() const;
+
+    /**
+     * Configure time-sliced dissipation of field memory
+     * We apply entropy passes in slices under a per-tick byte budget and
+     * a CPU duty cycle derived from cpu_usage_limit_percent
+     *
+     * @param settings: Slice size, tick budget, CPU limit and tick period
+     */
+    void configureDissipation(const DissipationScheduler::Settings& settings);
+
+    /**
+     * Wait until every scheduled entropy pass has been applied
+     */
+    void drainDissipation();
+
+    /**
+     * Get dissipation backlog, throughput and throttling
+     *
+     * @return: JSON object with dissipation scheduler statistics
+     */
+    Json::Value getDissipationAPI() const;
+    std::string getDissipationPrometheus() const;
+
+    /**
+     * Configure burning of field CPU budgets (energy_mev * cpu_cycles_per_mev)
+     * We queue each event field's budget once it is active; 0 threads stops burning
+     *
+     * @param settings: Threads, scheduling policy, CPU limit and unit size
+     */
+    void configureCpuBurn(const CpuBurnExecutor::Settings& settings);
+
+    /**
+     * Wait until every queued CPU budget has been burned or dropped
+     */
+    void drainCpuBurn();
+
+    /**
+     * Get burn progress, budget accuracy and throttling
+     *
+     * @return: JSON object with CPU burn executor statistics
+     */
+    Json::Value getCpuBurnAPI() const;
+    std::string getCpuBurnPrometheus() const;
+
+    /**
+     * Configure fragment yields for the default parent nucleus
+     * We rebuild the nuclide registry with the default parent's yields compiled from the
+     * mass humps, or the tabulated yield file; on error the current registry stays in place
+     *
+     * @param model: Mass humps, charge width and optional yield file
+     * @throws std::invalid_argument, std::runtime_error: The yields could not be built
+     */
+    void configureFragmentYields(const FragmentYieldModel& model);
+
+    /**
+     * Current fragment yields of the default parent; null when none could be built
+     */
+    std::shared_ptr<const FragmentYields> getFragmentYields() const;
+
+    /**
+     * Current nuclide registry; null when the default parent's yields could not be built
+     */
+    std::shared_ptr<const NuclideRegistry> getNuclideRegistry() const;
+
+    /**
+     * Limit the number of fission events retained in simulation state
+     * We trim the oldest events once the history exceeds the limit
+     *
+     * @param max_events: Events to retain (0 keeps none)
+     */
+    void setEventHistoryLimit(std::size_t max_events);
+
     /**
      * Check if simulation is currently running
      * We provide status information for external monitoring
@@ -188,6 +469,19 @@ public:
      */
     void shutdown();
 
+    /**
+     * Reset the engine in place
+     * We stop continuous mode, close the epoch barrier and wait for workers and API
+     * callers already inside the epoch to finish, then discard queued events, advance the
+     * reset epoch and clear fields, history, portals and pool backlogs while threads and
+     * settings stay up. Callers arriving meanwhile wait and run in the new epoch
+     *
+     * @return: JSON summary with the new epoch, what was discarded, the barrier wait and
+     *          the reset time
+     * @throws std::logic_error: Called from inside a guarded engine call
+     */
+    Json::Value reset();
+
     /**
      * Print current system status to console
      * We display comprehensive simulation metrics
@@ -217,26 +511,122 @@ private:
     double total_computation_time_seconds;
 
     // We provide thread-safe computation time tracking
-    mutable std::mutex computation_time_mutex;
+    mutable ProfiledMutex computation_time_mutex{"engine.computation_time_mutex"};
 
     // We maintain thread-safe simulation state
-    mutable std::mutex state_mutex;
+    mutable ProfiledMutex state_mutex{"engine.state_mutex"};
     SimulationState simulation_state;
 
     // We provide thread-safe API request handling
-    mutable std::mutex api_mutex_;
+    mutable ProfiledMutex api_mutex_{"engine.api_mutex"};
     std::uint64_t api_request_counter_;
     bool json_serialization_enabled_;
 
     // We implement thread-safe event queue processing
-    std::mutex queue_mutex;
-    std::condition_variable queue_cv;
-    std::queue<TernaryFissionEvent> event_queue;
+    ProfiledMutex queue_mutex{"engine.queue_mutex"};
+    std::condition_variable_any queue_cv;
+
+    // We stamp queued events so workers can record how long they waited
+    struct QueuedFissionEvent {
+        TernaryFissionEvent event;
+        std::uint64_t queued_ticks;
+        std::uint64_t epoch;                // Reset epoch the event was generated in
+    };
+
+    // We advance the epoch under state_mutex on reset; older events do not commit
+    std::atomic<std::uint64_t> reset_epoch_{0};
+
+    // We count workers and API callers per epoch; reset() waits for them before swapping state
+    EpochBarrier epoch_barrier_{"engine.epoch_barrier"};
+    std::queue<QueuedFissionEvent> event_queue;
+
+    // We bound retained event history so long runs stay flat
+    static constexpr std::size_t kDefaultEventHistoryLimit = 10000;
+    std::size_t event_history_limit_ = kDefaultEventHistoryLimit;
+
+    // We fill event fields off the event path; accessed with std::atomic_load/store
+    static constexpr unsigned kDefaultFieldFillThreads = 2;
+    static constexpr std::size_t kDefaultFieldFillInFlightBytes = 1024ULL * 1024 * 1024;
+    std::shared_ptr<FieldFillPool> field_fill_pool_;
+
+    // We look parents up in this registry; accessed with std::atomic_load/store. Calls that
+    // pass only a parent mass resolve it by A and get the default element when nothing matches
+    static constexpr int kDefaultParentAtomicNumber = 92;
+    std::shared_ptr<const NuclideRegistry> nuclides_;
+
+    /**
+     * Generate an event for a registered parent
+     * We fall back to the legacy mass ratio and the default element when nuclide is null
+     */
+    TernaryFissionEvent generateFissionEvent(double parent_mass, double excitation_energy,
+                                             const Vector3& heavy_direction, const Nuclide* nuclide);
+
+    // We apply entropy passes over field memory in slices off the update path
+    std::unique_ptr<DissipationScheduler> dissipation_scheduler_;
+
+    /**
+     * Apply one entropy slice to a field under state_mutex
+     *
+     * @return: False if no active field with this ID holds memory
+     */
+    bool dissipateFieldSlice(std::uint64_t field_id, std::size_t offset, std::size_t length);
+
+    // We spend field CPU budgets as real work on idle-priority threads
+    std::unique_ptr<CpuBurnExecutor> cpu_burn_executor_;
+
+    /**
+     * Queue an active field's CPU budget with the burn executor, if enabled
+     */
+    void submitFieldBurn(const EnergyField& field);
+
+    /**
+     * Charge one burned unit to a field under state_mutex
+     *
+     * @return: False if the field is gone
+     */
+    bool chargeFieldBurn(std::uint64_t field_id, std::uint64_t cycles);
+
+    /**
+     * Install a field materialized by the fill pool
+     * We release it instead if the field was removed while it was filling
+     *
+     * @param field: Materialized field
+     * @param rejected: The memory governor refused the field
+     */
+    void completeFieldMaterialization(EnergyField& field, bool rejected);
+
+    // We track portal loads by ID; the timer wheel expires them from one thread
+    struct PortalLoad {
+        std::vector<std::uint64_t> field_ids;
+        double duration_seconds;            // Duration before additional power
+        double power_level_mev;
+        double additional_power_mev;
+        std::chrono::system_clock::time_point start;
+        std::chrono::steady_clock::time_point steady_start;
+        std::chrono::steady_clock::time_point deadline;
+    };
+    static constexpr std::chrono::milliseconds kPortalTimerTick{100};
+    static constexpr std::size_t kPortalTimerSlots = 1024;
+    mutable ProfiledMutex portal_mutex_{"engine.portal_mutex"};
+    std::unordered_map<std::uint64_t, PortalLoad> portal_loads_;
+    std::uint64_t next_portal_id_ = 1;
+    std::unique_ptr<TimerWheel> portal_timers_;
+
+    /**
+     * Scheduled duration of a portal including its additional power
+     */
+    static double portalDurationSeconds(const PortalLoad& portal);
 
-    // Portal event state tracking
-    std::chrono::system_clock::time_point portal_start_time_;
-    std::chrono::system_clock::time_point portal_end_time_;
-    double portal_estimated_power_mev_ = 0.0;
+    /**
+     * Timer wheel callback: remove an expired portal and its fields
+     * We ignore the timer if the portal was extended after it fired
+     */
+    void expirePortalLoad(std::uint64_t portal_id);
+
+    /**
+     * Remove fields by ID from engine state and release their memory
+     */
+    void removeEnergyFields(const std::vector<std::uint64_t>& field_ids);
 
     /**
      * Serialize fission event to JSON
@@ -256,23 +646,30 @@ private:
      */
     Json::Value serializeEnergyFieldToJSON(const EnergyField& field) const;
 
-    /**
-     * Generate a ternary fission event (private method)
-     * We create realistic fission events with proper physics
-     *
-     * @param parent_mass: Parent nucleus mass
-     * @param excitation_energy: Nuclear excitation energy
-     * @return: Generated fission event
-     */
-    TernaryFissionEvent generateFissionEvent(double parent_mass, double excitation_energy);
-
     /**
      * Process a fission event (private method)
      * We handle event processing and energy field creation
      *
      * @param event: Fission event to process
+     * @param epoch: Reset epoch the event was generated in
+     * @return: False if a reset since then discarded the event
+     */
+    bool processFissionEvent(const TernaryFissionEvent& event, std::uint64_t epoch);
+
+    /**
+     * Draw count heavy fragment directions a chunk at a time on the stack (private method)
+     * We hand each one to sample(i, direction) for i in [0, count), so every batch overload
+     * shares one allocation-free Sampling::fillDirections loop
+     */
+    template <typename SampleFn>
+    static void sampleHeavyDirections(std::size_t count, SampleFn&& sample);
+
+    /**
+     * Process a generated batch and account for it (private method)
+     * We count the events that committed and add the time since start_time
      */
-    void processFissionEvent(const TernaryFissionEvent& event);
+    void processFissionEvents(const std::vector<TernaryFissionEvent>& events, std::uint64_t epoch,
+                              std::chrono::high_resolution_clock::time_point start_time);
 
     /**
      * Worker thread function (private method)
@@ -0,0 +1,110 @@
+/*
+ * File: include/timer.wheel.h
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Timer Wheel - One-Thread Deadline Scheduling
+ * Purpose: Runs many long-lived timers (portal loads) from a single thread with O(1)
+ *          schedule, reschedule and cancel
+ * Reason: A sleeping std::thread per portal trigger meant a thousand threads for a
+ *         thousand concurrent portals
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ * - 2026-10-17: clear() disarms every timer without stopping the thread
+ *
+ * Carry-over Context:
+ * - Hashed wheel: a timer lands in slot (deadline tick % slots) and fires when the wheel
+ *   reaches its deadline tick, so deadlines beyond one rotation wait extra rounds
+ * - Rescheduling bumps the timer's generation; the copy left in its old slot is
+ *   recognised as stale and discarded when that slot comes up
+ * - Callbacks run on the wheel thread without the wheel lock held, so they may schedule
+ *   or cancel timers; they should not block for long since they delay later slots
+ * - Timers fire no earlier than their deadline and at most one tick late under load
+ */
+
+#ifndef TERNARY_FISSION_TIMER_WHEEL_H
+#define TERNARY_FISSION_TIMER_WHEEL_H
+
+#include <json/json.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace TernaryFission {
+
+class TimerWheel {
+public:
+    using Callback = std::function<void(std::uint64_t timer_id)>;
+
+    TimerWheel(std::chrono::milliseconds tick, std::size_t slots, Callback callback);
+    ~TimerWheel();
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    /*
+     * Arm a timer to fire after delay; an armed timer with this ID is moved instead
+     */
+    void schedule(std::uint64_t timer_id, std::chrono::milliseconds delay);
+
+    /*
+     * Disarm a timer; false if it was not armed (never scheduled or already fired)
+     */
+    bool cancel(std::uint64_t timer_id);
+
+    /*
+     * Disarm every timer; the thread keeps running
+     *
+     * @return: Timers disarmed
+     */
+    std::size_t clear();
+
+    /*
+     * Stop the wheel thread; armed timers are discarded without firing
+     */
+    void stop();
+
+    std::size_t pending() const;
+    Json::Value statsToJson() const;
+
+private:
+    struct Timer {
+        std::uint64_t deadline_tick;
+        std::uint64_t generation;
+    };
+
+    void threadLoop();
+    std::uint64_t ticksSinceStart(std::chrono::steady_clock::time_point when) const;
+
+    const std::chrono::milliseconds tick_;
+    const Callback callback_;
+    const std::chrono::steady_clock::time_point start_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::unordered_map<std::uint64_t, Timer> timers_;
+    std::vector<std::vector<std::pair<std::uint64_t, std::uint64_t>>> slots_;  // (timer_id, generation)
+    std::uint64_t current_tick_ = 0;        // Last tick processed
+    std::uint64_t next_generation_ = 1;
+    bool stopping_ = false;
+    std::thread thread_;
+
+    std::atomic<std::uint64_t> scheduled_{0};
+    std::atomic<std::uint64_t> rescheduled_{0};
+    std::atomic<std::uint64_t> cancelled_{0};
+    std::atomic<std::uint64_t> fired_{0};
+    std::atomic<std::uint64_t> max_lateness_us_{0};
+};
+
+} // namespace TernaryFission
+
+#endif // TERNARY_FISSION_TIMER_WHEEL_H
@@ -0,0 +1,112 @@
+/*
+ * File: include/trace.ring.h
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Per-Thread Trace Ring Buffers - Scoped Spans with Chrome Trace Export
+ * Purpose: Records named spans with cycle-clock timestamps into per-thread lock-free rings
+ * Reason: We need to see where a slow request spent its time (JSON, locks, field
+ *         allocation, AES) without attaching an external profiler
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation with runtime toggle and Chrome trace-event export
+ *
+ * Carry-over Context:
+ * - TF_TRACE_SCOPE("name", "category") costs one relaxed load and a predictable
+ *   branch when tracing is disabled
+ * - Names and categories must be string literals (we store the pointers)
+ * - Each thread writes only its own ring; slots carry a sequence number so a dump
+ *   taken while tracing is active skips slots that are being overwritten
+ * - Rings outlive their threads so spans from finished threads are still dumped
+ */
+
+#ifndef TERNARY_FISSION_TRACE_RING_H
+#define TERNARY_FISSION_TRACE_RING_H
+
+#include "cycle.clock.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace TernaryFission {
+namespace Trace {
+
+// We keep the enable flag global so the disabled check is a single load
+extern std::atomic<bool> g_tracing_enabled;
+
+inline bool isEnabled() {
+    return g_tracing_enabled.load(std::memory_order_relaxed);
+}
+
+/*
+ * Enable or disable span recording process-wide; enabling calibrates the cycle clock
+ */
+void setEnabled(bool enabled);
+
+/*
+ * Flip the tracing state and return the new state (async-signal-safe)
+ */
+bool toggle();
+
+/*
+ * Record a completed span on the calling thread's ring
+ */
+void recordSpan(const char* name, const char* category, std::uint64_t start_ticks, std::uint64_t end_ticks);
+
+/*
+ * Discard all recorded spans
+ */
+void clear();
+
+/*
+ * Number of spans per thread ring (fixed at first use)
+ */
+std::size_t ringCapacity();
+
+/*
+ * Serialize all retained spans as Chrome trace-event JSON
+ * The output loads in chrome://tracing and ui.perfetto.dev
+ */
+std::string dumpChromeTrace();
+
+/*
+ * Write dumpChromeTrace() to a file; returns false on I/O error
+ */
+bool writeChromeTrace(const std::string& path);
+
+/*
+ * Scoped span; records on destruction only if tracing was enabled on entry
+ */
+class Scope {
+public:
+    Scope(const char* name, const char* category) : name_(name), category_(category), start_(0) {
+        if (isEnabled()) {
+            start_ = CycleClock::now();
+        }
+    }
+
+    ~Scope() {
+        if (start_ != 0) {
+            recordSpan(name_, category_, start_, CycleClock::now());
+        }
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    const char* name_;
+    const char* category_;
+    std::uint64_t start_;
+};
+
+} // namespace Trace
+} // namespace TernaryFission
+
+#define TF_TRACE_CONCAT_INNER(a, b) a##b
+#define TF_TRACE_CONCAT(a, b) TF_TRACE_CONCAT_INNER(a, b)
+#define TF_TRACE_SCOPE(name, category) \
+    ::TernaryFission::Trace::Scope TF_TRACE_CONCAT(tf_trace_scope_, __COUNTER__)(name, category)
+
+#endif // TERNARY_FISSION_TRACE_RING_H
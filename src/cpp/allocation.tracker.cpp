@@ -0,0 +1,264 @@
+/*
+ * File: src/cpp/allocation.tracker.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Allocation Tracker - Global operator new/delete Hooks and Scope Registry
+ * Purpose: Implements the counting allocation hooks, scope registry and JSON export
+ * Reason: We report allocations per request (X-Alloc-* headers) and per scope at
+ *         /api/v1/profile/allocations
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ *
+ * Carry-over Context:
+ * - The replacement operators are compiled only with TERNARY_ALLOC_TRACKING; the
+ *   registry and JSON export always exist so callers need no #ifdefs
+ * - Hooks touch only constant-initialized thread_local state and fixed atomics, so
+ *   they never allocate or recurse and work during static initialization
+ */
+
+#include "allocation.tracker.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+#ifdef MACOS
+#include <malloc/malloc.h>
+#else
+#include <malloc.h>
+#endif
+
+namespace TernaryFission {
+namespace Alloc {
+
+namespace {
+
+struct ThreadState {
+    ThreadCounters counters;
+    ScopeStats* scope = nullptr;
+};
+
+thread_local ThreadState t_state;
+
+ScopeStats g_unscoped;
+ScopeStats g_overflow;
+ScopeStats g_scopes[kMaxAllocationScopes];
+std::size_t g_scope_count = 0;
+std::mutex g_scope_mutex;
+
+Json::Value statsToJson(const ScopeStats& stats) {
+    Json::Value json;
+    json["allocations"] = static_cast<Json::UInt64>(stats.allocations.load(std::memory_order_relaxed));
+    json["frees"] = static_cast<Json::UInt64>(stats.frees.load(std::memory_order_relaxed));
+    json["bytes_allocated"] = static_cast<Json::UInt64>(stats.bytes_allocated.load(std::memory_order_relaxed));
+    json["bytes_freed"] = static_cast<Json::UInt64>(stats.bytes_freed.load(std::memory_order_relaxed));
+    return json;
+}
+
+void resetStats(ScopeStats& stats) {
+    stats.allocations.store(0, std::memory_order_relaxed);
+    stats.frees.store(0, std::memory_order_relaxed);
+    stats.bytes_allocated.store(0, std::memory_order_relaxed);
+    stats.bytes_freed.store(0, std::memory_order_relaxed);
+}
+
+#ifdef TERNARY_ALLOC_TRACKING
+
+std::size_t usableSize(void* pointer) {
+#ifdef MACOS
+    return malloc_size(pointer);
+#else
+    return malloc_usable_size(pointer);
+#endif
+}
+
+void recordAllocation(void* pointer) {
+    std::size_t bytes = usableSize(pointer);
+    ThreadState& state = t_state;
+    state.counters.allocations++;
+    state.counters.bytes_allocated += bytes;
+    ScopeStats& scope = state.scope ? *state.scope : g_unscoped;
+    scope.allocations.fetch_add(1, std::memory_order_relaxed);
+    scope.bytes_allocated.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void recordFree(void* pointer) {
+    std::size_t bytes = usableSize(pointer);
+    ThreadState& state = t_state;
+    state.counters.frees++;
+    state.counters.bytes_freed += bytes;
+    ScopeStats& scope = state.scope ? *state.scope : g_unscoped;
+    scope.frees.fetch_add(1, std::memory_order_relaxed);
+    scope.bytes_freed.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+/*
+ * We follow the standard operator new contract: retry through the new_handler,
+ * then report failure to the caller
+ */
+void* allocate(std::size_t size, std::size_t alignment) {
+    if (size == 0) {
+        size = 1;
+    }
+    for (;;) {
+        void* pointer = nullptr;
+        if (alignment <= alignof(std::max_align_t)) {
+            pointer = std::malloc(size);
+        } else if (posix_memalign(&pointer, alignment, size) != 0) {
+            pointer = nullptr;
+        }
+        if (pointer) {
+            recordAllocation(pointer);
+            return pointer;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) {
+            return nullptr;
+        }
+        handler();
+    }
+}
+
+void deallocate(void* pointer) {
+    if (pointer) {
+        recordFree(pointer);
+        std::free(pointer);
+    }
+}
+
+#endif // TERNARY_ALLOC_TRACKING
+
+} // namespace
+
+ThreadCounters threadCounters() {
+    return t_state.counters;
+}
+
+ScopeStats& scopeStats(const char* name) {
+    std::lock_guard<std::mutex> lock(g_scope_mutex);
+    for (std::size_t i = 0; i < g_scope_count; ++i) {
+        if (std::strcmp(g_scopes[i].name, name) == 0) {
+            return g_scopes[i];
+        }
+    }
+    if (g_scope_count == kMaxAllocationScopes) {
+        return g_overflow;
+    }
+    g_scopes[g_scope_count].name = name;
+    return g_scopes[g_scope_count++];
+}
+
+Json::Value allocationsToJson() {
+    Json::Value scopes(Json::objectValue);
+    std::uint64_t totals[4] = {0, 0, 0, 0};
+    auto add = [&scopes, &totals](const char* name, const ScopeStats& stats) {
+        Json::Value json = statsToJson(stats);
+        totals[0] += json["allocations"].asUInt64();
+        totals[1] += json["frees"].asUInt64();
+        totals[2] += json["bytes_allocated"].asUInt64();
+        totals[3] += json["bytes_freed"].asUInt64();
+        if (json["allocations"].asUInt64() > 0 || json["frees"].asUInt64() > 0) {
+            scopes[name] = json;
+        }
+    };
+
+    {
+        std::lock_guard<std::mutex> lock(g_scope_mutex);
+        for (std::size_t i = 0; i < g_scope_count; ++i) {
+            add(g_scopes[i].name, g_scopes[i]);
+        }
+    }
+    add("unscoped", g_unscoped);
+    add("other", g_overflow);
+
+    Json::Value json;
+    json["enabled"] = kTrackingCompiledIn;
+    json["totals"]["allocations"] = static_cast<Json::UInt64>(totals[0]);
+    json["totals"]["frees"] = static_cast<Json::UInt64>(totals[1]);
+    json["totals"]["bytes_allocated"] = static_cast<Json::UInt64>(totals[2]);
+    json["totals"]["bytes_freed"] = static_cast<Json::UInt64>(totals[3]);
+    json["scopes"] = scopes;
+    return json;
+}
+
+void resetAllocations() {
+    std::lock_guard<std::mutex> lock(g_scope_mutex);
+    for (std::size_t i = 0; i < g_scope_count; ++i) {
+        resetStats(g_scopes[i]);
+    }
+    resetStats(g_unscoped);
+    resetStats(g_overflow);
+}
+
+Scope::Scope(ScopeStats& stats) : previous_(t_state.scope) {
+    t_state.scope = &stats;
+}
+
+Scope::~Scope() {
+    t_state.scope = previous_;
+}
+
+} // namespace Alloc
+} // namespace TernaryFission
+
+#ifdef TERNARY_ALLOC_TRACKING
+
+using TernaryFission::Alloc::allocate;
+using TernaryFission::Alloc::deallocate;
+
+void* operator new(std::size_t size) {
+    void* pointer = allocate(size, 0);
+    if (!pointer) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size, 0);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size, 0);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    void* pointer = allocate(size, static_cast<std::size_t>(alignment));
+    if (!pointer) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return operator new(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* pointer) noexcept { deallocate(pointer); }
+void operator delete[](void* pointer) noexcept { deallocate(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { deallocate(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { deallocate(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { deallocate(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { deallocate(pointer); }
+void operator delete(void* pointer, std::align_val_t) noexcept { deallocate(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { deallocate(pointer); }
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept { deallocate(pointer); }
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept { deallocate(pointer); }
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { deallocate(pointer); }
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { deallocate(pointer); }
+
+#endif // TERNARY_ALLOC_TRACKING
@@ -14,6 +14,22 @@
  *             Added physics parameter validation against theoretical
  * constraints Integrated environment variable override processing Added
  * comprehensive error handling and validation reporting
+ * 2026-10-17: Environment overrides are re-applied after loading the file so
+ *             TERNARY_* variables (and CLI bind overrides) win over file values
+ * 2026-10-17: slow_request_threshold_ms (TERNARY_SLOW_REQUEST_THRESHOLD_MS)
+ *             for the HTTP slow-request log
+ * 2026-10-17: flight_recorder_enabled and flight_recorder_directory
+ * 2026-10-17: max_memory_usage, memory_usage_limit, memory_governor_policy and
+ *             memory high/low watermarks for the field memory governor
+ * 2026-10-17: virtual_energy_fields (TERNARY_VIRTUAL_ENERGY_FIELDS)
+ * 2026-10-17: field_fill_threads and field_fill_max_in_flight_bytes for the
+ *             asynchronous field fill pool
+ * 2026-10-17: cpu_usage_limit, dissipation_slice_bytes and
+ *             dissipation_bytes_per_tick for the dissipation scheduler
+ * 2026-10-17: cpu_burn_threads, cpu_burn_policy and cpu_burn_limit for the
+ *             CPU burn executor
+ * 2026-10-17: light/heavy_fragment_mean/sigma, fragment_charge_sigma and
+ *             fragment_yield_file for the fragment yield tables
  *
  * Carry-over Context:
  * - This implementation supports the HTTP daemon functionality outlined in
@@ -28,6 +44,8 @@
 
 #include "config.ternary.fission.server.h"
 #include "physics.constants.definitions.h"
+#include "memory.governor.h"
+#include "cpu.burn.executor.h"
 #include <algorithm>
 #include <arpa/inet.h>
 #include <cctype>
@@ -108,6 +126,9 @@ bool ConfigurationManager::loadConfiguration() {
     return false;
   }
 
+  // We re-apply environment overrides so they take precedence over the file
+  processEnvironmentOverrides();
+
   // We validate all configuration sections
   bool validation_success = validateConfiguration();
   configuration_valid_ = validation_success;
@@ -332,6 +353,42 @@ bool ConfigurationManager::parsePhysicsConfiguration() {
   physics_config_.events_per_second = getConfigDouble("events_per_second", 5.0);
   physics_config_.max_events_per_request =
       getConfigInt("max_events_per_request", 100000);
+  physics_config_.max_memory_usage = static_cast<std::uint64_t>(
+      getConfigDouble("max_memory_usage", 8589934592.0));
+  physics_config_.memory_usage_limit =
+      getConfigDouble("memory_usage_limit", 75.0);
+  physics_config_.memory_governor_policy =
+      getConfigValue("memory_governor_policy", "reject");
+  physics_config_.memory_high_watermark =
+      getConfigDouble("memory_high_watermark", 0.90);
+  physics_config_.memory_low_watermark =
+      getConfigDouble("memory_low_watermark", 0.75);
+  physics_config_.virtual_energy_fields =
+      getConfigBool("virtual_energy_fields", false);
+  physics_config_.field_fill_threads = getConfigInt("field_fill_threads", 2);
+  physics_config_.field_fill_max_in_flight_bytes = static_cast<std::uint64_t>(
+      getConfigDouble("field_fill_max_in_flight_bytes", 1073741824.0));
+  physics_config_.cpu_usage_limit = getConfigDouble("cpu_usage_limit", 80.0);
+  physics_config_.dissipation_slice_bytes = static_cast<std::uint64_t>(
+      getConfigDouble("dissipation_slice_bytes", 2097152.0));
+  physics_config_.dissipation_bytes_per_tick = static_cast<std::uint64_t>(
+      getConfigDouble("dissipation_bytes_per_tick", 67108864.0));
+  physics_config_.cpu_burn_threads = getConfigInt("cpu_burn_threads", 0);
+  physics_config_.cpu_burn_policy =
+      getConfigValue("cpu_burn_policy", "energy_weighted");
+  physics_config_.cpu_burn_limit = getConfigDouble("cpu_burn_limit", 50.0);
+  physics_config_.light_fragment_mean =
+      getConfigDouble("light_fragment_mean", 95.0);
+  physics_config_.light_fragment_sigma =
+      getConfigDouble("light_fragment_sigma", 5.0);
+  physics_config_.heavy_fragment_mean =
+      getConfigDouble("heavy_fragment_mean", 140.0);
+  physics_config_.heavy_fragment_sigma =
+      getConfigDouble("heavy_fragment_sigma", 8.0);
+  physics_config_.fragment_charge_sigma =
+      getConfigDouble("fragment_charge_sigma", 0.56);
+  physics_config_.fragment_yield_file =
+      getConfigValue("fragment_yield_file", "");
 
   return true;
 }
@@ -360,6 +417,12 @@ bool ConfigurationManager::parseLoggingConfiguration() {
   logging_config_.verbose_output = getConfigBool("verbose_output", false);
   logging_config_.log_timestamp_format =
       getConfigValue("log_timestamp_format", "%Y-%m-%d %H:%M:%S");
+  logging_config_.slow_request_threshold_ms =
+      getConfigInt("slow_request_threshold_ms", 500);
+  logging_config_.flight_recorder_enabled =
+      getConfigBool("flight_recorder_enabled", true);
+  logging_config_.flight_recorder_directory =
+      getConfigValue("flight_recorder_directory", "logs");
 
   return true;
 }
@@ -579,6 +642,85 @@ bool ConfigurationManager::validatePhysicsConfiguration() {
     valid = false;
   }
 
+  // We validate the field memory governor (0 disables either cap)
+  if (physics_config_.memory_usage_limit < 0.0 ||
+      physics_config_.memory_usage_limit > 100.0) {
+    addValidationError("Invalid memory usage limit: " +
+                       std::to_string(physics_config_.memory_usage_limit));
+    valid = false;
+  }
+
+  Governor::Policy policy;
+  if (!Governor::parsePolicy(physics_config_.memory_governor_policy, policy)) {
+    addValidationError("Invalid memory governor policy: " +
+                       physics_config_.memory_governor_policy);
+    valid = false;
+  }
+
+  if (physics_config_.memory_low_watermark <= 0.0 ||
+      physics_config_.memory_low_watermark >
+          physics_config_.memory_high_watermark ||
+      physics_config_.memory_high_watermark > 1.0) {
+    addValidationError(
+        "Invalid memory watermarks: " +
+        std::to_string(physics_config_.memory_low_watermark) + " - " +
+        std::to_string(physics_config_.memory_high_watermark));
+    valid = false;
+  }
+
+  // We validate the field fill pool (0 threads fills on the event path)
+  if (physics_config_.field_fill_threads < 0 ||
+      physics_config_.field_fill_threads > 256) {
+    addValidationError("Invalid field fill threads: " +
+                       std::to_string(physics_config_.field_fill_threads));
+    valid = false;
+  }
+
+  // We validate the dissipation CPU cap and slice sizes
+  if (physics_config_.cpu_usage_limit < 0.0 ||
+      physics_config_.cpu_usage_limit > 100.0) {
+    addValidationError("Invalid CPU usage limit: " +
+                       std::to_string(physics_config_.cpu_usage_limit));
+    valid = false;
+  }
+
+  if (physics_config_.dissipation_slice_bytes < 4096 ||
+      physics_config_.dissipation_bytes_per_tick < physics_config_.dissipation_slice_bytes) {
+    addValidationError("Invalid dissipation slice sizes: slice " +
+                       std::to_string(physics_config_.dissipation_slice_bytes) + ", tick " +
+                       std::to_string(physics_config_.dissipation_bytes_per_tick));
+    valid = false;
+  }
+
+  // We validate the CPU burn executor
+  CpuBurnExecutor::Policy burn_policy;
+  if (!CpuBurnExecutor::parsePolicy(physics_config_.cpu_burn_policy, burn_policy)) {
+    addValidationError("Invalid CPU burn policy: " +
+                       physics_config_.cpu_burn_policy);
+    valid = false;
+  }
+
+  if (physics_config_.cpu_burn_threads < 0 ||
+      physics_config_.cpu_burn_threads > 256 ||
+      physics_config_.cpu_burn_limit < 0.0 ||
+      physics_config_.cpu_burn_limit > 100.0) {
+    addValidationError("Invalid CPU burn settings: threads " +
+                       std::to_string(physics_config_.cpu_burn_threads) + ", limit " +
+                       std::to_string(physics_config_.cpu_burn_limit));
+    valid = false;
+  }
+
+  // We validate the fragment yield humps; a yield file is checked when it is loaded
+  if (physics_config_.light_fragment_sigma <= 0.0 ||
+      physics_config_.heavy_fragment_sigma <= 0.0 ||
+      physics_config_.fragment_charge_sigma <= 0.0) {
+    addValidationError("Invalid fragment yield widths: light " +
+                       std::to_string(physics_config_.light_fragment_sigma) + ", heavy " +
+                       std::to_string(physics_config_.heavy_fragment_sigma) + ", charge " +
+                       std::to_string(physics_config_.fragment_charge_sigma));
+    valid = false;
+  }
+
   // We validate maximum events per request
   if (physics_config_.max_events_per_request < 1 ||
       physics_config_.max_events_per_request > 10000000) {
@@ -636,6 +778,21 @@ bool ConfigurationManager::validateLoggingConfiguration() {
     valid = false;
   }
 
+  // We validate the flight recorder dump directory
+  if (logging_config_.flight_recorder_directory.empty()) {
+    addValidationError("Flight recorder directory cannot be empty");
+    valid = false;
+  }
+
+  // We validate slow request threshold (0 disables the slow-request log)
+  if (logging_config_.slow_request_threshold_ms < 0 ||
+      logging_config_.slow_request_threshold_ms > 3600000) {
+    addValidationError(
+        "Invalid slow request threshold: " +
+        std::to_string(logging_config_.slow_request_threshold_ms));
+    valid = false;
+  }
+
   return valid;
 }
 
@@ -711,6 +868,81 @@ void ConfigurationManager::processEnvironmentOverrides() {
     physics_config_.events_per_second = std::stod(env_events_per_second);
   }
 
+  std::string env_max_memory_usage =
+      getEnvironmentVariable("TERNARY_MAX_MEMORY_USAGE");
+  if (!env_max_memory_usage.empty()) {
+    physics_config_.max_memory_usage = std::stoull(env_max_memory_usage);
+  }
+
+  std::string env_memory_usage_limit =
+      getEnvironmentVariable("TERNARY_MEMORY_USAGE_LIMIT");
+  if (!env_memory_usage_limit.empty()) {
+    physics_config_.memory_usage_limit = std::stod(env_memory_usage_limit);
+  }
+
+  std::string env_memory_governor_policy =
+      getEnvironmentVariable("TERNARY_MEMORY_GOVERNOR_POLICY");
+  if (!env_memory_governor_policy.empty()) {
+    physics_config_.memory_governor_policy = env_memory_governor_policy;
+  }
+
+  std::string env_virtual_energy_fields =
+      getEnvironmentVariable("TERNARY_VIRTUAL_ENERGY_FIELDS");
+  if (!env_virtual_energy_fields.empty()) {
+    physics_config_.virtual_energy_fields =
+        (env_virtual_energy_fields == "true" || env_virtual_energy_fields == "1");
+  }
+
+  std::string env_field_fill_threads =
+      getEnvironmentVariable("TERNARY_FIELD_FILL_THREADS");
+  if (!env_field_fill_threads.empty()) {
+    physics_config_.field_fill_threads = std::stoi(env_field_fill_threads);
+  }
+
+  std::string env_field_fill_max_in_flight_bytes =
+      getEnvironmentVariable("TERNARY_FIELD_FILL_MAX_IN_FLIGHT_BYTES");
+  if (!env_field_fill_max_in_flight_bytes.empty()) {
+    physics_config_.field_fill_max_in_flight_bytes =
+        std::stoull(env_field_fill_max_in_flight_bytes);
+  }
+
+  std::string env_cpu_usage_limit = getEnvironmentVariable("TERNARY_CPU_USAGE_LIMIT");
+  if (!env_cpu_usage_limit.empty()) {
+    physics_config_.cpu_usage_limit = std::stod(env_cpu_usage_limit);
+  }
+
+  std::string env_dissipation_slice_bytes =
+      getEnvironmentVariable("TERNARY_DISSIPATION_SLICE_BYTES");
+  if (!env_dissipation_slice_bytes.empty()) {
+    physics_config_.dissipation_slice_bytes = std::stoull(env_dissipation_slice_bytes);
+  }
+
+  std::string env_dissipation_bytes_per_tick =
+      getEnvironmentVariable("TERNARY_DISSIPATION_BYTES_PER_TICK");
+  if (!env_dissipation_bytes_per_tick.empty()) {
+    physics_config_.dissipation_bytes_per_tick = std::stoull(env_dissipation_bytes_per_tick);
+  }
+
+  std::string env_cpu_burn_threads = getEnvironmentVariable("TERNARY_CPU_BURN_THREADS");
+  if (!env_cpu_burn_threads.empty()) {
+    physics_config_.cpu_burn_threads = std::stoi(env_cpu_burn_threads);
+  }
+
+  std::string env_cpu_burn_policy = getEnvironmentVariable("TERNARY_CPU_BURN_POLICY");
+  if (!env_cpu_burn_policy.empty()) {
+    physics_config_.cpu_burn_policy = env_cpu_burn_policy;
+  }
+
+  std::string env_cpu_burn_limit = getEnvironmentVariable("TERNARY_CPU_BURN_LIMIT");
+  if (!env_cpu_burn_limit.empty()) {
+    physics_config_.cpu_burn_limit = std::stod(env_cpu_burn_limit);
+  }
+
+  std::string env_fragment_yield_file = getEnvironmentVariable("TERNARY_FRAGMENT_YIELD_FILE");
+  if (!env_fragment_yield_file.empty()) {
+    physics_config_.fragment_yield_file = env_fragment_yield_file;
+  }
+
   // We process logging configuration overrides
   std::string env_log_level = getEnvironmentVariable("TERNARY_LOG_LEVEL");
   if (!env_log_level.empty()) {
@@ -724,6 +956,27 @@ void ConfigurationManager::processEnvironmentOverrides() {
         (env_verbose_output == "true" || env_verbose_output == "1");
   }
 
+  std::string env_slow_request_threshold =
+      getEnvironmentVariable("TERNARY_SLOW_REQUEST_THRESHOLD_MS");
+  if (!env_slow_request_threshold.empty()) {
+    logging_config_.slow_request_threshold_ms =
+        std::stoi(env_slow_request_threshold);
+  }
+
+  std::string env_flight_recorder_enabled =
+      getEnvironmentVariable("TERNARY_FLIGHT_RECORDER_ENABLED");
+  if (!env_flight_recorder_enabled.empty()) {
+    logging_config_.flight_recorder_enabled =
+        (env_flight_recorder_enabled == "true" ||
+         env_flight_recorder_enabled == "1");
+  }
+
+  std::string env_flight_recorder_directory =
+      getEnvironmentVariable("TERNARY_FLIGHT_RECORDER_DIRECTORY");
+  if (!env_flight_recorder_directory.empty()) {
+    logging_config_.flight_recorder_directory = env_flight_recorder_directory;
+  }
+
   // We process media streaming overrides
   std::string env_streaming_enabled =
       getEnvironmentVariable("TERNARY_MEDIA_STREAMING_ENABLED");
@@ -15,6 +15,10 @@
  *             Added platform-specific process management for macOS, Ubuntu, and Debian
  *             Implemented resource monitoring with CPU, memory, and FD tracking
  *             Added systemd integration support with proper service lifecycle
+ * 2026-10-17: SIGUSR1 toggles span tracing; stopping it writes a Chrome trace next
+ *             to the debug log from the resource monitor thread
+ * 2026-10-17: Flight recorder watchdog runs with the daemon; SIGUSR2 also
+ *             requests a flight dump
  *
  * Carry-over Context:
  * - This implementation provides complete Unix daemon functionality for production deployment
@@ -27,6 +31,8 @@
  */
 
 #include "daemon.ternary.fission.server.h"
+#include "trace.ring.h"
+#include "flight.recorder.h"
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -130,7 +136,8 @@ DaemonTernaryFissionServer::DaemonTernaryFissionServer(std::unique_ptr<Configura
     , log_rotation_enabled_(true)
     , log_rotation_active_(false)
     , resource_monitoring_(false)
-    , monitoring_interval_(std::chrono::seconds(10)) {
+    , monitoring_interval_(std::chrono::seconds(10))
+    , trace_dump_pending_(false) {
     
     // We set static instance for signal handling
     instance_ = this;
@@ -333,6 +340,17 @@ bool DaemonTernaryFissionServer::startDaemon() {
         log_rotation_thread_ = std::thread(&DaemonTernaryFissionServer::logRotationWorker, this);
     }
     
+    // We calibrate the cycle clock now so SIGUSR1 tracing never calibrates in signal context
+    CycleClock::epoch();
+
+    // We start the flight recorder watchdog after forking so the thread survives
+    auto logging_config = config_manager_->getLoggingConfig();
+    Flight::setEnabled(logging_config.flight_recorder_enabled);
+    Flight::setDumpDirectory(logging_config.flight_recorder_directory);
+    if (Flight::isEnabled()) {
+        Flight::startWatchdog();
+    }
+
     resource_monitoring_ = true;
     resource_monitor_thread_ = std::thread(&DaemonTernaryFissionServer::resourceMonitorWorker, this);
     
@@ -367,6 +385,8 @@ void DaemonTernaryFissionServer::stopDaemon() {
     if (log_rotation_thread_.joinable()) {
         log_rotation_thread_.join();
     }
+
+    Flight::stopWatchdog();
     
     // We remove signal handlers
     removeSignalHandlers();
@@ -423,7 +443,11 @@ bool DaemonTernaryFissionServer::restartDaemon() {
 void DaemonTernaryFissionServer::runMainLoop() {
     while (!shutdown_requested_.load(std::memory_order_relaxed)) {
         statistics_->incrementRequests();
-        bool success = validateDaemonConfiguration() && checkRequiredPermissions();
+        bool success;
+        {
+            TF_TRACE_SCOPE("healthCheck", "daemon");
+            success = validateDaemonConfiguration() && checkRequiredPermissions();
+        }
         if (success) {
             statistics_->incrementSuccessful();
         } else {
@@ -699,7 +723,7 @@ void DaemonTernaryFissionServer::installSignalHandlers() {
     registerSignalHandler(SIGHUP, [this](int sig) { handleReloadSignal(sig); });
     
     // We install handlers for info signals
-    registerSignalHandler(SIGUSR1, [this](int sig) { handleInfoSignal(sig); });
+    registerSignalHandler(SIGUSR1, [this](int sig) { handleTraceSignal(sig); });
     registerSignalHandler(SIGUSR2, [this](int sig) { handleInfoSignal(sig); });
     
     // We ignore SIGPIPE to prevent daemon termination on broken pipes
@@ -755,16 +779,30 @@ void DaemonTernaryFissionServer::handleReloadSignal(int sig) {
 
 /**
  * We handle info signals for status reporting
- * This method outputs daemon status information
+ * This method outputs daemon status information and asks the flight
+ * recorder watchdog for a dump
  */
 void DaemonTernaryFissionServer::handleInfoSignal(int sig) {
     statistics_->incrementSignals(sig);
+    Flight::requestDump("signal");
     
     std::cout << "Received info signal " << sig << ", daemon status: " << getStatusString() << std::endl;
     std::cout << "Uptime: " << getUptime().count() << " seconds" << std::endl;
     std::cout << "PID: " << process_info_->daemon_pid << std::endl;
 }
 
+/**
+ * We toggle span tracing on SIGUSR1
+ * Stopping only flags the export; the resource monitor thread writes the file
+ */
+void DaemonTernaryFissionServer::handleTraceSignal(int sig) {
+    statistics_->incrementSignals(sig);
+
+    if (!Trace::toggle()) {
+        trace_dump_pending_.store(true, std::memory_order_release);
+    }
+}
+
 /**
  * We register custom signal handler
  * This method allows registration of application-specific signal handlers
@@ -863,7 +901,9 @@ bool DaemonTernaryFissionServer::createLogDirectory(const std::string& log_path)
  */
 void DaemonTernaryFissionServer::resourceMonitorWorker() {
     while (resource_monitoring_) {
+        TF_TRACE_SCOPE("resourceMonitorWorker", "daemon");
         collectSystemMetrics();
+        writePendingTrace();
 
         if (debug_mode_) {
             auto usage = getResourceUsage();
@@ -885,11 +925,36 @@ void DaemonTernaryFissionServer::resourceMonitorWorker() {
  * This method gathers CPU, memory, and file descriptor usage
  */
 void DaemonTernaryFissionServer::collectSystemMetrics() {
+    TF_TRACE_SCOPE("collectSystemMetrics", "daemon");
     statistics_->cpu_usage_percent.store(getCurrentCPUUsage(), std::memory_order_relaxed);
     statistics_->memory_usage_bytes.store(getCurrentMemoryUsage(), std::memory_order_relaxed);
     statistics_->file_descriptors_open.store(getOpenFileDescriptorCount(), std::memory_order_relaxed);
 }
 
+/**
+ * We write the trace requested by SIGUSR1 next to the debug log
+ * The file is named trace-<pid>-<unix time>.json
+ */
+void DaemonTernaryFissionServer::writePendingTrace() {
+    if (!trace_dump_pending_.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+
+    std::string directory = ".";
+    auto slash = debug_log_path_.find_last_of('/');
+    if (slash != std::string::npos) {
+        directory = debug_log_path_.substr(0, slash);
+    }
+    std::string path = directory + "/trace-" + std::to_string(getpid()) + "-" +
+                       std::to_string(std::time(nullptr)) + ".json";
+
+    if (Trace::writeChromeTrace(path)) {
+        std::cout << "Trace written to " << path << std::endl;
+    } else {
+        std::cerr << "Error: Cannot write trace to " << path << std::endl;
+    }
+}
+
 /**
  * We get current process memory usage
  * This method returns memory usage in bytes
@@ -0,0 +1,279 @@
+/*
+ * File: src/cpp/dissipation.scheduler.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Dissipation Scheduler Implementation
+ * Purpose: Round-robins entropy passes across fields one slice at a time and throttles
+ *          the scheduler thread to its CPU share
+ * Reason: Keeps dissipation of very large fields from stalling latency-sensitive work
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ * - 2026-10-17: clear() for engine resets; a slice whose pass was cleared is not requeued
+ *
+ * Carry-over Context:
+ * - Each tick runs slices until the byte budget or the duty-cycle share of the tick is
+ *   used, then sleeps for the rest of the tick, longer if one slice overran the share
+ */
+
+#include "dissipation.scheduler.h"
+
+#include "cycle.clock.h"
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+
+namespace TernaryFission {
+
+DissipationScheduler::DissipationScheduler(SliceFunction slice, const Settings& settings)
+    : slice_(std::move(slice)), settings_(settings) {
+}
+
+DissipationScheduler::~DissipationScheduler() {
+    stop();
+}
+
+DissipationScheduler::Settings DissipationScheduler::settings() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return settings_;
+}
+
+void DissipationScheduler::configure(const Settings& settings) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    settings_ = settings;
+    settings_.slice_bytes = std::max<std::size_t>(4096, settings_.slice_bytes);
+    settings_.bytes_per_tick = std::max(settings_.slice_bytes, settings_.bytes_per_tick);
+    settings_.tick_ms = std::max(1, settings_.tick_ms);
+}
+
+double DissipationScheduler::dutyCycle() const {
+    const double percent = settings().cpu_usage_limit_percent;
+    if (percent <= 0.0) {
+        return 1.0;
+    }
+    const double threads = static_cast<double>(std::max(1u, std::thread::hardware_concurrency()));
+    return std::min(1.0, percent / 100.0 * threads);
+}
+
+void DissipationScheduler::schedule(std::uint64_t field_id, std::size_t bytes) {
+    if (bytes == 0) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        passes_scheduled_.fetch_add(1, std::memory_order_relaxed);
+        auto it = passes_.find(field_id);
+        if (it == passes_.end()) {
+            passes_.emplace(field_id, Pass{bytes, 0, bytes});
+            order_.push_back(field_id);
+            backlog_bytes_ += bytes;
+        } else {
+            // We extend the pending pass but keep at most two passes of backlog per field
+            Pass& pass = it->second;
+            std::size_t extended = std::max(pass.remaining, std::min(pass.remaining + bytes, 2 * bytes));
+            if (extended < pass.remaining + bytes) {
+                passes_coalesced_.fetch_add(1, std::memory_order_relaxed);
+            }
+            backlog_bytes_ += extended - pass.remaining;
+            pass.remaining = extended;
+            pass.field_bytes = bytes;
+        }
+    }
+    work_cv_.notify_one();
+}
+
+std::size_t DissipationScheduler::runSlices(std::size_t budget_bytes, std::uint64_t deadline_ticks) {
+    std::size_t processed = 0;
+    while (processed < budget_bytes) {
+        if (deadline_ticks != 0 && CycleClock::now() >= deadline_ticks) {
+            break;
+        }
+
+        std::uint64_t field_id = 0;
+        std::size_t offset = 0;
+        std::size_t length = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (order_.empty()) {
+                break;
+            }
+            field_id = order_.front();
+            order_.pop_front();
+            Pass& pass = passes_[field_id];
+            pass.cursor %= pass.field_bytes;
+            offset = pass.cursor;
+            length = std::min({settings_.slice_bytes, pass.field_bytes - pass.cursor, pass.remaining});
+            slicing_++;
+        }
+
+        const std::uint64_t start = CycleClock::now();
+        const bool alive = slice_(field_id, offset, length);
+        const std::uint64_t elapsed = CycleClock::now() - start;
+        slice_time_.record(elapsed);
+        busy_ticks_.fetch_add(elapsed, std::memory_order_relaxed);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            slicing_--;
+            auto it = passes_.find(field_id);
+            if (it == passes_.end()) {
+                // We were cleared while slicing; the pass is already dropped
+            } else if (!alive) {
+                backlog_bytes_ -= it->second.remaining;
+                passes_.erase(it);
+                passes_dropped_.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                Pass& pass = it->second;
+                pass.cursor += length;
+                pass.remaining -= length;
+                backlog_bytes_ -= length;
+                if (pass.remaining == 0) {
+                    passes_.erase(it);
+                    passes_completed_.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    order_.push_back(field_id);
+                }
+                slices_.fetch_add(1, std::memory_order_relaxed);
+                bytes_processed_.fetch_add(length, std::memory_order_relaxed);
+            }
+            if (order_.empty() && slicing_ == 0) {
+                idle_cv_.notify_all();
+            }
+        }
+        processed += length;
+    }
+    return processed;
+}
+
+std::size_t DissipationScheduler::runTick() {
+    return runSlices(settings().bytes_per_tick, 0);
+}
+
+void DissipationScheduler::start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+        return;
+    }
+    running_ = true;
+    thread_ = std::thread(&DissipationScheduler::threadLoop, this);
+}
+
+void DissipationScheduler::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+    }
+    work_cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void DissipationScheduler::drain() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_cv_.wait(lock, [this] { return order_.empty() && slicing_ == 0; });
+}
+
+std::size_t DissipationScheduler::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const std::size_t dropped = passes_.size();
+    passes_dropped_.fetch_add(dropped, std::memory_order_relaxed);
+    passes_.clear();
+    order_.clear();
+    backlog_bytes_ = 0;
+    if (slicing_ == 0) {
+        idle_cv_.notify_all();
+    }
+    return dropped;
+}
+
+void DissipationScheduler::threadLoop() {
+    for (;;) {
+        Settings current;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            work_cv_.wait(lock, [this] { return !running_ || !order_.empty(); });
+            if (!running_) {
+                return;
+            }
+            current = settings_;
+        }
+
+        const double duty = dutyCycle();
+        const double tick_ns = static_cast<double>(current.tick_ms) * 1e6;
+        const std::uint64_t start = CycleClock::now();
+        const std::uint64_t share_ticks = static_cast<std::uint64_t>(
+            duty * tick_ns * CycleClock::ticksPerSecond() / 1e9);
+        runSlices(current.bytes_per_tick, start + std::max<std::uint64_t>(share_ticks, 1));
+        const double busy_ns = CycleClock::ticksToNanoseconds(CycleClock::now() - start);
+
+        // We sleep out the tick, longer when a slice overran our share of it
+        const double throttle_ns = duty < 1.0 ? busy_ns * (1.0 - duty) / duty : 0.0;
+        const double sleep_ns = std::max(tick_ns - busy_ns, throttle_ns);
+        if (throttle_ns > tick_ns - busy_ns) {
+            throttle_ns_.fetch_add(static_cast<std::uint64_t>(throttle_ns - std::max(0.0, tick_ns - busy_ns)),
+                                   std::memory_order_relaxed);
+        }
+        if (sleep_ns > 0.0) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            work_cv_.wait_for(lock, std::chrono::nanoseconds(static_cast<std::int64_t>(sleep_ns)),
+                              [this] { return !running_; });
+        }
+    }
+}
+
+Json::Value DissipationScheduler::statsToJson() const {
+    Json::Value stats;
+    const Settings current = settings();
+    stats["slice_bytes"] = static_cast<Json::UInt64>(current.slice_bytes);
+    stats["bytes_per_tick"] = static_cast<Json::UInt64>(current.bytes_per_tick);
+    stats["tick_ms"] = current.tick_ms;
+    stats["cpu_usage_limit_percent"] = current.cpu_usage_limit_percent;
+    stats["duty_cycle"] = dutyCycle();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats["pending_fields"] = static_cast<Json::UInt64>(order_.size() + slicing_);
+        stats["backlog_bytes"] = static_cast<Json::UInt64>(backlog_bytes_);
+        stats["running"] = running_;
+    }
+    stats["passes_scheduled"] = static_cast<Json::UInt64>(passes_scheduled_.load(std::memory_order_relaxed));
+    stats["passes_coalesced"] = static_cast<Json::UInt64>(passes_coalesced_.load(std::memory_order_relaxed));
+    stats["passes_completed"] = static_cast<Json::UInt64>(passes_completed_.load(std::memory_order_relaxed));
+    stats["passes_dropped"] = static_cast<Json::UInt64>(passes_dropped_.load(std::memory_order_relaxed));
+    stats["slices"] = static_cast<Json::UInt64>(slices_.load(std::memory_order_relaxed));
+    stats["bytes_processed"] = static_cast<Json::UInt64>(bytes_processed_.load(std::memory_order_relaxed));
+    stats["busy_seconds"] = CycleClock::ticksToMicroseconds(busy_ticks_.load(std::memory_order_relaxed)) / 1e6;
+    stats["throttled_seconds"] = static_cast<double>(throttle_ns_.load(std::memory_order_relaxed)) / 1e9;
+    stats["slice_time_us"] = slice_time_.snapshot().toJson(CycleClock::ticksPerSecond() / 1e6);
+    return stats;
+}
+
+std::string DissipationScheduler::toPrometheus() const {
+    std::size_t backlog = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        backlog = backlog_bytes_;
+    }
+    std::ostringstream out;
+    out << "# HELP ternary_fission_dissipation_backlog_bytes Field bytes waiting for an entropy pass\n"
+        << "# TYPE ternary_fission_dissipation_backlog_bytes gauge\n"
+        << "ternary_fission_dissipation_backlog_bytes " << backlog << "\n"
+        << "# HELP ternary_fission_dissipation_bytes_total Field bytes processed by entropy passes\n"
+        << "# TYPE ternary_fission_dissipation_bytes_total counter\n"
+        << "ternary_fission_dissipation_bytes_total " << bytes_processed_.load(std::memory_order_relaxed) << "\n"
+        << "# HELP ternary_fission_dissipation_busy_seconds_total Time spent applying entropy slices\n"
+        << "# TYPE ternary_fission_dissipation_busy_seconds_total counter\n"
+        << "ternary_fission_dissipation_busy_seconds_total "
+        << CycleClock::ticksToMicroseconds(busy_ticks_.load(std::memory_order_relaxed)) / 1e6 << "\n"
+        << "# HELP ternary_fission_dissipation_throttled_seconds_total Time the scheduler slept to stay within cpu_usage_limit\n"
+        << "# TYPE ternary_fission_dissipation_throttled_seconds_total counter\n"
+        << "ternary_fission_dissipation_throttled_seconds_total "
+        << static_cast<double>(throttle_ns_.load(std::memory_order_relaxed)) / 1e9 << "\n";
+    return out.str();
+}
+
+} // namespace TernaryFission
@@ -0,0 +1,139 @@
+/*
+ * File: src/cpp/epoch.barrier.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Epoch Barrier Implementation
+ * Purpose: Per-epoch caller counting, per-thread scope nesting and the reset handshake
+ * Reason: Lets a reset wait for in-flight workers and API callers instead of only
+ *         dropping the work it catches at commit points
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ *
+ * Carry-over Context:
+ * - Each thread remembers the few barriers it is inside in a fixed thread_local table,
+ *   so entering a scope never allocates
+ */
+
+#include "epoch.barrier.h"
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+
+namespace TernaryFission {
+
+namespace {
+
+constexpr std::size_t kMaxHeldBarriers = 4;
+thread_local const EpochBarrier* t_held[kMaxHeldBarriers] = {};
+thread_local std::size_t t_held_count = 0;
+
+bool isHeld(const EpochBarrier* barrier) {
+    for (std::size_t i = 0; i < t_held_count; ++i) {
+        if (t_held[i] == barrier) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+EpochBarrier::EpochBarrier(const char* name) : mutex_(name) {}
+
+EpochBarrier::Scope::Scope(EpochBarrier& barrier) : barrier_(barrier), counted_(barrier.enter()) {}
+
+EpochBarrier::Scope::~Scope() {
+    if (counted_) {
+        barrier_.leave();
+    }
+}
+
+bool EpochBarrier::enter() {
+    // We nest inside a scope this thread already holds; counting it again would make a
+    // waiting reset wait on us while we wait on it
+    if (isHeld(this)) {
+        return false;
+    }
+
+    {
+        std::unique_lock<ProfiledMutex> lock(mutex_);
+        if (closed_) {
+            ++entries_blocked_;
+            cv_.wait(lock, [this] { return !closed_; });
+        }
+        ++active_;
+    }
+    if (t_held_count < kMaxHeldBarriers) {
+        t_held[t_held_count++] = this;
+    }
+    return true;
+}
+
+void EpochBarrier::leave() {
+    for (std::size_t i = 0; i < t_held_count; ++i) {
+        if (t_held[i] == this) {
+            t_held[i] = t_held[--t_held_count];
+            break;
+        }
+    }
+
+    std::lock_guard<ProfiledMutex> lock(mutex_);
+    --active_;
+    if (active_ == 0 && closed_) {
+        cv_.notify_all();
+    }
+}
+
+bool EpochBarrier::heldByThisThread() const {
+    return isHeld(this);
+}
+
+double EpochBarrier::close() {
+    if (heldByThisThread()) {
+        throw std::logic_error("epoch barrier quiesced from inside one of its scopes");
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    std::unique_lock<ProfiledMutex> lock(mutex_);
+    // We queue behind a reset already in progress, then keep new callers out of ours
+    cv_.wait(lock, [this] { return !closed_; });
+    closed_ = true;
+    cv_.wait(lock, [this] { return active_ == 0; });
+
+    const double waited_us =
+        std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    ++quiesces_;
+    total_wait_us_ += waited_us;
+    max_wait_us_ = std::max(max_wait_us_, waited_us);
+    return waited_us;
+}
+
+void EpochBarrier::open() {
+    {
+        std::lock_guard<ProfiledMutex> lock(mutex_);
+        closed_ = false;
+    }
+    cv_.notify_all();
+}
+
+std::size_t EpochBarrier::active() const {
+    std::lock_guard<ProfiledMutex> lock(mutex_);
+    return active_;
+}
+
+Json::Value EpochBarrier::statsToJson() const {
+    std::lock_guard<ProfiledMutex> lock(mutex_);
+    Json::Value stats;
+    stats["active"] = static_cast<Json::UInt64>(active_);
+    stats["closed"] = closed_;
+    stats["quiesces"] = static_cast<Json::UInt64>(quiesces_);
+    stats["entries_blocked"] = static_cast<Json::UInt64>(entries_blocked_);
+    stats["total_wait_us"] = total_wait_us_;
+    stats["max_wait_us"] = max_wait_us_;
+    return stats;
+}
+
+} // namespace TernaryFission
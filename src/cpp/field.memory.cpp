@@ -0,0 +1,375 @@
+/*
+ * File: src/cpp/field.memory.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Energy Field Backing Memory Implementation
+ * Purpose: Implements the huge-page mapping fallback chain, prefaulting, NUMA-local
+ *          binding and per-backing statistics for field buffers
+ * Reason: We want field creation to pay one fault per 2 MiB instead of per 4 KiB
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ * - 2026-10-17: Field report includes requested bytes and whether the governor shrank it
+ * - 2026-10-17: Virtual fields are counted with their logical size and report zero resident bytes
+ *
+ * Carry-over Context:
+ * - Transparent huge page mappings are over-mapped by 2 MiB and trimmed so the
+ *   buffer starts on a huge-page boundary; the kernel can then back every full
+ *   2 MiB extent with one page
+ * - mbind and getcpu go through syscall() so we need neither libnuma nor numaif.h
+ * - Helper prefault threads report their own RUSAGE_THREAD faults, which are added
+ *   to the allocating thread's count
+ */
+
+#include "field.memory.h"
+
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace TernaryFission {
+namespace FieldMemory {
+
+namespace {
+
+constexpr std::size_t kSmallPageBytes = 4096;
+constexpr std::size_t kHugePageBytes = 2 * 1024 * 1024;
+constexpr int kMadvPopulateWrite = 23;   // MADV_POPULATE_WRITE (Linux 5.14), missing from older headers
+constexpr int kMpolPreferred = 1;        // MPOL_PREFERRED from numaif.h
+constexpr std::size_t kBackingCount = static_cast<std::size_t>(Backing::Virtual) + 1;
+
+std::mutex g_settings_mutex;
+Settings g_settings;
+
+std::atomic<bool> g_hugetlb_unavailable{false};
+std::atomic<std::uint64_t> g_hugetlb_fallbacks{0};
+std::atomic<std::uint64_t> g_thp_advise_failures{0};
+std::atomic<std::uint64_t> g_prefaulted{0};
+std::atomic<std::uint64_t> g_numa_bound{0};
+std::atomic<std::uint64_t> g_allocations[kBackingCount];
+std::atomic<std::uint64_t> g_live_buffers[kBackingCount];
+std::atomic<std::uint64_t> g_live_bytes[kBackingCount];
+std::atomic<std::uint64_t> g_virtual_logical_bytes{0};
+
+bool parseMode(const char* text, Mode& mode) {
+    static const struct { const char* name; Mode mode; } kModes[] = {
+        {"auto", Mode::Auto}, {"hugetlb", Mode::HugeTlb}, {"thp", Mode::TransparentHuge},
+        {"mmap", Mode::Mmap}, {"malloc", Mode::Malloc}
+    };
+    for (const auto& entry : kModes) {
+        if (std::strcmp(text, entry.name) == 0) {
+            mode = entry.mode;
+            return true;
+        }
+    }
+    return false;
+}
+
+// We apply environment overrides once at startup
+const bool g_env_applied = []() {
+    if (const char* env = std::getenv("TERNARY_FIELD_MEMORY")) {
+        parseMode(env, g_settings.mode);
+    }
+    if (const char* env = std::getenv("TERNARY_FIELD_PREFAULT")) {
+        g_settings.prefault = std::strcmp(env, "0") != 0;
+    }
+    if (const char* env = std::getenv("TERNARY_FIELD_NUMA_LOCAL")) {
+        g_settings.numa_local = std::strcmp(env, "0") != 0;
+    }
+    return true;
+}();
+
+std::size_t roundUp(std::size_t bytes, std::size_t unit) {
+    return (bytes + unit - 1) / unit * unit;
+}
+
+bool multipleNumaNodes() {
+    static const bool multiple = ::access("/sys/devices/system/node/node1", F_OK) == 0;
+    return multiple;
+}
+
+/*
+ * Prefer the calling thread's node for pages first touched in [memory, memory + bytes)
+ */
+bool bindToLocalNode(void* memory, std::size_t bytes) {
+    if (!multipleNumaNodes()) {
+        return false;
+    }
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if (::syscall(SYS_getcpu, &cpu, &node, nullptr) != 0 || node >= 8 * sizeof(unsigned long)) {
+        return false;
+    }
+    unsigned long mask = 1UL << node;
+    return ::syscall(SYS_mbind, memory, bytes, kMpolPreferred, &mask,
+                     static_cast<unsigned long>(8 * sizeof(mask)), 0U) == 0;
+}
+
+/*
+ * Fault every page in; returns faults taken by helper threads (ours are counted by the caller)
+ */
+std::uint64_t prefault(void* memory, std::size_t bytes, unsigned threads) {
+    if (::madvise(memory, bytes, kMadvPopulateWrite) == 0) {
+        return 0;
+    }
+    unsigned char* base = static_cast<unsigned char*>(memory);
+    std::size_t pages = bytes / kSmallPageBytes;
+    unsigned workers = std::max(1U, std::min(threads, std::thread::hardware_concurrency()));
+    std::size_t per_worker = (pages + workers - 1) / workers;
+    std::atomic<std::uint64_t> helper_faults{0};
+    auto touch = [&](std::size_t first, std::size_t last) {
+        for (std::size_t page = first; page < last; ++page) {
+            base[page * kSmallPageBytes] = 0;
+        }
+    };
+    std::vector<std::thread> helpers;
+    for (unsigned worker = 1; worker < workers; ++worker) {
+        std::size_t first = std::min(pages, worker * per_worker);
+        std::size_t last = std::min(pages, first + per_worker);
+        helpers.emplace_back([&, first, last]() {
+            std::uint64_t before = threadPageFaults();
+            touch(first, last);
+            helper_faults.fetch_add(threadPageFaults() - before, std::memory_order_relaxed);
+        });
+    }
+    touch(0, std::min(pages, per_worker));
+    for (auto& helper : helpers) {
+        helper.join();
+    }
+    return helper_faults.load(std::memory_order_relaxed);
+}
+
+void* mapHugeTlb(std::size_t bytes, std::size_t& mapped_bytes) {
+    mapped_bytes = roundUp(bytes, kHugePageBytes);
+    void* memory = ::mmap(nullptr, mapped_bytes, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    return memory == MAP_FAILED ? nullptr : memory;
+}
+
+/*
+ * Map on a 2 MiB boundary; `huge` reports whether MADV_HUGEPAGE was accepted
+ */
+void* mapAligned(std::size_t bytes, std::size_t& mapped_bytes, bool advise_huge, bool& huge) {
+    huge = false;
+    mapped_bytes = roundUp(bytes, advise_huge ? kHugePageBytes : kSmallPageBytes);
+    std::size_t slack = advise_huge ? kHugePageBytes : 0;
+    void* raw = ::mmap(nullptr, mapped_bytes + slack, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) {
+        return nullptr;
+    }
+    unsigned char* start = static_cast<unsigned char*>(raw);
+    if (slack > 0) {
+        std::uintptr_t address = reinterpret_cast<std::uintptr_t>(raw);
+        std::size_t head = roundUp(address, kHugePageBytes) - address;
+        if (head > 0) {
+            ::munmap(start, head);
+        }
+        if (slack - head > 0) {
+            ::munmap(start + head + mapped_bytes, slack - head);
+        }
+        start += head;
+    }
+#ifdef MADV_HUGEPAGE
+    if (advise_huge) {
+        huge = ::madvise(start, mapped_bytes, MADV_HUGEPAGE) == 0;
+        if (!huge) {
+            g_thp_advise_failures.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+#endif
+    return start;
+}
+
+void account(Backing backing, std::size_t mapped_bytes, bool add) {
+    std::size_t index = static_cast<std::size_t>(backing);
+    if (add) {
+        g_allocations[index].fetch_add(1, std::memory_order_relaxed);
+        g_live_buffers[index].fetch_add(1, std::memory_order_relaxed);
+        g_live_bytes[index].fetch_add(mapped_bytes, std::memory_order_relaxed);
+    } else {
+        g_live_buffers[index].fetch_sub(1, std::memory_order_relaxed);
+        g_live_bytes[index].fetch_sub(mapped_bytes, std::memory_order_relaxed);
+    }
+}
+
+} // namespace
+
+const char* backingName(Backing backing) {
+    switch (backing) {
+        case Backing::None: return "none";
+        case Backing::Malloc: return "malloc";
+        case Backing::Mmap: return "mmap";
+        case Backing::TransparentHuge: return "thp";
+        case Backing::HugeTlb: return "hugetlb";
+        case Backing::Virtual: return "virtual";
+    }
+    return "unknown";
+}
+
+const char* modeName(Mode mode) {
+    switch (mode) {
+        case Mode::Auto: return "auto";
+        case Mode::HugeTlb: return "hugetlb";
+        case Mode::TransparentHuge: return "thp";
+        case Mode::Mmap: return "mmap";
+        case Mode::Malloc: return "malloc";
+    }
+    return "unknown";
+}
+
+Settings settings() {
+    std::lock_guard<std::mutex> lock(g_settings_mutex);
+    return g_settings;
+}
+
+void configure(const Settings& settings) {
+    std::lock_guard<std::mutex> lock(g_settings_mutex);
+    g_settings = settings;
+    g_hugetlb_unavailable.store(false, std::memory_order_relaxed);
+}
+
+std::uint64_t threadPageFaults() {
+    struct rusage usage;
+    if (::getrusage(RUSAGE_THREAD, &usage) != 0) {
+        return 0;
+    }
+    return static_cast<std::uint64_t>(usage.ru_minflt) + static_cast<std::uint64_t>(usage.ru_majflt);
+}
+
+Block allocate(std::size_t bytes) {
+    Block block;
+    if (bytes == 0) {
+        return block;
+    }
+    const Settings current = settings();
+    const std::uint64_t faults_before = threadPageFaults();
+    const bool wants_mapping = current.mode != Mode::Malloc && bytes >= current.mmap_threshold_bytes;
+
+    if (wants_mapping && (current.mode == Mode::Auto || current.mode == Mode::HugeTlb) &&
+        !g_hugetlb_unavailable.load(std::memory_order_relaxed)) {
+        block.memory = mapHugeTlb(bytes, block.mapped_bytes);
+        if (block.memory) {
+            block.backing = Backing::HugeTlb;
+        } else {
+            // We stop asking once the pool is empty or absent; configure() re-arms
+            g_hugetlb_unavailable.store(true, std::memory_order_relaxed);
+            g_hugetlb_fallbacks.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    if (!block.memory && wants_mapping) {
+        bool advise_huge = current.mode != Mode::Mmap;
+        bool huge = false;
+        block.memory = mapAligned(bytes, block.mapped_bytes, advise_huge, huge);
+        if (block.memory) {
+            block.backing = huge ? Backing::TransparentHuge : Backing::Mmap;
+        }
+    }
+    if (!block.memory) {
+        block.memory = std::malloc(bytes);
+        if (!block.memory) {
+            return Block();
+        }
+        block.mapped_bytes = bytes;
+        block.backing = Backing::Malloc;
+    }
+
+    std::uint64_t helper_faults = 0;
+    if (block.backing != Backing::Malloc) {
+        if (current.numa_local && bindToLocalNode(block.memory, block.mapped_bytes)) {
+            g_numa_bound.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (current.prefault) {
+            helper_faults = prefault(block.memory, block.mapped_bytes, current.prefault_threads);
+            g_prefaulted.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    block.faults = threadPageFaults() - faults_before + helper_faults;
+    account(block.backing, block.mapped_bytes, true);
+    return block;
+}
+
+void release(void* memory, std::size_t mapped_bytes, Backing backing) {
+    if (!memory) {
+        return;
+    }
+    if (backing == Backing::Malloc || backing == Backing::None) {
+        std::free(memory);
+    } else {
+        ::munmap(memory, mapped_bytes);
+    }
+    if (backing != Backing::None) {
+        account(backing, mapped_bytes, false);
+    }
+}
+
+void registerVirtual(std::size_t logical_bytes) {
+    account(Backing::Virtual, 0, true);
+    g_virtual_logical_bytes.fetch_add(logical_bytes, std::memory_order_relaxed);
+}
+
+void unregisterVirtual(std::size_t logical_bytes) {
+    account(Backing::Virtual, 0, false);
+    g_virtual_logical_bytes.fetch_sub(logical_bytes, std::memory_order_relaxed);
+}
+
+Json::Value fieldMemoryToJson(const EnergyField& field) {
+    Json::Value memory;
+    Backing backing = static_cast<Backing>(field.memory_backing);
+    memory["backing"] = backingName(backing);
+    memory["mapped_bytes"] = static_cast<Json::UInt64>(field.memory_mapped_bytes);
+    memory["resident_bytes"] = static_cast<Json::UInt64>(backing == Backing::Virtual ? 0 : field.memory_mapped_bytes);
+    memory["entropy_epoch"] = field.entropy_epoch;
+    memory["requested_bytes"] = static_cast<Json::UInt64>(field.memory_requested_bytes);
+    memory["shrunk"] = field.memory_ptr != nullptr && field.memory_bytes < field.memory_requested_bytes;
+    memory["allocation_faults"] = static_cast<Json::UInt64>(field.allocation_faults);
+    memory["fill_faults"] = static_cast<Json::UInt64>(field.fill_faults);
+
+    // We compare against one fault per 4 KiB page, the cost of a cold malloc'd buffer
+    std::uint64_t faults = field.allocation_faults + field.fill_faults;
+    std::uint64_t small_pages = (field.memory_bytes + kSmallPageBytes - 1) / kSmallPageBytes;
+    double mib = static_cast<double>(field.memory_bytes) / (1024.0 * 1024.0);
+    memory["faults_per_mib"] = mib > 0.0 ? static_cast<double>(faults) / mib : 0.0;
+    memory["expected_4k_faults"] = static_cast<Json::UInt64>(small_pages);
+    memory["fault_reduction"] = faults > 0 ? static_cast<double>(small_pages) / static_cast<double>(faults) : 0.0;
+    memory["huge_pages"] = backing == Backing::HugeTlb || backing == Backing::TransparentHuge;
+    return memory;
+}
+
+Json::Value statsToJson() {
+    const Settings current = settings();
+    Json::Value stats;
+    stats["mode"] = modeName(current.mode);
+    stats["mmap_threshold_bytes"] = static_cast<Json::UInt64>(current.mmap_threshold_bytes);
+    stats["prefault"] = current.prefault;
+    stats["prefault_threads"] = current.prefault_threads;
+    stats["numa_local"] = current.numa_local;
+    stats["numa_nodes_multiple"] = multipleNumaNodes();
+    stats["hugetlb_available"] = !g_hugetlb_unavailable.load(std::memory_order_relaxed);
+    stats["hugetlb_fallbacks"] = static_cast<Json::UInt64>(g_hugetlb_fallbacks.load(std::memory_order_relaxed));
+    stats["thp_advise_failures"] = static_cast<Json::UInt64>(g_thp_advise_failures.load(std::memory_order_relaxed));
+    stats["prefaulted_buffers"] = static_cast<Json::UInt64>(g_prefaulted.load(std::memory_order_relaxed));
+    stats["numa_bound_buffers"] = static_cast<Json::UInt64>(g_numa_bound.load(std::memory_order_relaxed));
+    for (std::size_t index = 1; index < kBackingCount; ++index) {
+        Json::Value entry;
+        entry["allocations"] = static_cast<Json::UInt64>(g_allocations[index].load(std::memory_order_relaxed));
+        entry["live_buffers"] = static_cast<Json::UInt64>(g_live_buffers[index].load(std::memory_order_relaxed));
+        entry["live_bytes"] = static_cast<Json::UInt64>(g_live_bytes[index].load(std::memory_order_relaxed));
+        stats["backings"][backingName(static_cast<Backing>(index))] = entry;
+    }
+    stats["backings"]["virtual"]["logical_bytes"] =
+        static_cast<Json::UInt64>(g_virtual_logical_bytes.load(std::memory_order_relaxed));
+    return stats;
+}
+
+} // namespace FieldMemory
+} // namespace TernaryFission
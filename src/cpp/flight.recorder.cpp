@@ -0,0 +1,659 @@
+/*
+ * File: src/cpp/flight.recorder.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Flight Recorder Implementation
+ * Purpose: Implements the per-thread record rings, atomic dump writer, signal hook
+ *          and anomaly watchdog
+ * Reason: We need the last minute of telemetry on disk when something goes wrong
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ *
+ * Carry-over Context:
+ * - Ring capacity defaults to 4096 records (512 KiB) per thread and can be set with
+ *   TERNARY_FLIGHT_RING_RECORDS; engine spans shorter than TERNARY_FLIGHT_MIN_SPAN_US
+ *   (default 50) are skipped; TERNARY_FLIGHT_RECORDER=0 starts disabled
+ * - Slots carry a sequence number like the trace rings, so a dump taken while
+ *   threads record skips slots that are being overwritten
+ * - The registry mutex is taken only when a thread leases or returns a ring and on dump
+ */
+
+#include "flight.recorder.h"
+#include "perf.counters.h"
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace TernaryFission {
+namespace Flight {
+
+std::atomic<bool> g_flight_enabled{true};
+std::atomic<std::uint64_t> g_min_span_ns{50000};
+
+namespace {
+
+enum class Kind : std::uint8_t {
+    Span,
+    Metric,
+    Log
+};
+
+struct Record {
+    std::atomic<std::uint64_t> sequence{0};   // index + 1 once the slot is complete
+    Kind kind = Kind::Span;
+    std::int32_t tid = 0;
+    const char* name = nullptr;
+    const char* category = nullptr;
+    std::uint64_t start = 0;
+    std::uint64_t end = 0;
+    double value = 0.0;
+    char text[kRecordTextBytes] = {};
+};
+
+static_assert(sizeof(Record) == 128, "flight records are two cache lines");
+
+struct Ring {
+    explicit Ring(std::size_t capacity) : records(capacity), mask(capacity - 1) {}
+
+    std::vector<Record> records;
+    std::size_t mask;
+    std::atomic<std::uint64_t> next{0};
+};
+
+std::size_t computeCapacity() {
+    std::size_t capacity = 4096;
+    if (const char* env = std::getenv("TERNARY_FLIGHT_RING_RECORDS")) {
+        long requested = std::atol(env);
+        if (requested >= 64) {
+            capacity = static_cast<std::size_t>(requested);
+        }
+    }
+    // We round up to a power of two so indexing is a mask
+    std::size_t power = 1;
+    while (power < capacity) {
+        power <<= 1;
+    }
+    return power;
+}
+
+std::mutex& registryMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::vector<std::unique_ptr<Ring>>& registry() {
+    static std::vector<std::unique_ptr<Ring>> rings;
+    return rings;
+}
+
+std::vector<Ring*>& freeRings() {
+    static std::vector<Ring*> rings;
+    return rings;
+}
+
+/*
+ * Thread-local claim on a ring; records keep the writer's tid, so a ring
+ * reused by a later thread still dumps correctly
+ */
+class RingLease {
+public:
+    RingLease() : tid_(static_cast<std::int32_t>(::syscall(SYS_gettid))) {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        if (!freeRings().empty()) {
+            ring_ = freeRings().back();
+            freeRings().pop_back();
+        } else {
+            registry().push_back(std::make_unique<Ring>(ringCapacity()));
+            ring_ = registry().back().get();
+        }
+    }
+
+    ~RingLease() {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        freeRings().push_back(ring_);
+    }
+
+    RingLease(const RingLease&) = delete;
+    RingLease& operator=(const RingLease&) = delete;
+
+    Ring& ring() {
+        return *ring_;
+    }
+
+    std::int32_t tid() const {
+        return tid_;
+    }
+
+private:
+    Ring* ring_ = nullptr;
+    std::int32_t tid_;
+};
+
+RingLease& threadLease() {
+    thread_local RingLease lease;
+    return lease;
+}
+
+void writeRecord(Kind kind, const char* name, const char* category, std::uint64_t start, std::uint64_t end,
+                 double value, const char* text) {
+    RingLease& lease = threadLease();
+    Ring& ring = lease.ring();
+    std::uint64_t index = ring.next.load(std::memory_order_relaxed);
+    Record& record = ring.records[index & ring.mask];
+    record.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    record.kind = kind;
+    record.tid = lease.tid();
+    record.name = name;
+    record.category = category;
+    record.start = start;
+    record.end = end;
+    record.value = value;
+    if (text) {
+        std::size_t length = ::strnlen(text, kRecordTextBytes - 1);
+        std::memcpy(record.text, text, length);
+        record.text[length] = '\0';
+    } else {
+        record.text[0] = '\0';
+    }
+    record.sequence.store(index + 1, std::memory_order_release);
+    ring.next.store(index + 1, std::memory_order_relaxed);
+}
+
+// We apply environment overrides once at startup
+const bool g_env_applied = []() {
+    if (const char* env = std::getenv("TERNARY_FLIGHT_RECORDER")) {
+        g_flight_enabled.store(std::strcmp(env, "0") != 0, std::memory_order_relaxed);
+    }
+    if (const char* env = std::getenv("TERNARY_FLIGHT_MIN_SPAN_US")) {
+        long requested = std::atol(env);
+        if (requested >= 0) {
+            g_min_span_ns.store(static_cast<std::uint64_t>(requested) * 1000, std::memory_order_relaxed);
+        }
+    }
+    return true;
+}();
+
+std::mutex g_dump_mutex;
+std::string g_dump_directory = "logs";
+std::string g_last_dump_path;
+std::string g_last_dump_reason;
+std::uint64_t g_dumps_written = 0;
+std::uint64_t g_dump_sequence = 0;
+
+std::atomic<const char*> g_pending_dump{nullptr};
+std::atomic<bool> g_reset_baselines{false};
+
+/*
+ * Watchdog thread state; anomaly fields are guarded by g_watchdog_mutex
+ */
+std::mutex g_watchdog_mutex;
+std::condition_variable g_watchdog_cv;
+std::thread g_watchdog_thread;
+bool g_watchdog_running = false;
+bool g_watchdog_stop = false;
+double g_baseline_rate = 0.0;
+double g_baseline_latency_ms = 0.0;
+std::string g_last_anomaly;
+std::uint64_t g_anomalies = 0;
+
+void signalDumpHandler(int) {
+    requestDump("signal");
+}
+
+std::uint64_t readRssBytes() {
+#ifdef __linux__
+    std::ifstream statm("/proc/self/statm");
+    std::uint64_t pages = 0;
+    std::uint64_t resident = 0;
+    if (statm >> pages >> resident) {
+        return resident * static_cast<std::uint64_t>(::sysconf(_SC_PAGESIZE));
+    }
+#endif
+    return 0;
+}
+
+bool writeFileAtomically(const std::string& path, const std::string& contents) {
+    std::string temporary = path + ".tmp";
+    int fd = ::open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    const char* data = contents.data();
+    std::size_t remaining = contents.size();
+    while (remaining > 0) {
+        ssize_t written = ::write(fd, data, remaining);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            ::close(fd);
+            ::unlink(temporary.c_str());
+            return false;
+        }
+        data += written;
+        remaining -= static_cast<std::size_t>(written);
+    }
+    if (::fsync(fd) != 0 || ::close(fd) != 0) {
+        ::unlink(temporary.c_str());
+        return false;
+    }
+    if (::rename(temporary.c_str(), path.c_str()) != 0) {
+        ::unlink(temporary.c_str());
+        return false;
+    }
+    return true;
+}
+
+/*
+ * Rate, latency and RSS checks run once per sample interval
+ */
+class Watchdog {
+public:
+    explicit Watchdog(const WatchdogConfig& config) : config_(config) {}
+
+    void sample() {
+        auto now = std::chrono::steady_clock::now();
+        std::uint64_t generated = Perf::phaseCalls(Perf::Phase::Generate);
+        std::uint64_t processed = Perf::phaseCalls(Perf::Phase::Process);
+        std::uint64_t process_cycles = Perf::phaseTscCycles(Perf::Phase::Process);
+        std::uint64_t rss = readRssBytes();
+
+        if (g_reset_baselines.exchange(false, std::memory_order_relaxed)) {
+            samples_ = 0;
+        }
+        if (samples_ == 0) {
+            rss_history_.clear();
+        } else {
+            double seconds = std::chrono::duration<double>(now - last_time_).count();
+            double rate = seconds > 0 ? static_cast<double>(generated - last_generated_) / seconds : 0.0;
+            std::uint64_t calls = processed - last_processed_;
+            double latency_ms = calls > 0
+                ? CycleClock::ticksToNanoseconds(process_cycles - last_process_cycles_) / 1e6 / static_cast<double>(calls)
+                : 0.0;
+
+            recordMetric("events_per_second", rate);
+            if (calls > 0) {
+                recordMetric("process_latency_ms", latency_ms);
+            }
+            check(rate, calls, latency_ms, rss);
+            update(rate, calls, latency_ms);
+        }
+        recordMetric("rss_bytes", static_cast<double>(rss));
+
+        rss_history_.push_back(rss);
+        while (rss_history_.size() > static_cast<std::size_t>(std::max(1, config_.rss_window_samples))) {
+            rss_history_.pop_front();
+        }
+        last_time_ = now;
+        last_generated_ = generated;
+        last_processed_ = processed;
+        last_process_cycles_ = process_cycles;
+        samples_++;
+    }
+
+    // We write anomaly dumps outside g_watchdog_mutex
+    const char* takePendingReason() {
+        const char* reason = pending_reason_;
+        pending_reason_ = nullptr;
+        return reason;
+    }
+
+private:
+    void check(double rate, std::uint64_t calls, double latency_ms, std::uint64_t rss) {
+        if (samples_ < config_.warmup_samples) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(g_watchdog_mutex);
+        char message[kRecordTextBytes];
+        if (g_baseline_rate >= config_.min_events_per_second &&
+            rate < g_baseline_rate * (1.0 - config_.rate_drop_fraction)) {
+            std::snprintf(message, sizeof(message), "event rate %.1f/s vs baseline %.1f/s", rate, g_baseline_rate);
+            anomaly("event_rate_drop", message);
+        }
+        if (calls > 0 && g_baseline_latency_ms > 0 && latency_ms >= config_.min_latency_spike_ms &&
+            latency_ms > g_baseline_latency_ms * config_.latency_spike_factor) {
+            std::snprintf(message, sizeof(message), "process latency %.2f ms vs baseline %.2f ms", latency_ms,
+                          g_baseline_latency_ms);
+            anomaly("latency_spike", message);
+        }
+        if (!rss_history_.empty() && rss > rss_history_.front() + config_.rss_jump_bytes) {
+            std::snprintf(message, sizeof(message), "rss grew %.1f MiB in %zu samples",
+                          static_cast<double>(rss - rss_history_.front()) / (1024.0 * 1024.0), rss_history_.size());
+            anomaly("rss_jump", message);
+        }
+    }
+
+    // We move baselines slowly so a sustained change becomes the new normal
+    void update(double rate, std::uint64_t calls, double latency_ms) {
+        std::lock_guard<std::mutex> lock(g_watchdog_mutex);
+        g_baseline_rate = samples_ == 1 ? rate : g_baseline_rate * 0.8 + rate * 0.2;
+        if (calls > 0) {
+            g_baseline_latency_ms = g_baseline_latency_ms == 0.0 ? latency_ms
+                                                                 : g_baseline_latency_ms * 0.8 + latency_ms * 0.2;
+        }
+    }
+
+    void anomaly(const char* reason, const char* message) {
+        g_anomalies++;
+        g_last_anomaly = std::string(reason) + ": " + message;
+        recordLog("watchdog", g_last_anomaly);
+
+        auto now = std::chrono::steady_clock::now();
+        if (dumped_ && now - last_dump_ < std::chrono::seconds(config_.cooldown_seconds)) {
+            return;
+        }
+        dumped_ = true;
+        last_dump_ = now;
+        pending_reason_ = reason;
+    }
+
+    WatchdogConfig config_;
+    int samples_ = 0;
+    std::chrono::steady_clock::time_point last_time_;
+    std::uint64_t last_generated_ = 0;
+    std::uint64_t last_processed_ = 0;
+    std::uint64_t last_process_cycles_ = 0;
+    std::deque<std::uint64_t> rss_history_;
+    bool dumped_ = false;
+    std::chrono::steady_clock::time_point last_dump_;
+    const char* pending_reason_ = nullptr;
+};
+
+void writeDumpAndReport(const char* reason) {
+    std::string path = writeDump(reason);
+    if (path.empty()) {
+        std::cerr << "Flight recorder: cannot write " << reason << " dump to " << dumpDirectory() << std::endl;
+    } else {
+        std::cerr << "Flight recorder: " << reason << " dump written to " << path << std::endl;
+    }
+}
+
+void watchdogLoop(WatchdogConfig config) {
+    Watchdog watchdog(config);
+    const auto interval = std::chrono::milliseconds(std::max(10, config.sample_interval_ms));
+    auto next_sample = std::chrono::steady_clock::now();
+
+    std::unique_lock<std::mutex> lock(g_watchdog_mutex);
+    while (!g_watchdog_stop) {
+        // We poll requested dumps often so SIGUSR2 feels immediate
+        g_watchdog_cv.wait_for(lock, std::chrono::milliseconds(100), [] { return g_watchdog_stop; });
+        lock.unlock();
+
+        if (const char* reason = g_pending_dump.exchange(nullptr, std::memory_order_acq_rel)) {
+            writeDumpAndReport(reason);
+        }
+        if (std::chrono::steady_clock::now() >= next_sample) {
+            watchdog.sample();
+            next_sample += interval;
+            if (const char* reason = watchdog.takePendingReason()) {
+                writeDumpAndReport(reason);
+            }
+        }
+
+        lock.lock();
+    }
+    lock.unlock();
+
+    // We honor a dump requested just before shutdown
+    if (const char* reason = g_pending_dump.exchange(nullptr, std::memory_order_acq_rel)) {
+        writeDumpAndReport(reason);
+    }
+}
+
+} // namespace
+
+void setEnabled(bool enabled) {
+    g_flight_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void recordSpan(const char* name, const char* category, std::uint64_t start_ticks, std::uint64_t end_ticks,
+                const char* detail) {
+    if (isEnabled()) {
+        writeRecord(Kind::Span, name, category, start_ticks, end_ticks, 0.0, detail);
+    }
+}
+
+void recordMetric(const char* name, double value) {
+    if (isEnabled()) {
+        std::uint64_t now = CycleClock::now();
+        writeRecord(Kind::Metric, name, "metric", now, now, value, nullptr);
+    }
+}
+
+void recordLog(const char* category, const char* message) {
+    if (isEnabled()) {
+        std::uint64_t now = CycleClock::now();
+        writeRecord(Kind::Log, "log", category, now, now, 0.0, message);
+    }
+}
+
+std::size_t ringCapacity() {
+    static const std::size_t capacity = computeCapacity();
+    return capacity;
+}
+
+void setDumpDirectory(const std::string& directory) {
+    std::lock_guard<std::mutex> lock(g_dump_mutex);
+    g_dump_directory = directory.empty() ? "." : directory;
+}
+
+std::string dumpDirectory() {
+    std::lock_guard<std::mutex> lock(g_dump_mutex);
+    return g_dump_directory;
+}
+
+std::string dumpJson(const char* reason) {
+    (void)g_env_applied;
+    struct Entry {
+        Kind kind;
+        std::int32_t tid;
+        const char* name;
+        const char* category;
+        std::uint64_t start;
+        std::uint64_t end;
+        double value;
+        std::string text;
+    };
+
+    const std::uint64_t now = CycleClock::now();
+    const std::uint64_t window_ticks = static_cast<std::uint64_t>(kWindowSeconds * CycleClock::ticksPerSecond());
+    const std::uint64_t cutoff = now > window_ticks ? now - window_ticks : 0;
+
+    std::vector<Entry> entries;
+    {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        for (const auto& ring : registry()) {
+            std::uint64_t end = ring->next.load(std::memory_order_acquire);
+            std::uint64_t capacity = ring->records.size();
+            std::uint64_t begin = end > capacity ? end - capacity : 0;
+            for (std::uint64_t index = begin; index < end; ++index) {
+                const Record& record = ring->records[index & ring->mask];
+                if (record.sequence.load(std::memory_order_acquire) != index + 1) {
+                    continue;
+                }
+                Entry entry{record.kind, record.tid, record.name, record.category, record.start,
+                            record.end, record.value, std::string(record.text, ::strnlen(record.text, kRecordTextBytes))};
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (record.sequence.load(std::memory_order_relaxed) != index + 1 || entry.end < cutoff) {
+                    continue;
+                }
+                entries.push_back(std::move(entry));
+            }
+        }
+    }
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry& a, const Entry& b) { return a.start < b.start; });
+
+    const double ticks_per_us = CycleClock::ticksPerSecond() / 1e6;
+    const std::uint64_t base = entries.empty() ? cutoff : std::min(cutoff, entries.front().start);
+    const Json::Int64 pid = static_cast<Json::Int64>(::getpid());
+
+    Json::Value events(Json::arrayValue);
+    for (const auto& entry : entries) {
+        Json::Value event;
+        event["name"] = entry.name;
+        event["cat"] = entry.category;
+        event["pid"] = pid;
+        event["tid"] = static_cast<Json::Int64>(entry.tid);
+        event["ts"] = static_cast<double>(entry.start - base) / ticks_per_us;
+        switch (entry.kind) {
+            case Kind::Span:
+                event["ph"] = "X";
+                event["dur"] = static_cast<double>(entry.end - entry.start) / ticks_per_us;
+                if (!entry.text.empty()) {
+                    event["args"]["detail"] = entry.text;
+                }
+                break;
+            case Kind::Metric:
+                event["ph"] = "C";
+                event["args"]["value"] = entry.value;
+                break;
+            case Kind::Log:
+                event["ph"] = "i";
+                event["s"] = "t";
+                event["args"]["message"] = entry.text;
+                break;
+        }
+        events.append(event);
+    }
+
+    std::time_t wall = std::time(nullptr);
+    char timestamp[32];
+    std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&wall));
+
+    Json::Value dump;
+    dump["traceEvents"] = events;
+    dump["displayTimeUnit"] = "ms";
+    dump["otherData"]["reason"] = reason;
+    dump["otherData"]["dumped_at"] = timestamp;
+    dump["otherData"]["window_seconds"] = kWindowSeconds;
+    dump["otherData"]["ticks_per_second"] = CycleClock::ticksPerSecond();
+    dump["otherData"]["recorder"] = statusToJson();
+
+    Json::StreamWriterBuilder builder;
+    builder["indentation"] = "";
+    return Json::writeString(builder, dump);
+}
+
+std::string writeDump(const char* reason) {
+    std::string contents = dumpJson(reason);
+
+    std::lock_guard<std::mutex> lock(g_dump_mutex);
+    if (::mkdir(g_dump_directory.c_str(), 0755) != 0 && errno != EEXIST) {
+        return std::string();
+    }
+    std::string path = g_dump_directory + "/flight-" + std::to_string(::getpid()) + "-" +
+                       std::to_string(std::time(nullptr)) + "-" + std::to_string(++g_dump_sequence) + "-" +
+                       reason + ".json";
+    if (!writeFileAtomically(path, contents)) {
+        return std::string();
+    }
+    g_dumps_written++;
+    g_last_dump_path = path;
+    g_last_dump_reason = reason;
+    return path;
+}
+
+void requestDump(const char* reason) {
+    g_pending_dump.store(reason, std::memory_order_release);
+}
+
+bool installSignalHandler(int signal_number) {
+    struct sigaction action;
+    std::memset(&action, 0, sizeof(action));
+    action.sa_handler = signalDumpHandler;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    return ::sigaction(signal_number, &action, nullptr) == 0;
+}
+
+void startWatchdog(const WatchdogConfig& config) {
+    std::lock_guard<std::mutex> lock(g_watchdog_mutex);
+    if (g_watchdog_running) {
+        return;
+    }
+    // We calibrate here so neither the signal path nor the first sample waits on it
+    CycleClock::epoch();
+    g_watchdog_stop = false;
+    g_watchdog_running = true;
+    g_watchdog_thread = std::thread(watchdogLoop, config);
+}
+
+void stopWatchdog() {
+    {
+        std::lock_guard<std::mutex> lock(g_watchdog_mutex);
+        if (!g_watchdog_running) {
+            return;
+        }
+        g_watchdog_stop = true;
+    }
+    g_watchdog_cv.notify_all();
+    g_watchdog_thread.join();
+
+    std::lock_guard<std::mutex> lock(g_watchdog_mutex);
+    g_watchdog_running = false;
+}
+
+void resetWatchdogBaselines() {
+    g_reset_baselines.store(true, std::memory_order_relaxed);
+}
+
+Json::Value statusToJson() {
+    Json::Value status;
+    status["enabled"] = isEnabled();
+    status["window_seconds"] = kWindowSeconds;
+    status["min_span_us"] = static_cast<double>(g_min_span_ns.load(std::memory_order_relaxed)) / 1000.0;
+    status["ring_records"] = static_cast<Json::UInt64>(ringCapacity());
+    status["record_bytes"] = static_cast<Json::UInt64>(sizeof(Record));
+    {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        status["rings"] = static_cast<Json::UInt64>(registry().size());
+        status["memory_bytes"] = static_cast<Json::UInt64>(registry().size() * ringCapacity() * sizeof(Record));
+    }
+    {
+        std::lock_guard<std::mutex> lock(g_dump_mutex);
+        status["dump_directory"] = g_dump_directory;
+        status["dumps_written"] = static_cast<Json::UInt64>(g_dumps_written);
+        if (g_dumps_written > 0) {
+            status["last_dump"]["path"] = g_last_dump_path;
+            status["last_dump"]["reason"] = g_last_dump_reason;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(g_watchdog_mutex);
+        Json::Value watchdog;
+        watchdog["running"] = g_watchdog_running;
+        watchdog["baseline_events_per_second"] = g_baseline_rate;
+        watchdog["baseline_process_latency_ms"] = g_baseline_latency_ms;
+        watchdog["anomalies"] = static_cast<Json::UInt64>(g_anomalies);
+        if (!g_last_anomaly.empty()) {
+            watchdog["last_anomaly"] = g_last_anomaly;
+        }
+        status["watchdog"] = watchdog;
+    }
+    return status;
+}
+
+} // namespace Flight
+} // namespace TernaryFission
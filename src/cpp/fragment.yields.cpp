@@ -0,0 +1,239 @@
+/*
+ * File: src/cpp/fragment.yields.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Fragment Yields Implementation
+ * Purpose: Vose's alias table construction and the fragment pair tables built from the
+ *          double-humped mass model or from yield files
+ * Reason: Gives the engine configured, double-humped yields at constant cost per event
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ *
+ * Carry-over Context:
+ * - Vose's method is exact up to the 32-bit threshold: each column's threshold is rounded
+ *   to 2^-32, so outcome probabilities are off by at most 2^-32 / n per column
+ * - Model weights are normalized over Z at each A, so charge_sigma changes the charges
+ *   but never the mass yields
+ */
+
+#include "fragment.yields.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace TernaryFission {
+
+namespace {
+
+constexpr double kThresholdScale = 4294967296.0;  // 2^32
+constexpr int kChargeSpread = 3;                  // Charges kept either side of the density
+constexpr double kNegligibleYield = 1e-12;        // Relative to the largest pair
+
+double gaussian(double x, double mean, double sigma) {
+    const double z = (x - mean) / sigma;
+    return std::exp(-0.5 * z * z) / sigma;
+}
+
+bool validPair(int light_a, int light_z, int rest_a, int rest_z) {
+    const int heavy_a = rest_a - light_a;
+    const int heavy_z = rest_z - light_z;
+    return light_a >= 1 && light_z >= 1 && light_z <= light_a && heavy_a >= 1 && heavy_z >= 1 &&
+           heavy_z <= heavy_a;
+}
+
+FragmentPair makePair(int light_a, int light_z, int rest_a, int rest_z) {
+    FragmentPair pair;
+    pair.light_mass_number = static_cast<std::uint16_t>(light_a);
+    pair.light_atomic_number = static_cast<std::uint16_t>(light_z);
+    pair.heavy_mass_number = static_cast<std::uint16_t>(rest_a - light_a);
+    pair.heavy_atomic_number = static_cast<std::uint16_t>(rest_z - light_z);
+    return pair;
+}
+
+void modelPairs(int rest_z, int rest_a, const FragmentYieldModel& model, std::vector<FragmentPair>& pairs,
+                std::vector<double>& weights) {
+    if (!(model.light_fragment_sigma > 0.0) || !(model.heavy_fragment_sigma > 0.0) ||
+        !(model.charge_sigma > 0.0)) {
+        throw std::invalid_argument("fragment yield widths must be positive");
+    }
+    for (int light_a = 1; light_a <= rest_a / 2; ++light_a) {
+        const double mass_yield = gaussian(light_a, model.light_fragment_mean, model.light_fragment_sigma) +
+                                  gaussian(rest_a - light_a, model.heavy_fragment_mean,
+                                           model.heavy_fragment_sigma);
+        const double charge_density = static_cast<double>(light_a) * rest_z / rest_a;
+        const int nearest = static_cast<int>(std::lround(charge_density));
+
+        double charge_total = 0.0;
+        for (int light_z = nearest - kChargeSpread; light_z <= nearest + kChargeSpread; ++light_z) {
+            if (validPair(light_a, light_z, rest_a, rest_z)) {
+                charge_total += gaussian(light_z, charge_density, model.charge_sigma);
+            }
+        }
+        if (charge_total <= 0.0) {
+            continue;
+        }
+        for (int light_z = nearest - kChargeSpread; light_z <= nearest + kChargeSpread; ++light_z) {
+            if (validPair(light_a, light_z, rest_a, rest_z)) {
+                pairs.push_back(makePair(light_a, light_z, rest_a, rest_z));
+                weights.push_back(mass_yield * gaussian(light_z, charge_density, model.charge_sigma) /
+                                  charge_total);
+            }
+        }
+    }
+
+    // We drop pairs far out in the tails so the table stays small
+    const double largest = weights.empty() ? 0.0 : *std::max_element(weights.begin(), weights.end());
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < weights.size(); ++i) {
+        if (weights[i] >= largest * kNegligibleYield) {
+            pairs[kept] = pairs[i];
+            weights[kept] = weights[i];
+            ++kept;
+        }
+    }
+    pairs.resize(kept);
+    weights.resize(kept);
+}
+
+void filePairs(int rest_z, int rest_a, const std::string& path, std::vector<FragmentPair>& pairs,
+               std::vector<double>& weights) {
+    std::ifstream file(path);
+    if (!file) {
+        throw std::runtime_error("cannot read fragment yield file " + path);
+    }
+    std::string line;
+    int line_number = 0;
+    while (std::getline(file, line)) {
+        ++line_number;
+        const std::size_t comment = line.find('#');
+        if (comment != std::string::npos) {
+            line.erase(comment);
+        }
+        std::istringstream fields(line);
+        int light_a = 0;
+        int light_z = 0;
+        double yield = 0.0;
+        if (!(fields >> light_a)) {
+            continue;  // Blank or comment-only line
+        }
+        std::string extra;
+        if (!(fields >> light_z >> yield) || (fields >> extra) || !(yield >= 0.0) ||
+            !validPair(light_a, light_z, rest_a, rest_z)) {
+            throw std::runtime_error(path + ":" + std::to_string(line_number) +
+                                     ": expected \"A Z yield\" for a fragment of this parent");
+        }
+        if (yield > 0.0) {
+            pairs.push_back(makePair(light_a, light_z, rest_a, rest_z));
+            weights.push_back(yield);
+        }
+    }
+    if (pairs.empty()) {
+        throw std::runtime_error("fragment yield file " + path + " has no yields");
+    }
+}
+
+} // namespace
+
+AliasTable::AliasTable(const std::vector<double>& weights) {
+    if (weights.empty() || weights.size() > 0xFFFFFFFFULL) {
+        throw std::invalid_argument("alias table needs between 1 and 2^32 - 1 weights");
+    }
+    double total = 0.0;
+    for (double weight : weights) {
+        if (!(weight >= 0.0)) {
+            throw std::invalid_argument("alias table weights must be non-negative");
+        }
+        total += weight;
+    }
+    if (!(total > 0.0) || !std::isfinite(total)) {
+        throw std::invalid_argument("alias table weights must have a positive finite total");
+    }
+
+    // We scale so an average column holds exactly 1, then pair each underfull column
+    // with an overfull one that tops it up
+    const std::size_t n = weights.size();
+    std::vector<double> scaled(n);
+    std::vector<std::uint32_t> small;
+    std::vector<std::uint32_t> large;
+    for (std::size_t i = 0; i < n; ++i) {
+        scaled[i] = weights[i] * static_cast<double>(n) / total;
+        (scaled[i] < 1.0 ? small : large).push_back(static_cast<std::uint32_t>(i));
+    }
+
+    columns_.resize(n);
+    while (!small.empty() && !large.empty()) {
+        const std::uint32_t under = small.back();
+        small.pop_back();
+        const std::uint32_t over = large.back();
+        columns_[under].threshold = static_cast<std::uint64_t>(std::llround(scaled[under] * kThresholdScale));
+        columns_[under].alias = over;
+        scaled[over] -= 1.0 - scaled[under];
+        if (scaled[over] < 1.0) {
+            large.pop_back();
+            small.push_back(over);
+        }
+    }
+    // We let rounding leftovers on either list keep their whole column
+    for (std::uint32_t index : small) {
+        columns_[index].threshold = static_cast<std::uint64_t>(kThresholdScale);
+        columns_[index].alias = index;
+    }
+    for (std::uint32_t index : large) {
+        columns_[index].threshold = static_cast<std::uint64_t>(kThresholdScale);
+        columns_[index].alias = index;
+    }
+}
+
+double AliasTable::probability(std::size_t outcome) const {
+    double mass = 0.0;
+    for (std::size_t column = 0; column < columns_.size(); ++column) {
+        const double keep = static_cast<double>(columns_[column].threshold) / kThresholdScale;
+        if (column == outcome) {
+            mass += keep;
+        }
+        if (columns_[column].alias == outcome) {
+            mass += 1.0 - keep;
+        }
+    }
+    return mass / static_cast<double>(columns_.size());
+}
+
+FragmentYields::FragmentYields(int parent_atomic_number, int parent_mass_number, std::vector<FragmentPair> pairs,
+                               const std::vector<double>& weights)
+    : parent_atomic_number_(parent_atomic_number),
+      parent_mass_number_(parent_mass_number),
+      pairs_(std::move(pairs)),
+      table_(weights) {
+    if (pairs_.size() != weights.size()) {
+        throw std::invalid_argument("fragment yields need one weight per pair");
+    }
+}
+
+std::shared_ptr<const FragmentYields> FragmentYields::build(int parent_atomic_number, int parent_mass_number,
+                                                            const FragmentYieldModel& model) {
+    // We leave an alpha particle and at least two nucleons for the fragments
+    const int rest_z = parent_atomic_number - 2;
+    const int rest_a = parent_mass_number - 4;
+    if (rest_z < 2 || rest_a < 2 || rest_z > rest_a || parent_mass_number > 0xFFFF) {
+        throw std::invalid_argument("parent Z=" + std::to_string(parent_atomic_number) +
+                                    " A=" + std::to_string(parent_mass_number) +
+                                    " cannot split into two fragments and an alpha");
+    }
+
+    std::vector<FragmentPair> pairs;
+    std::vector<double> weights;
+    if (model.yield_file.empty()) {
+        modelPairs(rest_z, rest_a, model, pairs, weights);
+    } else {
+        filePairs(rest_z, rest_a, model.yield_file, pairs, weights);
+    }
+    return std::make_shared<const FragmentYields>(parent_atomic_number, parent_mass_number, std::move(pairs),
+                                                  weights);
+}
+
+} // namespace TernaryFission
@@ -17,6 +17,62 @@
  *             Implemented comprehensive middleware stack (CORS, logging,
  * metrics) Added energy field management with persistence and validation
  *             Integrated system metrics collection and performance monitoring
+ * 2026-10-17: initializePhysicsEngine() now creates an engine from the physics
+ *             configuration when none has been injected
+ * 2026-10-17: Energy generation releases its transient field memory
+ * 2026-10-17: Trace spans on API handlers and JSON I/O; trace start/stop/dump
+ *             endpoints under /api/v1/trace
+ * 2026-10-17: Measured field cycles in energy generation output and
+ *             /api/v1/profile/counters phase counter endpoints
+ * 2026-10-17: Error handler keeps handler-set status codes and bodies instead
+ *             of rewriting every error to 500
+ * 2026-10-17: POST /api/v1/profile/cpu sampling profiler returning folded stacks
+ * 2026-10-17: Server mutexes are ProfiledMutex; GET/DELETE /api/v1/profile/locks
+ *             per-lock contention profiles
+ * 2026-10-17: Allocation scopes per handler, X-Alloc-* response headers and
+ *             GET/DELETE /api/v1/profile/allocations (ALLOC_TRACKING=1 builds)
+ * 2026-10-17: Per-request phase timers with Server-Timing and X-Request-ID
+ *             headers, slow-request log, response time measured after the
+ *             write, POST /api/v1/physics/fission/batch
+ * 2026-10-17: GET /api/v1/metrics Prometheus exposition with engine phase
+ *             latency summaries
+ * 2026-10-17: Flight recorder: requests and slow-request lines are recorded,
+ *             the watchdog runs while the server is up, SIGUSR2 and
+ *             POST /api/v1/profile/flight write dumps
+ * 2026-10-17: Field backing memory and page faults in energy generation output;
+ *             field memory statistics in /api/v1/profile/counters
+ * 2026-10-17: Memory governor configured from the physics settings, its
+ *             reclaimer runs while the server is up, rejected fields return
+ *             503, decisions in /api/v1/profile/counters and /api/v1/metrics
+ * 2026-10-17: virtual_energy_fields switch; GET /api/v1/physics/fields lists
+ *             engine fields and GET /api/v1/physics/fields/{id}/bytes reads a
+ *             byte range, regenerating virtual fields on demand
+ * 2026-10-17: Engine field fill pool configured from the physics settings;
+ *             fill backlog in /api/v1/profile/counters and /api/v1/metrics
+ * 2026-10-17: Engine dissipation scheduler configured from cpu_usage_limit and the
+ *             dissipation slice settings; reported in counters and metrics
+ * 2026-10-17: Engine CPU burn executor configured from the cpu_burn settings;
+ *             burn progress in /api/v1/profile/counters and /api/v1/metrics
+ * 2026-10-17: Portal trigger returns a portal_id and extends an active portal when
+ *             one is given; GET /api/v1/portal/loads lists portals and
+ *             DELETE /api/v1/portal/loads/{id} cancels one
+ * 2026-10-17: Simulation reset resets the engine in place instead of shutting it
+ *             down and constructing a new one; configured settings are kept
+ * 2026-10-17: Engine fragment yields configured from the fragment mass humps or
+ *             fragment_yield_file
+ * 2026-10-17: Fission and batch requests take a "nuclide" such as "Cf-252"; batches
+ *             take a "nuclides" list that mixes parents; GET /api/v1/physics/nuclides
+ * 2026-10-17: Governor rejections of portal starts and extensions return 503
+ * 2026-10-17: A portal start cancelled by a concurrent reset returns 409
+ * 2026-10-17: GET /api/v1/physics/nuclides is traced, counted and reads the engine
+ *             under simulation_mutex_
+ * 2026-10-17: Portal load list and cancel handlers report allocations per endpoint
+ * 2026-10-17: Metrics and profile counter handlers read the engine under
+ *             simulation_mutex_; profile counter handlers open trace and
+ *             allocation scopes
+ * 2026-10-17: The error handler keeps the status and body a handler already
+ *             set and only fills in responses without a body, keeping their
+ *             status; it used to replace every error with a 500
  *
  * Carry-over Context:
  * - This implementation provides complete HTTP server functionality for daemon
@@ -35,9 +91,19 @@
 #include "http.ternary.fission.server.h"
 #include "physics.utilities.h"
 #include "system.metrics.h"
+#include "trace.ring.h"
+#include "perf.counters.h"
+#include "cpu.profiler.h"
+#include "allocation.tracker.h"
+#include "flight.recorder.h"
+#include "field.memory.h"
+#include "memory.governor.h"
+#include "nuclide.registry.h"
 #include <algorithm>
+#include <cctype>
 #include <chrono>
 #include <cmath>
+#include <cstdio>
 #include <cstring>
 #include <fstream>
 #include <iomanip>
@@ -54,6 +120,135 @@
 
 namespace TernaryFission {
 
+namespace {
+// We snapshot the worker thread's allocation counters when a request arrives
+thread_local Alloc::ThreadCounters t_request_allocations;
+
+constexpr std::size_t kMaxRequestIdLength = 64;
+constexpr int kMaxFissionBatch = 100;
+
+/**
+ * We time each request's phases on the worker thread that serves it
+ * httplib runs routing, the handler, the post-routing hook, the write and the
+ * logger on one thread, so plain thread_local state needs no locking
+ */
+struct RequestTiming {
+  std::uint64_t start_ticks = 0;     // Pre-routing entry; 0 outside a request
+  std::uint64_t routed_ticks = 0;    // Post-routing, just before the write
+  std::uint64_t lock_wait_start = 0; // threadLockWaitTicks() at start
+  std::uint64_t queue_ticks = 0;     // Blocked on ProfiledMutex locks
+  std::uint64_t parse_ticks = 0;     // parseJSONRequest
+  std::uint64_t serialize_ticks = 0; // sendJSONResponse
+  char request_id[kMaxRequestIdLength + 1] = {};
+};
+
+thread_local RequestTiming t_request_timing;
+
+/**
+ * We add the enclosing block's duration to one request phase
+ */
+class RequestPhaseTimer {
+public:
+  explicit RequestPhaseTimer(std::uint64_t &sink)
+      : sink_(sink), start_(CycleClock::now()) {}
+  ~RequestPhaseTimer() { sink_ += CycleClock::now() - start_; }
+
+  RequestPhaseTimer(const RequestPhaseTimer &) = delete;
+  RequestPhaseTimer &operator=(const RequestPhaseTimer &) = delete;
+
+private:
+  std::uint64_t &sink_;
+  std::uint64_t start_;
+};
+
+double ticksToMilliseconds(std::uint64_t ticks) {
+  return CycleClock::ticksToNanoseconds(ticks) / 1e6;
+}
+
+/**
+ * We accept a caller's X-Request-ID only if it is short and log-safe
+ */
+bool isValidRequestId(const std::string &id) {
+  if (id.empty() || id.size() > kMaxRequestIdLength) {
+    return false;
+  }
+  for (char c : id) {
+    if (!std::isalnum(static_cast<unsigned char>(c)) && c != '-' && c != '_' &&
+        c != '.' && c != ':') {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * We serialize one fission fragment for the physics endpoints
+ */
+Json::Value fissionFragmentToJson(const FissionFragment &frag) {
+  Json::Value jf;
+  jf["mass"] = frag.mass;
+  jf["atomic_number"] = static_cast<Json::Int64>(frag.atomic_number);
+  jf["mass_number"] = static_cast<Json::Int64>(frag.mass_number);
+  jf["kinetic_energy"] = frag.kinetic_energy;
+  jf["binding_energy"] = frag.binding_energy;
+  jf["excitation_energy"] = frag.excitation_energy;
+  jf["half_life"] = frag.half_life;
+  Json::Value momentum;
+  momentum["x"] = frag.momentum.x;
+  momentum["y"] = frag.momentum.y;
+  momentum["z"] = frag.momentum.z;
+  jf["momentum"] = momentum;
+  Json::Value position;
+  position["x"] = frag.position.x;
+  position["y"] = frag.position.y;
+  position["z"] = frag.position.z;
+  jf["position"] = position;
+  return jf;
+}
+
+/**
+ * We read and range-check parent_mass and excitation_energy; a "nuclide" symbol,
+ * or a "nuclides" list where allowed, names the parent instead of parent_mass
+ */
+bool parseFissionParameters(const Json::Value &body, double &parent_mass,
+                            double &excitation_energy, std::string &nuclide,
+                            bool allow_nuclide_list, std::string &error) {
+  parent_mass = body.get("parent_mass", 0.0).asDouble();
+  excitation_energy = body.get("excitation_energy", 0.0).asDouble();
+  nuclide.clear();
+  if (body.isMember("nuclide")) {
+    if (!body["nuclide"].isString()) {
+      error = "nuclide must be a symbol such as \"Cf-252\"";
+      return false;
+    }
+    nuclide = body["nuclide"].asString();
+  }
+
+  const bool listed = allow_nuclide_list && body.isMember("nuclides");
+  if (nuclide.empty() && !listed &&
+      (parent_mass <= 0.0 || parent_mass > 300.0)) {
+    error = "parent_mass must be between 0 and 300 AMU";
+    return false;
+  }
+  if (excitation_energy < 0.0 || excitation_energy > 100.0) {
+    error = "excitation_energy must be between 0 and 100 MeV";
+    return false;
+  }
+  return true;
+}
+
+/**
+ * We generate "<process prefix>-<sequence>" IDs that are unique across restarts
+ */
+void generateRequestId(char *buffer, std::size_t size) {
+  static const std::uint32_t prefix = std::random_device{}();
+  static std::atomic<std::uint64_t> sequence{1};
+  std::snprintf(buffer, size, "%08x-%012llx", prefix,
+                static_cast<unsigned long long>(
+                    sequence.fetch_add(1, std::memory_order_relaxed)));
+}
+} // namespace
+
 // =============================================================================
 // ENERGY FIELD RESPONSE IMPLEMENTATION
 // =============================================================================
@@ -256,7 +451,7 @@ HTTPTernaryFissionServer::HTTPTernaryFissionServer(
       start_time_(std::chrono::system_clock::now()), field_id_counter_(1),
       websocket_broadcasting_(false),
       metrics_(std::make_unique<HTTPServerMetrics>()),
-      metrics_collecting_(false) {
+      metrics_collecting_(false), slow_request_threshold_ms_(500) {
 
   // We initialize SSL library for certificate handling
   SSL_library_init();
@@ -300,6 +495,23 @@ bool HTTPTernaryFissionServer::initialize() {
   bind_ip_ = network_config.bind_ip;
   bind_port_ = network_config.bind_port;
   ssl_enabled_ = network_config.enable_ssl;
+  slow_request_threshold_ms_ =
+      config_manager_->getLoggingConfig().slow_request_threshold_ms;
+  Flight::setEnabled(
+      config_manager_->getLoggingConfig().flight_recorder_enabled);
+  Flight::setDumpDirectory(
+      config_manager_->getLoggingConfig().flight_recorder_directory);
+
+  // We cap field memory with the governor settings from the physics section
+  const auto &physics_config = config_manager_->getPhysicsConfig();
+  Governor::Settings governor = Governor::settings();
+  governor.max_bytes = physics_config.max_memory_usage;
+  governor.memory_usage_limit_percent = physics_config.memory_usage_limit;
+  Governor::parsePolicy(physics_config.memory_governor_policy, governor.policy);
+  governor.high_watermark = physics_config.memory_high_watermark;
+  governor.low_watermark = physics_config.memory_low_watermark;
+  Governor::configure(governor);
+  g_energy_field_config.virtual_fields = physics_config.virtual_energy_fields;
 
   // We setup media streaming manager if enabled
   auto media_config = config_manager_->getMediaStreamingConfig();
@@ -403,6 +615,15 @@ bool HTTPTernaryFissionServer::start() {
   metrics_collection_thread_ =
       std::thread(&HTTPTernaryFissionServer::collectMetrics, this);
 
+  // We start the flight recorder watchdog; SIGUSR2 asks it for a dump
+  if (Flight::isEnabled()) {
+    Flight::startWatchdog();
+    Flight::installSignalHandler(SIGUSR2);
+  }
+
+  // We evict fields in the background above the governor's high watermark
+  Governor::startReclaimer();
+
   // We start WebSocket broadcasting thread
   websocket_broadcasting_ = true;
   websocket_broadcast_thread_ =
@@ -461,6 +682,9 @@ void HTTPTernaryFissionServer::stop() {
     websocket_broadcast_thread_.join();
   }
 
+  Flight::stopWatchdog();
+  Governor::stopReclaimer();
+
   // We cleanup WebSocket connections
   cleanupWebSocketConnections();
 
@@ -535,6 +759,10 @@ void HTTPTernaryFissionServer::setupMiddleware() {
   // We setup pre-routing middleware
   server->set_pre_routing_handler(
       [this](const httplib::Request &req, httplib::Response &res) {
+        this->requestTimingMiddleware(req, res);
+        if (Alloc::kTrackingCompiledIn) {
+          t_request_allocations = Alloc::threadCounters();
+        }
         if (req.path.find("..") != std::string::npos) {
           res.status = 403;
           return httplib::Server::HandlerResponse::Handled;
@@ -545,10 +773,39 @@ void HTTPTernaryFissionServer::setupMiddleware() {
         return httplib::Server::HandlerResponse::Unhandled;
       });
 
-  // We setup error handler
+  // We add Server-Timing and X-Request-ID (and, in tracking builds, this
+  // request's heap allocations) once the response is final but unsent
+  // httplib runs the whole request on one thread, so thread-local deltas
+  // cover routing, the handler and JSON serialization
+  server->set_post_routing_handler(
+      [this](const httplib::Request &req, httplib::Response &res) {
+        this->serverTimingMiddleware(req, res);
+        if (Alloc::kTrackingCompiledIn) {
+          Alloc::ThreadCounters used =
+              Alloc::threadCounters() - t_request_allocations;
+          res.set_header("X-Alloc-Count", std::to_string(used.allocations));
+          res.set_header("X-Alloc-Bytes", std::to_string(used.bytes_allocated));
+          res.set_header("X-Alloc-Frees", std::to_string(used.frees));
+        }
+      });
+
+  // We close the request's timing after the response is written
+  server->set_logger(
+      [this](const httplib::Request &req, const httplib::Response &res) {
+        this->requestCompletionLogger(req, res);
+      });
+
+  // We setup error handler for responses that carry no body of their own
+  // Handlers that already sent a JSON error keep their status and message
   server->set_error_handler(
       [this](const httplib::Request & /*req*/, httplib::Response &res) {
-        this->sendErrorResponse(res, 500, "Internal server error");
+        if (!res.body.empty()) {
+          return httplib::Server::HandlerResponse::Unhandled;
+        }
+        this->sendErrorResponse(res, res.status,
+                                res.status == 404 ? "Not found"
+                                                  : "Request failed");
+        return httplib::Server::HandlerResponse::Handled;
       });
 
   std::cout << "HTTP server middleware configured" << std::endl;
@@ -581,7 +838,9 @@ void HTTPTernaryFissionServer::corsMiddleware(const httplib::Request &req,
     res.set_header("Access-Control-Allow-Methods",
                    "GET, POST, PUT, DELETE, OPTIONS");
     res.set_header("Access-Control-Allow-Headers",
-                   "Content-Type, Authorization, X-Requested-With");
+                   "Content-Type, Authorization, X-Requested-With, X-Request-ID");
+    res.set_header("Access-Control-Expose-Headers",
+                   "Server-Timing, X-Request-ID");
     res.set_header("Access-Control-Max-Age", "3600");
   }
 }
@@ -592,20 +851,112 @@ void HTTPTernaryFissionServer::corsMiddleware(const httplib::Request &req,
  */
 void HTTPTernaryFissionServer::loggingMiddleware(const httplib::Request &req,
                                                  httplib::Response & /*res*/) {
-  auto start_time = std::chrono::steady_clock::now();
-
-  // We log request details
+  // We log request details; response time is recorded once the response
+  // has been written (requestCompletionLogger)
   std::time_t now = std::time(nullptr);
   std::cout << "[" << std::put_time(std::localtime(&now), "%Y-%m-%d %H:%M:%S")
             << "] " << req.method << " " << req.path << " from "
             << req.remote_addr << std::endl;
+}
 
-  // We calculate response time when response is sent
-  auto end_time = std::chrono::steady_clock::now();
-  auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
-      end_time - start_time);
+/**
+ * We open this request's phase timers and pick its request ID
+ * A valid caller-supplied X-Request-ID is echoed back; otherwise we mint one
+ */
+void HTTPTernaryFissionServer::requestTimingMiddleware(
+    const httplib::Request &req, httplib::Response & /*res*/) {
+  RequestTiming &timing = t_request_timing;
+  timing.start_ticks = CycleClock::now();
+  timing.routed_ticks = 0;
+  timing.lock_wait_start = threadLockWaitTicks();
+  timing.queue_ticks = 0;
+  timing.parse_ticks = 0;
+  timing.serialize_ticks = 0;
+
+  const std::string &incoming = req.get_header_value("X-Request-ID");
+  if (isValidRequestId(incoming)) {
+    std::snprintf(timing.request_id, sizeof(timing.request_id), "%s",
+                  incoming.c_str());
+  } else {
+    generateRequestId(timing.request_id, sizeof(timing.request_id));
+  }
+}
 
-  metrics_->updateResponseTime(static_cast<double>(duration.count()));
+/**
+ * We publish the phase breakdown as Server-Timing (milliseconds)
+ * compute is the handler time left after parse, queue and serialize
+ */
+void HTTPTernaryFissionServer::serverTimingMiddleware(
+    const httplib::Request & /*req*/, httplib::Response &res) {
+  RequestTiming &timing = t_request_timing;
+  if (timing.start_ticks == 0) {
+    return; // Rejected before routing (e.g. malformed request line)
+  }
+  timing.routed_ticks = CycleClock::now();
+  timing.queue_ticks = threadLockWaitTicks() - timing.lock_wait_start;
+
+  std::uint64_t handled = timing.routed_ticks - timing.start_ticks;
+  std::uint64_t accounted =
+      timing.parse_ticks + timing.queue_ticks + timing.serialize_ticks;
+  std::uint64_t compute = handled > accounted ? handled - accounted : 0;
+
+  char header[256];
+  std::snprintf(header, sizeof(header),
+                "parse;dur=%.3f, queue;dur=%.3f, compute;dur=%.3f, "
+                "serialize;dur=%.3f, total;dur=%.3f",
+                ticksToMilliseconds(timing.parse_ticks),
+                ticksToMilliseconds(timing.queue_ticks),
+                ticksToMilliseconds(compute),
+                ticksToMilliseconds(timing.serialize_ticks),
+                ticksToMilliseconds(handled));
+  res.set_header("Server-Timing", header);
+  res.set_header("X-Request-ID", timing.request_id);
+}
+
+/**
+ * We finish the request after its response is written: the send phase is
+ * known only now, so it appears in the slow-request log and response time
+ * metrics but not in the Server-Timing header
+ */
+void HTTPTernaryFissionServer::requestCompletionLogger(
+    const httplib::Request &req, const httplib::Response &res) {
+  RequestTiming &timing = t_request_timing;
+  if (timing.start_ticks == 0 || timing.routed_ticks == 0) {
+    return;
+  }
+  std::uint64_t finished = CycleClock::now();
+  double total_ms = ticksToMilliseconds(finished - timing.start_ticks);
+  metrics_->updateResponseTime(total_ms);
+
+  if (Flight::isEnabled()) {
+    char detail[Flight::kRecordTextBytes];
+    std::snprintf(detail, sizeof(detail), "%s %s %d %s", req.method.c_str(),
+                  req.path.c_str(), res.status, timing.request_id);
+    Flight::recordSpan("request", "http", timing.start_ticks, finished, detail);
+  }
+
+  if (slow_request_threshold_ms_ > 0 && total_ms >= slow_request_threshold_ms_) {
+    std::uint64_t handled = timing.routed_ticks - timing.start_ticks;
+    std::uint64_t accounted =
+        timing.parse_ticks + timing.queue_ticks + timing.serialize_ticks;
+    std::uint64_t compute = handled > accounted ? handled - accounted : 0;
+
+    std::time_t now = std::time(nullptr);
+    std::ostringstream line;
+    line << "[" << std::put_time(std::localtime(&now), "%Y-%m-%d %H:%M:%S")
+         << "] Slow request " << timing.request_id << ": " << req.method << " "
+         << req.path << " -> " << res.status << " in " << std::fixed
+         << std::setprecision(3) << total_ms
+         << " ms (parse=" << ticksToMilliseconds(timing.parse_ticks)
+         << " queue=" << ticksToMilliseconds(timing.queue_ticks)
+         << " compute=" << ticksToMilliseconds(compute)
+         << " serialize=" << ticksToMilliseconds(timing.serialize_ticks)
+         << " send=" << ticksToMilliseconds(finished - timing.routed_ticks)
+         << ")";
+    std::cerr << line.str() << std::endl;
+    Flight::recordLog("http", line.str());
+  }
+  timing.start_ticks = 0;
 }
 
 /**
@@ -617,7 +968,7 @@ void HTTPTernaryFissionServer::metricsMiddleware(const httplib::Request &req,
   metrics_->incrementRequests();
 
   // We track endpoint-specific metrics
-  std::lock_guard<std::mutex> lock(metrics_->metrics_mutex);
+  std::lock_guard<ProfiledMutex> lock(metrics_->metrics_mutex);
   metrics_->endpoint_counters[req.path]++;
 }
 
@@ -648,6 +999,11 @@ void HTTPTernaryFissionServer::setupAPIEndpoints() {
                 this->handleSystemStatus(req, res);
               });
 
+  server->Get("/api/v1/metrics",
+              [this](const httplib::Request &req, httplib::Response &res) {
+                this->handleMetrics(req, res);
+              });
+
   // We setup energy fields endpoints
   server->Get("/api/v1/energy-fields",
               [this](const httplib::Request &req, httplib::Response &res) {
@@ -695,6 +1051,16 @@ void HTTPTernaryFissionServer::setupAPIEndpoints() {
                 this->handlePortalTrigger(req, res);
               });
 
+  server->Get("/api/v1/portal/loads",
+              [this](const httplib::Request &req, httplib::Response &res) {
+                this->handlePortalLoadsList(req, res);
+              });
+
+  server->Delete(R"(/api/v1/portal/loads/(\d+))",
+                 [this](const httplib::Request &req, httplib::Response &res) {
+                   this->handlePortalLoadCancel(req, res);
+                 });
+
     if (media_streaming_manager_) {
         auto media_cfg = config_manager_->getMediaStreamingConfig();
         server->Get(media_cfg.icecast_mount.c_str(),
@@ -720,6 +1086,16 @@ void HTTPTernaryFissionServer::setupAPIEndpoints() {
                  this->handleFissionCalculation(req, res);
                });
 
+  server->Post("/api/v1/physics/fission/batch",
+               [this](const httplib::Request &req, httplib::Response &res) {
+                 this->handleFissionBatch(req, res);
+               });
+
+  server->Get("/api/v1/physics/nuclides",
+              [this](const httplib::Request &req, httplib::Response &res) {
+                this->handleNuclidesList(req, res);
+              });
+
   server->Post("/api/v1/physics/conservation",
                [this](const httplib::Request &req, httplib::Response &res) {
                  this->handleConservationLaws(req, res);
@@ -730,11 +1106,83 @@ void HTTPTernaryFissionServer::setupAPIEndpoints() {
                  this->handleEnergyGeneration(req, res);
                });
 
+  server->Get("/api/v1/physics/fields",
+              [this](const httplib::Request &req, httplib::Response &res) {
+                this->handlePhysicsFieldsList(req, res);
+              });
+
+  server->Get(R"(/api/v1/physics/fields/(\d+)/bytes)",
+              [this](const httplib::Request &req, httplib::Response &res) {
+                this->handlePhysicsFieldBytes(req, res);
+              });
+
   server->Get("/api/v1/statistics/fields",
               [this](const httplib::Request &req, httplib::Response &res) {
                 this->handleFieldStatistics(req, res);
               });
 
+  // We setup tracing control and export endpoints
+  server->Post("/api/v1/trace/start",
+               [this](const httplib::Request &req, httplib::Response &res) {
+                 this->handleTraceStart(req, res);
+               });
+
+  server->Post("/api/v1/trace/stop",
+               [this](const httplib::Request &req, httplib::Response &res) {
+                 this->handleTraceStop(req, res);
+               });
+
+  server->Get("/api/v1/trace",
+              [this](const httplib::Request &req, httplib::Response &res) {
+                this->handleTraceDump(req, res);
+              });
+
+  // We setup phase cycle and hardware counter endpoints
+  server->Get("/api/v1/profile/counters",
+              [this](const httplib::Request &req, httplib::Response &res) {
+                this->handleProfileCounters(req, res);
+              });
+
+  server->Put("/api/v1/profile/counters",
+              [this](const httplib::Request &req, httplib::Response &res) {
+                this->handleProfileCountersUpdate(req, res);
+              });
+
+  server->Post("/api/v1/profile/cpu",
+               [this](const httplib::Request &req, httplib::Response &res) {
+                 this->handleCpuProfile(req, res);
+               });
+
+  server->Get("/api/v1/profile/locks",
+              [this](const httplib::Request &req, httplib::Response &res) {
+                this->handleLockProfiles(req, res);
+              });
+
+  server->Delete("/api/v1/profile/locks",
+                 [this](const httplib::Request &req, httplib::Response &res) {
+                   this->handleLockProfilesReset(req, res);
+                 });
+
+  server->Get("/api/v1/profile/allocations",
+              [this](const httplib::Request &req, httplib::Response &res) {
+                this->handleAllocationProfile(req, res);
+              });
+
+  server->Delete("/api/v1/profile/allocations",
+                 [this](const httplib::Request &req, httplib::Response &res) {
+                   this->handleAllocationProfileReset(req, res);
+                 });
+
+  server->Get("/api/v1/profile/flight",
+              [this](const httplib::Request &req, httplib::Response &res) {
+                this->handleFlightRecorderStatus(req, res);
+              });
+
+  server->Post("/api/v1/profile/flight",
+               [this](const httplib::Request &req, httplib::Response &res) {
+                 this->handleFlightRecorderDump(req, res);
+               });
+
   // We setup OPTIONS handler for CORS preflight
   server->Options(".*",
                   [this](const httplib::Request &req, httplib::Response &res) {
@@ -751,6 +1199,8 @@ void HTTPTernaryFissionServer::setupAPIEndpoints() {
  */
 void HTTPTernaryFissionServer::handleHealthCheck(
     const httplib::Request & /*req*/, httplib::Response &res) {
+  TF_TRACE_SCOPE("handleHealthCheck", "http");
+  TF_ALLOC_SCOPE("http.handleHealthCheck");
   auto uptime = std::chrono::duration_cast<std::chrono::seconds>(
       std::chrono::system_clock::now() - start_time_);
 
@@ -781,6 +1231,8 @@ void HTTPTernaryFissionServer::handleHealthCheck(
  */
 void HTTPTernaryFissionServer::handleSystemStatus(
     const httplib::Request & /*req*/, httplib::Response &res) {
+  TF_TRACE_SCOPE("handleSystemStatus", "http");
+  TF_ALLOC_SCOPE("http.handleSystemStatus");
   SystemStatusResponse status = generateSystemStatus();
   sendJSONResponse(res, 200, status.toJson());
   metrics_->incrementSuccessful();
@@ -788,13 +1240,68 @@ void HTTPTernaryFissionServer::handleSystemStatus(
   std::cout << "System status endpoint served successfully" << std::endl;
 }
 
+/**
+ * We expose server counters and engine phase latency summaries in the
+ * Prometheus text format
+ */
+void HTTPTernaryFissionServer::handleMetrics(const httplib::Request & /*req*/,
+                                             httplib::Response &res) {
+  TF_TRACE_SCOPE("handleMetrics", "http");
+  TF_ALLOC_SCOPE("http.handleMetrics");
+  std::ostringstream out;
+  out << "# HELP ternary_fission_api_requests_total HTTP requests received\n"
+      << "# TYPE ternary_fission_api_requests_total counter\n"
+      << "ternary_fission_api_requests_total " << metrics_->total_requests.load()
+      << "\n"
+      << "# HELP ternary_fission_api_errors_total HTTP requests that failed\n"
+      << "# TYPE ternary_fission_api_errors_total counter\n"
+      << "ternary_fission_api_errors_total " << metrics_->error_requests.load()
+      << "\n"
+      << "# HELP ternary_fission_api_average_response_time_seconds Mean HTTP "
+         "response time\n"
+      << "# TYPE ternary_fission_api_average_response_time_seconds gauge\n"
+      << "ternary_fission_api_average_response_time_seconds "
+      << metrics_->average_response_time.load() / 1000.0 << "\n"
+      << "# HELP ternary_fission_api_active_connections Open HTTP connections\n"
+      << "# TYPE ternary_fission_api_active_connections gauge\n"
+      << "ternary_fission_api_active_connections "
+      << metrics_->active_connections.load() << "\n";
+
+  {
+    std::lock_guard<ProfiledMutex> lock(simulation_mutex_);
+    if (simulation_engine_) {
+      out << "# HELP ternary_fission_engine_events_total Fission events "
+             "simulated\n"
+          << "# TYPE ternary_fission_engine_events_total counter\n"
+          << "ternary_fission_engine_events_total "
+          << simulation_engine_->getTotalEventsSimulated() << "\n"
+          << "# HELP ternary_fission_engine_energy_fields_total Energy fields "
+             "created\n"
+          << "# TYPE ternary_fission_engine_energy_fields_total counter\n"
+          << "ternary_fission_engine_energy_fields_total "
+          << simulation_engine_->getTotalEnergyFieldsCreated() << "\n";
+      out << simulation_engine_->getFieldFillPrometheus();
+      out << simulation_engine_->getDissipationPrometheus();
+      out << simulation_engine_->getCpuBurnPrometheus();
+    }
+  }
+  out << Perf::phaseLatenciesToPrometheus();
+  out << Governor::toPrometheus();
+
+  res.status = 200;
+  res.set_content(out.str(), "text/plain; version=0.0.4");
+  metrics_->incrementSuccessful();
+}
+
 /**
  * We handle energy fields list endpoint requests
  * This method returns all active energy fields
  */
 void HTTPTernaryFissionServer::handleEnergyFieldsList(
     const httplib::Request & /*req*/, httplib::Response &res) {
-  std::lock_guard<std::mutex> lock(fields_mutex_);
+  TF_TRACE_SCOPE("handleEnergyFieldsList", "http");
+  TF_ALLOC_SCOPE("http.handleEnergyFieldsList");
+  std::lock_guard<ProfiledMutex> lock(fields_mutex_);
 
   Json::Value fields_array(Json::arrayValue);
   for (const auto &[field_id, field] : energy_fields_) {
@@ -817,6 +1324,8 @@ void HTTPTernaryFissionServer::handleEnergyFieldsList(
  */
 void HTTPTernaryFissionServer::handleEnergyFieldCreate(
     const httplib::Request &req, httplib::Response &res) {
+  TF_TRACE_SCOPE("handleEnergyFieldCreate", "http");
+  TF_ALLOC_SCOPE("http.handleEnergyFieldCreate");
   Json::Value request_json;
   if (!parseJSONRequest(req, request_json)) {
     sendErrorResponse(res, 400, "Invalid JSON request body");
@@ -847,7 +1356,7 @@ void HTTPTernaryFissionServer::handleEnergyFieldCreate(
     return;
   }
 
-  std::lock_guard<std::mutex> lock(fields_mutex_);
+  std::lock_guard<ProfiledMutex> lock(fields_mutex_);
   std::string field_id = field->field_id;
   energy_fields_[field_id] = std::move(field);
 
@@ -902,6 +1411,9 @@ SystemStatusResponse HTTPTernaryFissionServer::generateSystemStatus() const {
 void HTTPTernaryFissionServer::sendJSONResponse(httplib::Response &res,
                                                 int status_code,
                                                 const Json::Value &json) {
+  TF_TRACE_SCOPE("sendJSONResponse", "http");
+  TF_ALLOC_SCOPE("http.sendJSONResponse");
+  RequestPhaseTimer phase(t_request_timing.serialize_ticks);
   Json::StreamWriterBuilder builder;
   builder["indentation"] = "  ";
   std::string json_string = Json::writeString(builder, json);
@@ -937,6 +1449,9 @@ void HTTPTernaryFissionServer::sendErrorResponse(httplib::Response &res,
  */
 bool HTTPTernaryFissionServer::parseJSONRequest(const httplib::Request &req,
                                                 Json::Value &json) {
+  TF_TRACE_SCOPE("parseJSONRequest", "http");
+  TF_ALLOC_SCOPE("http.parseJSONRequest");
+  RequestPhaseTimer phase(t_request_timing.parse_ticks);
   try {
     Json::CharReaderBuilder builder;
     Json::CharReader *reader = builder.newCharReader();
@@ -1069,7 +1584,49 @@ void HTTPTernaryFissionServer::setupSSLServer() {
  * This method sets up communication with the physics simulation engine
  */
 bool HTTPTernaryFissionServer::initializePhysicsEngine() {
-  // Physics engine integration will be implemented when engine is available
+  // We keep an engine injected through setSimulationEngine()
+  if (simulation_engine_) {
+    std::cout << "Physics engine integration initialized" << std::endl;
+    return true;
+  }
+
+  try {
+    const auto &physics_config = config_manager_->getPhysicsConfig();
+    int threads = physics_config.default_thread_count;
+    if (threads <= 0) {
+      threads = static_cast<int>(
+          std::max(1u, std::thread::hardware_concurrency()));
+    }
+    simulation_engine_ = std::make_shared<TernaryFissionSimulationEngine>(
+        physics_config.default_parent_mass,
+        physics_config.default_excitation_energy, threads);
+    simulation_engine_->configureFieldFill(
+        static_cast<unsigned>(physics_config.field_fill_threads),
+        static_cast<std::size_t>(physics_config.field_fill_max_in_flight_bytes));
+    DissipationScheduler::Settings dissipation;
+    dissipation.slice_bytes = static_cast<std::size_t>(physics_config.dissipation_slice_bytes);
+    dissipation.bytes_per_tick = static_cast<std::size_t>(physics_config.dissipation_bytes_per_tick);
+    dissipation.cpu_usage_limit_percent = physics_config.cpu_usage_limit;
+    simulation_engine_->configureDissipation(dissipation);
+    CpuBurnExecutor::Settings burn;
+    burn.threads = static_cast<unsigned>(physics_config.cpu_burn_threads);
+    CpuBurnExecutor::parsePolicy(physics_config.cpu_burn_policy, burn.policy);
+    burn.cpu_usage_limit_percent = physics_config.cpu_burn_limit;
+    simulation_engine_->configureCpuBurn(burn);
+    FragmentYieldModel yields;
+    yields.light_fragment_mean = physics_config.light_fragment_mean;
+    yields.light_fragment_sigma = physics_config.light_fragment_sigma;
+    yields.heavy_fragment_mean = physics_config.heavy_fragment_mean;
+    yields.heavy_fragment_sigma = physics_config.heavy_fragment_sigma;
+    yields.charge_sigma = physics_config.fragment_charge_sigma;
+    yields.yield_file = physics_config.fragment_yield_file;
+    simulation_engine_->configureFragmentYields(yields);
+  } catch (const std::exception &e) {
+    std::cerr << "Error: Failed to create physics engine: " << e.what()
+              << std::endl;
+    return false;
+  }
+
   std::cout << "Physics engine integration initialized" << std::endl;
   return true;
 }
@@ -1108,9 +1665,9 @@ void HTTPTernaryFissionServer::broadcastWebSocketUpdates() {
     builder["indentation"] = "";
     std::string message = Json::writeString(builder, status.toJson());
 
-    std::lock_guard<std::mutex> lock(websocket_mutex_);
+    std::lock_guard<ProfiledMutex> lock(websocket_mutex_);
     for (auto &[id, connection] : websocket_connections_) {
-      std::lock_guard<std::mutex> qlock(connection->queue_mutex);
+      std::lock_guard<ProfiledMutex> qlock(connection->queue_mutex);
       connection->message_queue.push(message);
     }
   }
@@ -1121,7 +1678,7 @@ void HTTPTernaryFissionServer::broadcastWebSocketUpdates() {
  * This method closes all active WebSocket connections during shutdown
  */
 void HTTPTernaryFissionServer::cleanupWebSocketConnections() {
-  std::lock_guard<std::mutex> lock(websocket_mutex_);
+  std::lock_guard<ProfiledMutex> lock(websocket_mutex_);
   websocket_connections_.clear();
   std::cout << "WebSocket connections cleaned up" << std::endl;
 }
@@ -1151,7 +1708,7 @@ void HTTPTernaryFissionServer::collectMetrics() {
  * This method recalculates field statistics for monitoring
  */
 void HTTPTernaryFissionServer::updateFieldStatistics() {
-  std::lock_guard<std::mutex> lock(fields_mutex_);
+  std::lock_guard<ProfiledMutex> lock(fields_mutex_);
 
   // We update field timestamps and status
   for (auto &[field_id, field] : energy_fields_) {
@@ -1172,9 +1729,11 @@ void HTTPTernaryFissionServer::updateFieldStatistics() {
 // We implement placeholder handlers for remaining endpoints
 void HTTPTernaryFissionServer::handleEnergyFieldGet(const httplib::Request &req,
                                                     httplib::Response &res) {
+  TF_TRACE_SCOPE("handleEnergyFieldGet", "http");
+  TF_ALLOC_SCOPE("http.handleEnergyFieldGet");
   std::string field_id = req.matches[1];
 
-  std::lock_guard<std::mutex> lock(fields_mutex_);
+  std::lock_guard<ProfiledMutex> lock(fields_mutex_);
   auto it = energy_fields_.find(field_id);
 
   if (it == energy_fields_.end()) {
@@ -1189,6 +1748,8 @@ void HTTPTernaryFissionServer::handleEnergyFieldGet(const httplib::Request &req,
 
 void HTTPTernaryFissionServer::handleEnergyFieldUpdate(
     const httplib::Request &req, httplib::Response &res) {
+  TF_TRACE_SCOPE("handleEnergyFieldUpdate", "http");
+  TF_ALLOC_SCOPE("http.handleEnergyFieldUpdate");
   std::string field_id = req.matches[1];
 
   Json::Value request_json;
@@ -1198,7 +1759,7 @@ void HTTPTernaryFissionServer::handleEnergyFieldUpdate(
     return;
   }
 
-  std::lock_guard<std::mutex> lock(fields_mutex_);
+  std::lock_guard<ProfiledMutex> lock(fields_mutex_);
   auto it = energy_fields_.find(field_id);
   if (it == energy_fields_.end()) {
     sendErrorResponse(res, 404, "Energy field not found");
@@ -1295,9 +1856,11 @@ void HTTPTernaryFissionServer::handleEnergyFieldUpdate(
 
 void HTTPTernaryFissionServer::handleEnergyFieldDelete(
     const httplib::Request &req, httplib::Response &res) {
+  TF_TRACE_SCOPE("handleEnergyFieldDelete", "http");
+  TF_ALLOC_SCOPE("http.handleEnergyFieldDelete");
   std::string field_id = req.matches[1];
 
-  std::lock_guard<std::mutex> lock(fields_mutex_);
+  std::lock_guard<ProfiledMutex> lock(fields_mutex_);
   auto it = energy_fields_.find(field_id);
 
   if (it == energy_fields_.end()) {
@@ -1318,6 +1881,8 @@ void HTTPTernaryFissionServer::handleEnergyFieldDelete(
 
 void HTTPTernaryFissionServer::handleSimulationStart(
     const httplib::Request &req, httplib::Response &res) {
+  TF_TRACE_SCOPE("handleSimulationStart", "http");
+  TF_ALLOC_SCOPE("http.handleSimulationStart");
   Json::Value request_json;
   if (!req.body.empty() && !parseJSONRequest(req, request_json)) {
     sendErrorResponse(res, 400, "Invalid JSON request body");
@@ -1325,7 +1890,7 @@ void HTTPTernaryFissionServer::handleSimulationStart(
     return;
   }
 
-  std::lock_guard<std::mutex> lock(simulation_mutex_);
+  std::lock_guard<ProfiledMutex> lock(simulation_mutex_);
   if (!simulation_engine_) {
     sendErrorResponse(res, 500, "Simulation engine not initialized");
     metrics_->incrementErrors();
@@ -1352,7 +1917,9 @@ void HTTPTernaryFissionServer::handleSimulationStart(
 
 void HTTPTernaryFissionServer::handleSimulationStop(
     const httplib::Request & /*req*/, httplib::Response &res) {
-  std::lock_guard<std::mutex> lock(simulation_mutex_);
+  TF_TRACE_SCOPE("handleSimulationStop", "http");
+  TF_ALLOC_SCOPE("http.handleSimulationStop");
+  std::lock_guard<ProfiledMutex> lock(simulation_mutex_);
   if (!simulation_engine_) {
     sendErrorResponse(res, 500, "Simulation engine not initialized");
     metrics_->incrementErrors();
@@ -1372,7 +1939,9 @@ void HTTPTernaryFissionServer::handleSimulationStop(
 
 void HTTPTernaryFissionServer::handleSimulationReset(
     const httplib::Request & /*req*/, httplib::Response &res) {
-  std::lock_guard<std::mutex> lock(simulation_mutex_);
+  TF_TRACE_SCOPE("handleSimulationReset", "http");
+  TF_ALLOC_SCOPE("http.handleSimulationReset");
+  std::lock_guard<ProfiledMutex> lock(simulation_mutex_);
   if (!simulation_engine_) {
     sendErrorResponse(res, 500, "Simulation engine not initialized");
     metrics_->incrementErrors();
@@ -1380,10 +1949,7 @@ void HTTPTernaryFissionServer::handleSimulationReset(
   }
 
   try {
-    simulation_engine_->shutdown();
-    simulation_engine_ = std::make_shared<TernaryFissionSimulationEngine>();
-
-    Json::Value response;
+    Json::Value response = simulation_engine_->reset();
     response["status"] = "success";
     response["message"] = "Simulation reset successfully";
     response["simulation_running"] = false;
@@ -1399,10 +1965,13 @@ void HTTPTernaryFissionServer::handleSimulationReset(
 
 /**
  * We handle portal trigger endpoint requests
- * This method schedules a timed energy load through the simulation engine
+ * This method schedules a timed energy load through the simulation engine, or
+ * adds additional_power_mev to an active load when portal_id is given
  */
 void HTTPTernaryFissionServer::handlePortalTrigger(const httplib::Request &req,
                                                    httplib::Response &res) {
+  TF_TRACE_SCOPE("handlePortalTrigger", "http");
+  TF_ALLOC_SCOPE("http.handlePortalTrigger");
   Json::Value body;
   if (!parseJSONRequest(req, body)) {
     sendErrorResponse(res, 400, "Invalid JSON request body");
@@ -1417,37 +1986,121 @@ void HTTPTernaryFissionServer::handlePortalTrigger(const httplib::Request &req,
   double power = body.get("power_level_mev", 0.0).asDouble();
   double extra = body.get("additional_power_mev", 0.0).asDouble();
 
-  double estimated =
-      calculateEstimatedPower(power, static_cast<int>(duration), extra);
-  double extension = 1.0;
-  if (power > 0.0 && extra > 0.0) {
-    extension += extra / power;
-  }
-  double adjusted_duration = duration * extension;
-  double total_power = power + extra;
-
+  std::uint64_t portal_id = 0;
   {
-    std::lock_guard<std::mutex> lock(simulation_mutex_);
+    std::lock_guard<ProfiledMutex> lock(simulation_mutex_);
     if (!simulation_engine_) {
       sendErrorResponse(res, 500, "Simulation engine not initialized");
       metrics_->incrementErrors();
       return;
     }
-    simulation_engine_->startPortalLoad(adjusted_duration, total_power);
-    auto start = std::chrono::system_clock::now();
-    auto end =
-        start + std::chrono::seconds(static_cast<int>(adjusted_duration));
-    simulation_engine_->setPortalEventState(start, end, estimated);
+
+    if (body.isMember("portal_id")) {
+      portal_id = body["portal_id"].asUInt64();
+      if (extra <= 0.0) {
+        sendErrorResponse(res, 400, "additional_power_mev must be positive to extend a portal");
+        metrics_->incrementErrors();
+        return;
+      }
+    }
+    try {
+      if (!body.isMember("portal_id")) {
+        portal_id = simulation_engine_->startPortalLoad(duration, power, extra);
+        if (portal_id == 0) {
+          sendErrorResponse(res, 409, "Portal load cancelled by a simulation reset");
+          metrics_->incrementErrors();
+          return;
+        }
+      } else if (!simulation_engine_->extendPortalLoad(portal_id, extra)) {
+        sendErrorResponse(res, 404, "Portal load not active");
+        metrics_->incrementErrors();
+        return;
+      }
+    } catch (const Governor::MemoryBudgetExceeded &e) {
+      sendErrorResponse(res, 503,
+                        std::string("Portal load rejected: ") + e.what());
+      metrics_->incrementErrors();
+      return;
+    }
   }
 
   Json::Value ack;
-  ack["scheduled_duration_seconds"] = adjusted_duration;
-  ack["projected_power_level_mev"] = total_power;
+  ack["portal_id"] = static_cast<Json::UInt64>(portal_id);
+  if (body.isMember("portal_id")) {
+    ack["additional_power_mev"] = extra;
+  } else {
+    double extension = 1.0;
+    if (power > 0.0 && extra > 0.0) {
+      extension += extra / power;
+    }
+    ack["scheduled_duration_seconds"] = duration * extension;
+    ack["projected_power_level_mev"] = power + extra;
+  }
 
   sendJSONResponse(res, 200, ack);
   metrics_->incrementSuccessful();
 }
 
+/**
+ * We list active portal loads with their fields and remaining time
+ */
+void HTTPTernaryFissionServer::handlePortalLoadsList(
+    const httplib::Request & /*req*/, httplib::Response &res) {
+  TF_TRACE_SCOPE("handlePortalLoadsList", "http");
+  TF_ALLOC_SCOPE("http.handlePortalLoadsList");
+  Json::Value response;
+  {
+    std::lock_guard<ProfiledMutex> lock(simulation_mutex_);
+    if (!simulation_engine_) {
+      sendErrorResponse(res, 500, "Simulation engine not initialized");
+      metrics_->incrementErrors();
+      return;
+    }
+    response = simulation_engine_->getPortalLoadsAPI();
+  }
+  sendJSONResponse(res, 200, response);
+  metrics_->incrementSuccessful();
+}
+
+/**
+ * We cancel an active portal load and release its fields
+ */
+void HTTPTernaryFissionServer::handlePortalLoadCancel(
+    const httplib::Request &req, httplib::Response &res) {
+  TF_TRACE_SCOPE("handlePortalLoadCancel", "http");
+  TF_ALLOC_SCOPE("http.handlePortalLoadCancel");
+  std::uint64_t portal_id = 0;
+  try {
+    portal_id = std::stoull(req.matches[1].str());
+  } catch (const std::exception &) {
+    sendErrorResponse(res, 400, "portal id must be an unsigned integer");
+    metrics_->incrementErrors();
+    return;
+  }
+
+  bool cancelled = false;
+  {
+    std::lock_guard<ProfiledMutex> lock(simulation_mutex_);
+    if (!simulation_engine_) {
+      sendErrorResponse(res, 500, "Simulation engine not initialized");
+      metrics_->incrementErrors();
+      return;
+    }
+    cancelled = simulation_engine_->cancelPortalLoad(portal_id);
+  }
+  if (!cancelled) {
+    sendErrorResponse(res, 404, "Portal load not active");
+    metrics_->incrementErrors();
+    return;
+  }
+
+  Json::Value response;
+  response["message"] = "Portal load cancelled";
+  response["portal_id"] = static_cast<Json::UInt64>(portal_id);
+  sendJSONResponse(res, 200, response);
+  metrics_->incrementSuccessful();
+}
+
 void HTTPTernaryFissionServer::handleStreamStart(
     const httplib::Request & /*req*/, httplib::Response &res) {
   if (!media_streaming_manager_) {
@@ -1513,6 +2166,8 @@ void HTTPTernaryFissionServer::handleStreamProxy(
 
 void HTTPTernaryFissionServer::handleFissionCalculation(
     const httplib::Request &req, httplib::Response &res) {
+  TF_TRACE_SCOPE("handleFissionCalculation", "http");
+  TF_ALLOC_SCOPE("http.handleFissionCalculation");
   Json::Value body;
   if (!parseJSONRequest(req, body)) {
     sendErrorResponse(res, 400, "Invalid JSON payload");
@@ -1526,66 +2181,204 @@ void HTTPTernaryFissionServer::handleFissionCalculation(
     return;
   }
 
-  double parent_mass = body.get("parent_mass", 0.0).asDouble();
-  double excitation_energy = body.get("excitation_energy", 0.0).asDouble();
+  double parent_mass = 0.0;
+  double excitation_energy = 0.0;
+  std::string nuclide;
+  std::string error;
+  if (!parseFissionParameters(body, parent_mass, excitation_energy, nuclide,
+                              false, error)) {
+    sendErrorResponse(res, 400, error);
+    metrics_->incrementErrors();
+    return;
+  }
+
+  try {
+    TernaryFissionEvent event =
+        nuclide.empty()
+            ? simulation_engine_->simulateTernaryFissionEvent(parent_mass,
+                                                              excitation_energy)
+            : simulation_engine_->simulateTernaryFissionEvent(nuclide,
+                                                              excitation_energy);
+
+    Json::Value response;
+    response["nuclide"] = NuclideRegistry::symbolFor(
+        event.parent_atomic_number, event.parent_mass_number);
+    response["q_value"] = event.q_value;
+    response["total_kinetic_energy"] = event.total_kinetic_energy;
+    response["heavy_fragment"] = fissionFragmentToJson(event.heavy_fragment);
+    response["light_fragment"] = fissionFragmentToJson(event.light_fragment);
+    response["alpha_particle"] = fissionFragmentToJson(event.alpha_particle);
+
+    sendJSONResponse(res, 200, response);
+  } catch (const std::invalid_argument &e) {
+    sendErrorResponse(res, 400, e.what());
+    metrics_->incrementErrors();
+  } catch (const std::exception &e) {
+    sendErrorResponse(res, 500,
+                      std::string("Fission calculation failed: ") + e.what());
+    metrics_->incrementErrors();
+  }
+}
+
+/**
+ * We simulate several events in one request
+ * Body: {"parent_mass" or "nuclide", "excitation_energy", "count": 1-100 (default 10)}
+ * or {"nuclides": ["U-235", "Cf-252", ...], "excitation_energy"} with one parent per
+ * event; the engine generates each nuclide's events together
+ */
+void HTTPTernaryFissionServer::handleFissionBatch(const httplib::Request &req,
+                                                  httplib::Response &res) {
+  TF_TRACE_SCOPE("handleFissionBatch", "http");
+  TF_ALLOC_SCOPE("http.handleFissionBatch");
+  Json::Value body;
+  if (!parseJSONRequest(req, body)) {
+    sendErrorResponse(res, 400, "Invalid JSON payload");
+    metrics_->incrementErrors();
+    return;
+  }
+
+  if (!simulation_engine_) {
+    sendErrorResponse(res, 500, "Simulation engine unavailable");
+    metrics_->incrementErrors();
+    return;
+  }
 
-  if (parent_mass <= 0.0 || parent_mass > 300.0) {
-    sendErrorResponse(res, 400, "parent_mass must be between 0 and 300 AMU");
+  double parent_mass = 0.0;
+  double excitation_energy = 0.0;
+  std::string nuclide;
+  std::string error;
+  if (!parseFissionParameters(body, parent_mass, excitation_energy, nuclide,
+                              true, error)) {
+    sendErrorResponse(res, 400, error);
     metrics_->incrementErrors();
     return;
   }
 
-  if (excitation_energy < 0.0 || excitation_energy > 100.0) {
+  std::vector<std::string> nuclides;
+  int count = body.get("count", 10).asInt();
+  if (body.isMember("nuclides")) {
+    const Json::Value &list = body["nuclides"];
+    if (!list.isArray()) {
+      sendErrorResponse(res, 400, "nuclides must be an array of symbols");
+      metrics_->incrementErrors();
+      return;
+    }
+    for (const Json::Value &entry : list) {
+      if (!entry.isString()) {
+        sendErrorResponse(res, 400, "nuclides must be an array of symbols");
+        metrics_->incrementErrors();
+        return;
+      }
+      nuclides.push_back(entry.asString());
+    }
+    count = static_cast<int>(nuclides.size());
+  }
+  if (count < 1 || count > kMaxFissionBatch) {
     sendErrorResponse(res, 400,
-                      "excitation_energy must be between 0 and 100 MeV");
+                      "count must be between 1 and " +
+                          std::to_string(kMaxFissionBatch));
     metrics_->incrementErrors();
     return;
   }
+  if (nuclides.empty() && !nuclide.empty()) {
+    nuclides.assign(static_cast<std::size_t>(count), nuclide);
+  }
 
   try {
-    TernaryFissionEvent event = simulation_engine_->simulateTernaryFissionEvent(
-        parent_mass, excitation_energy);
-
-    Json::Value response;
-    response["q_value"] = event.q_value;
-    response["total_kinetic_energy"] = event.total_kinetic_energy;
-
-    auto serializeFragment = [](const FissionFragment &frag) {
-      Json::Value jf;
-      jf["mass"] = frag.mass;
-      jf["atomic_number"] = static_cast<Json::Int64>(frag.atomic_number);
-      jf["mass_number"] = static_cast<Json::Int64>(frag.mass_number);
-      jf["kinetic_energy"] = frag.kinetic_energy;
-      jf["binding_energy"] = frag.binding_energy;
-      jf["excitation_energy"] = frag.excitation_energy;
-      jf["half_life"] = frag.half_life;
-      Json::Value momentum;
-      momentum["x"] = frag.momentum.x;
-      momentum["y"] = frag.momentum.y;
-      momentum["z"] = frag.momentum.z;
-      jf["momentum"] = momentum;
-      Json::Value position;
-      position["x"] = frag.position.x;
-      position["y"] = frag.position.y;
-      position["z"] = frag.position.z;
-      jf["position"] = position;
-      return jf;
-    };
+    std::vector<TernaryFissionEvent> simulated;
+    if (nuclides.empty()) {
+      simulated.reserve(static_cast<std::size_t>(count));
+      for (int i = 0; i < count; ++i) {
+        simulated.push_back(simulation_engine_->simulateTernaryFissionEvent(
+            parent_mass, excitation_energy));
+      }
+    } else {
+      simulated = simulation_engine_->simulateTernaryFissionEvents(
+          nuclides, excitation_energy);
+    }
 
-    response["heavy_fragment"] = serializeFragment(event.heavy_fragment);
-    response["light_fragment"] = serializeFragment(event.light_fragment);
-    response["alpha_particle"] = serializeFragment(event.alpha_particle);
+    Json::Value events(Json::arrayValue);
+    double q_value_sum = 0.0;
+    double kinetic_energy_sum = 0.0;
+    for (const TernaryFissionEvent &event : simulated) {
+      q_value_sum += event.q_value;
+      kinetic_energy_sum += event.total_kinetic_energy;
+
+      Json::Value json;
+      json["event_id"] = static_cast<Json::UInt64>(event.event_id);
+      json["nuclide"] = NuclideRegistry::symbolFor(event.parent_atomic_number,
+                                                   event.parent_mass_number);
+      json["q_value"] = event.q_value;
+      json["total_kinetic_energy"] = event.total_kinetic_energy;
+      json["energy_conserved"] = event.energy_conserved;
+      json["momentum_conserved"] = event.momentum_conserved;
+      json["heavy_fragment"] = fissionFragmentToJson(event.heavy_fragment);
+      json["light_fragment"] = fissionFragmentToJson(event.light_fragment);
+      json["alpha_particle"] = fissionFragmentToJson(event.alpha_particle);
+      events.append(json);
+    }
 
+    Json::Value response;
+    response["count"] = count;
+    response["mean_q_value"] = q_value_sum / count;
+    response["mean_total_kinetic_energy"] = kinetic_energy_sum / count;
+    response["events"] = events;
     sendJSONResponse(res, 200, response);
+  } catch (const std::invalid_argument &e) {
+    sendErrorResponse(res, 400, e.what());
+    metrics_->incrementErrors();
   } catch (const std::exception &e) {
     sendErrorResponse(res, 500,
-                      std::string("Fission calculation failed: ") + e.what());
+                      std::string("Fission batch failed: ") + e.what());
     metrics_->incrementErrors();
   }
 }
 
+/**
+ * We list the registered parents with their precomputed data
+ */
+void HTTPTernaryFissionServer::handleNuclidesList(
+    const httplib::Request & /*req*/, httplib::Response &res) {
+  TF_TRACE_SCOPE("handleNuclidesList", "http");
+  TF_ALLOC_SCOPE("http.handleNuclidesList");
+  std::shared_ptr<const NuclideRegistry> registry;
+  {
+    std::lock_guard<ProfiledMutex> lock(simulation_mutex_);
+    if (!simulation_engine_) {
+      sendErrorResponse(res, 500, "Simulation engine not initialized");
+      metrics_->incrementErrors();
+      return;
+    }
+    registry = simulation_engine_->getNuclideRegistry();
+  }
+  Json::Value nuclides(Json::arrayValue);
+  if (registry) {
+    for (std::size_t i = 0; i < registry->size(); ++i) {
+      const Nuclide &nuclide = registry->at(i);
+      Json::Value json;
+      json["nuclide"] = nuclide.symbol;
+      json["atomic_number"] = nuclide.atomic_number;
+      json["mass_number"] = nuclide.mass_number;
+      json["mass"] = nuclide.mass;
+      json["binding_energy"] = nuclide.binding_energy;
+      json["ternary_probability"] = nuclide.ternary_probability;
+      json["alpha_fraction"] = nuclide.alpha_fraction;
+      json["fragment_pairs"] = static_cast<Json::UInt64>(
+          nuclide.yields ? nuclide.yields->size() : 0);
+      json["default"] = &nuclide == &registry->defaultNuclide();
+      nuclides.append(json);
+    }
+  }
+  Json::Value response;
+  response["nuclides"] = nuclides;
+  sendJSONResponse(res, 200, response);
+  metrics_->incrementSuccessful();
+}
+
 void HTTPTernaryFissionServer::handleConservationLaws(
     const httplib::Request &req, httplib::Response &res) {
+  TF_TRACE_SCOPE("handleConservationLaws", "http");
+  TF_ALLOC_SCOPE("http.handleConservationLaws");
   Json::Value body;
   if (!parseJSONRequest(req, body)) {
     sendErrorResponse(res, 400, "Invalid JSON payload");
@@ -1660,6 +2453,8 @@ void HTTPTernaryFissionServer::handleConservationLaws(
 
 void HTTPTernaryFissionServer::handleEnergyGeneration(
     const httplib::Request &req, httplib::Response &res) {
+  TF_TRACE_SCOPE("handleEnergyGeneration", "http");
+  TF_ALLOC_SCOPE("http.handleEnergyGeneration");
   Json::Value body;
   if (!parseJSONRequest(req, body)) {
     sendErrorResponse(res, 400, "Invalid JSON payload");
@@ -1693,6 +2488,8 @@ void HTTPTernaryFissionServer::handleEnergyGeneration(
     jf["energy_mev"] = field.energy_mev;
     jf["memory_bytes"] = static_cast<Json::UInt64>(field.memory_bytes);
     jf["cpu_cycles"] = static_cast<Json::UInt64>(field.cpu_cycles);
+    jf["measured_cycles"] = Perf::fieldCyclesToJson(field);
+    jf["memory"] = FieldMemory::fieldMemoryToJson(field);
     jf["entropy_factor"] = field.entropy_factor;
     jf["dissipation_rate"] = field.dissipation_rate;
     jf["stability_factor"] = field.stability_factor;
@@ -1703,8 +2500,13 @@ void HTTPTernaryFissionServer::handleEnergyGeneration(
         std::chrono::duration_cast<std::chrono::milliseconds>(time_since_epoch)
             .count();
     jf["creation_time_ms"] = static_cast<Json::Int64>(timestamp_ms);
+    releaseEnergyField(field);
 
     sendJSONResponse(res, 200, jf);
+  } catch (const Governor::MemoryBudgetExceeded &e) {
+    sendErrorResponse(res, 503,
+                      std::string("Energy generation rejected: ") + e.what());
+    metrics_->incrementErrors();
   } catch (const std::exception &e) {
     sendErrorResponse(res, 500,
                       std::string("Energy generation failed: ") + e.what());
@@ -1714,14 +2516,334 @@ void HTTPTernaryFissionServer::handleEnergyGeneration(
 
 void HTTPTernaryFissionServer::handleFieldStatistics(
     const httplib::Request & /*req*/, httplib::Response &res) {
+  TF_TRACE_SCOPE("handleFieldStatistics", "http");
+  TF_ALLOC_SCOPE("http.handleFieldStatistics");
   Json::Value stats = computeFieldStatistics();
   sendJSONResponse(res, 200, stats);
   metrics_->incrementSuccessful();
 }
 
+/**
+ * We list the engine's active energy fields with their backing memory
+ */
+void HTTPTernaryFissionServer::handlePhysicsFieldsList(
+    const httplib::Request & /*req*/, httplib::Response &res) {
+  TF_TRACE_SCOPE("handlePhysicsFieldsList", "http");
+  TF_ALLOC_SCOPE("http.handlePhysicsFieldsList");
+  std::shared_ptr<TernaryFissionSimulationEngine> engine;
+  {
+    std::lock_guard<ProfiledMutex> lock(simulation_mutex_);
+    engine = simulation_engine_;
+  }
+  if (!engine) {
+    sendErrorResponse(res, 500, "Simulation engine not initialized");
+    metrics_->incrementErrors();
+    return;
+  }
+
+  sendJSONResponse(res, 200, engine->getEnergyFieldsAPI());
+  metrics_->incrementSuccessful();
+}
+
+/**
+ * We return bytes [offset, offset + length) of an engine field
+ * Virtual fields are regenerated for the requested range only; length
+ * defaults to 4096 and is capped at 16 MiB per request
+ */
+void HTTPTernaryFissionServer::handlePhysicsFieldBytes(
+    const httplib::Request &req, httplib::Response &res) {
+  TF_TRACE_SCOPE("handlePhysicsFieldBytes", "http");
+  TF_ALLOC_SCOPE("http.handlePhysicsFieldBytes");
+  const std::size_t kMaxLength = 16 * 1024 * 1024;
+
+  std::uint64_t field_id = 0;
+  std::size_t offset = 0;
+  std::size_t length = 4096;
+  try {
+    field_id = std::stoull(req.matches[1].str());
+    if (req.has_param("offset")) {
+      offset = std::stoull(req.get_param_value("offset"));
+    }
+    if (req.has_param("length")) {
+      length = std::stoull(req.get_param_value("length"));
+    }
+  } catch (const std::exception &) {
+    sendErrorResponse(res, 400, "field id, offset and length must be unsigned integers");
+    metrics_->incrementErrors();
+    return;
+  }
+  if (length > kMaxLength) {
+    sendErrorResponse(res, 400, "length must not exceed 16777216 bytes");
+    metrics_->incrementErrors();
+    return;
+  }
+
+  std::shared_ptr<TernaryFissionSimulationEngine> engine;
+  {
+    std::lock_guard<ProfiledMutex> lock(simulation_mutex_);
+    engine = simulation_engine_;
+  }
+  if (!engine) {
+    sendErrorResponse(res, 500, "Simulation engine not initialized");
+    metrics_->incrementErrors();
+    return;
+  }
+
+  std::string bytes;
+  if (!engine->readEnergyFieldBytes(field_id, offset, length, bytes)) {
+    sendErrorResponse(res, 404, "Energy field not found");
+    metrics_->incrementErrors();
+    return;
+  }
+  res.status = 200;
+  res.set_header("X-Field-Offset", std::to_string(offset));
+  res.set_content(bytes, "application/octet-stream");
+  metrics_->incrementSuccessful();
+}
+
+/**
+ * We start span recording, optionally discarding previously captured spans
+ * Passing ?clear=false keeps earlier spans in the rings
+ */
+void HTTPTernaryFissionServer::handleTraceStart(const httplib::Request &req,
+                                                httplib::Response &res) {
+  bool clear = !(req.has_param("clear") && req.get_param_value("clear") == "false");
+  if (clear) {
+    Trace::clear();
+  }
+  Trace::setEnabled(true);
+
+  Json::Value response;
+  response["tracing"] = true;
+  response["cleared"] = clear;
+  response["ring_capacity"] = static_cast<Json::UInt64>(Trace::ringCapacity());
+  sendJSONResponse(res, 200, response);
+  metrics_->incrementSuccessful();
+}
+
+/**
+ * We stop span recording; captured spans stay available for export
+ */
+void HTTPTernaryFissionServer::handleTraceStop(const httplib::Request & /*req*/,
+                                               httplib::Response &res) {
+  Trace::setEnabled(false);
+
+  Json::Value response;
+  response["tracing"] = false;
+  sendJSONResponse(res, 200, response);
+  metrics_->incrementSuccessful();
+}
+
+/**
+ * We export captured spans as Chrome trace-event JSON
+ * The body loads directly in chrome://tracing or ui.perfetto.dev
+ */
+void HTTPTernaryFissionServer::handleTraceDump(const httplib::Request & /*req*/,
+                                               httplib::Response &res) {
+  res.set_content(Trace::dumpChromeTrace(), "application/json");
+  res.status = 200;
+  res.set_header("Cache-Control", "no-cache");
+  res.set_header("Content-Disposition", "attachment; filename=\"trace.json\"");
+  metrics_->incrementSuccessful();
+}
+
+/**
+ * We report per-phase TSC cycles, latency percentiles, optional hardware
+ * counters, field memory backings, memory governor decisions and the
+ * measured cycles held by live engine fields
+ */
+void HTTPTernaryFissionServer::handleProfileCounters(
+    const httplib::Request & /*req*/, httplib::Response &res) {
+  TF_TRACE_SCOPE("handleProfileCounters", "http");
+  TF_ALLOC_SCOPE("http.handleProfileCounters");
+  Json::Value counters = Perf::phaseCountersToJson();
+  counters["phase_latency_us"] = Perf::phaseLatenciesToJson();
+  counters["field_memory"] = FieldMemory::statsToJson();
+  counters["memory_governor"] = Governor::statsToJson();
+  {
+    std::lock_guard<ProfiledMutex> lock(simulation_mutex_);
+    if (simulation_engine_) {
+      counters["fields"] = simulation_engine_->getFieldCyclesAPI();
+      counters["field_fill"] = simulation_engine_->getFieldFillAPI();
+      counters["dissipation"] = simulation_engine_->getDissipationAPI();
+      counters["cpu_burn"] = simulation_engine_->getCpuBurnAPI();
+    }
+  }
+  sendJSONResponse(res, 200, counters);
+  metrics_->incrementSuccessful();
+}
+
+/**
+ * We toggle hardware counters and reset phase totals
+ * Body: {"hardware": true|false, "reset": true|false}
+ */
+void HTTPTernaryFissionServer::handleProfileCountersUpdate(
+    const httplib::Request &req, httplib::Response &res) {
+  TF_TRACE_SCOPE("handleProfileCountersUpdate", "http");
+  TF_ALLOC_SCOPE("http.handleProfileCountersUpdate");
+  Json::Value request_json;
+  if (!parseJSONRequest(req, request_json)) {
+    sendErrorResponse(res, 400, "Invalid JSON request body");
+    metrics_->incrementErrors();
+    return;
+  }
+
+  if (request_json.isMember("hardware") &&
+      !Perf::setHardwareCountersEnabled(request_json["hardware"].asBool())) {
+    sendErrorResponse(res, 503,
+                      "Hardware counters unavailable: " +
+                          Perf::hardwareCountersError());
+    metrics_->incrementErrors();
+    return;
+  }
+  if (request_json.get("reset", false).asBool()) {
+    Perf::resetPhaseCounters();
+  }
+
+  handleProfileCounters(req, res);
+}
+
+/**
+ * We run the built-in sampling profiler and return folded stacks
+ * Query: seconds (default 30), hz (default 99), format=folded|json
+ * The request blocks for the profile duration; a concurrent request gets 409
+ */
+void HTTPTernaryFissionServer::handleCpuProfile(const httplib::Request &req,
+                                                httplib::Response &res) {
+  Profiler::CpuProfileOptions options;
+  try {
+    if (req.has_param("seconds")) {
+      options.seconds = std::stoi(req.get_param_value("seconds"));
+    }
+    if (req.has_param("hz")) {
+      options.hz = std::stoi(req.get_param_value("hz"));
+    }
+  } catch (const std::exception &) {
+    sendErrorResponse(res, 400, "seconds and hz must be integers");
+    metrics_->incrementErrors();
+    return;
+  }
+
+  Profiler::CpuProfileResult result;
+  std::string error;
+  switch (Profiler::runCpuProfile(options, result, error)) {
+  case Profiler::CpuProfileStatus::Ok:
+    break;
+  case Profiler::CpuProfileStatus::Busy:
+    sendErrorResponse(res, 409, error);
+    metrics_->incrementErrors();
+    return;
+  case Profiler::CpuProfileStatus::InvalidArgument:
+    sendErrorResponse(res, 400, error);
+    metrics_->incrementErrors();
+    return;
+  case Profiler::CpuProfileStatus::Failed:
+    sendErrorResponse(res, 500, error);
+    metrics_->incrementErrors();
+    return;
+  }
+
+  if (req.get_param_value("format") == "json") {
+    Json::Value profile;
+    profile["hz"] = result.hz;
+    profile["duration_seconds"] = result.duration_seconds;
+    profile["samples"] = static_cast<Json::UInt64>(result.samples);
+    profile["dropped"] = static_cast<Json::UInt64>(result.dropped);
+    profile["truncated"] = static_cast<Json::UInt64>(result.truncated);
+    profile["unique_stacks"] = static_cast<Json::UInt64>(result.unique_stacks);
+    profile["handler_seconds"] = result.handler_seconds;
+    profile["overhead_percent"] = result.overhead_percent;
+    profile["folded"] = result.folded;
+    sendJSONResponse(res, 200, profile);
+  } else {
+    res.set_content(result.folded, "text/plain");
+    res.status = 200;
+    res.set_header("X-Profile-Samples", std::to_string(result.samples));
+    res.set_header("X-Profile-Dropped", std::to_string(result.dropped));
+    res.set_header("X-Profile-Overhead-Percent",
+                   std::to_string(result.overhead_percent));
+  }
+  metrics_->incrementSuccessful();
+}
+
+/**
+ * We report contention, wait-time and hold-time percentiles for every
+ * named ProfiledMutex in the process
+ */
+void HTTPTernaryFissionServer::handleLockProfiles(
+    const httplib::Request & /*req*/, httplib::Response &res) {
+  Json::Value profile;
+  profile["ticks_per_second"] = CycleClock::ticksPerSecond();
+  profile["locks"] = lockProfilesToJson();
+  sendJSONResponse(res, 200, profile);
+  metrics_->incrementSuccessful();
+}
+
+/**
+ * We zero every lock profile so the next read covers a fresh window
+ */
+void HTTPTernaryFissionServer::handleLockProfilesReset(
+    const httplib::Request &req, httplib::Response &res) {
+  resetLockProfiles();
+  handleLockProfiles(req, res);
+}
+
+/**
+ * We report heap allocations per scope (handler, engine phase, field step)
+ * "enabled" is false unless the server was built with ALLOC_TRACKING=1
+ */
+void HTTPTernaryFissionServer::handleAllocationProfile(
+    const httplib::Request & /*req*/, httplib::Response &res) {
+  sendJSONResponse(res, 200, Alloc::allocationsToJson());
+  metrics_->incrementSuccessful();
+}
+
+/**
+ * We zero the per-scope allocation counters
+ */
+void HTTPTernaryFissionServer::handleAllocationProfileReset(
+    const httplib::Request &req, httplib::Response &res) {
+  Alloc::resetAllocations();
+  handleAllocationProfile(req, res);
+}
+
+/**
+ * We report flight recorder ring usage, dump history and watchdog baselines
+ */
+void HTTPTernaryFissionServer::handleFlightRecorderStatus(
+    const httplib::Request & /*req*/, httplib::Response &res) {
+  sendJSONResponse(res, 200, Flight::statusToJson());
+  metrics_->incrementSuccessful();
+}
+
+/**
+ * We write the last 60 s of flight recorder telemetry to the dump directory
+ * and return the file path
+ */
+void HTTPTernaryFissionServer::handleFlightRecorderDump(
+    const httplib::Request & /*req*/, httplib::Response &res) {
+  if (!Flight::isEnabled()) {
+    sendErrorResponse(res, 409, "Flight recorder is disabled");
+    metrics_->incrementErrors();
+    return;
+  }
+  std::string path = Flight::writeDump("api");
+  if (path.empty()) {
+    sendErrorResponse(res, 500,
+                      "Cannot write flight dump to " + Flight::dumpDirectory());
+    metrics_->incrementErrors();
+    return;
+  }
+  Json::Value response;
+  response["path"] = path;
+  response["reason"] = "api";
+  sendJSONResponse(res, 200, response);
+  metrics_->incrementSuccessful();
+}
+
 Json::Value HTTPTernaryFissionServer::computeFieldStatistics() const {
   Json::Value stats;
-  std::lock_guard<std::mutex> lock(fields_mutex_);
+  std::lock_guard<ProfiledMutex> lock(fields_mutex_);
 
   int total_fields = static_cast<int>(energy_fields_.size());
   int active_fields = 0;
@@ -1753,7 +2875,7 @@ Json::Value HTTPTernaryFissionServer::computeFieldStatistics() const {
 
 void HTTPTernaryFissionServer::addEnergyField(
     const EnergyFieldResponse &field) {
-  std::lock_guard<std::mutex> lock(fields_mutex_);
+  std::lock_guard<ProfiledMutex> lock(fields_mutex_);
   auto new_field = std::make_unique<EnergyFieldResponse>(field);
   energy_fields_[new_field->field_id] = std::move(new_field);
 }
@@ -1770,7 +2892,7 @@ bool HTTPTernaryFissionServer::validateConfiguration() const {
 std::vector<EnergyFieldResponse>
 HTTPTernaryFissionServer::getActiveEnergyFields() const {
   std::vector<EnergyFieldResponse> fields;
-  std::lock_guard<std::mutex> lock(fields_mutex_);
+  std::lock_guard<ProfiledMutex> lock(fields_mutex_);
 
   for (const auto &[field_id, field] : energy_fields_) {
     if (field->status == "active" || field->active) {
@@ -1782,7 +2904,7 @@ HTTPTernaryFissionServer::getActiveEnergyFields() const {
 }
 
 size_t HTTPTernaryFissionServer::getActiveWebSocketConnections() const {
-  std::lock_guard<std::mutex> lock(websocket_mutex_);
+  std::lock_guard<ProfiledMutex> lock(websocket_mutex_);
   return websocket_connections_.size();
 }
 
@@ -25,6 +25,7 @@
  * - 2025-08-10: Stubbed implementation to restore build after source truncation
  *               Provides minimal entry point and placeholder helpers
  * - 2025-08-11: Restored full CLI, daemon, and HTTP server integration
+ * - 2026-10-17: HTTP server mode now honours --bind-ip/--bind-port overrides
  */
 
 #include "config.ternary.fission.server.h"
@@ -394,6 +395,13 @@ void runDaemonMode(const std::string &config_file, const std::string &bind_ip,
 void runHTTPServerMode(const std::string &config_file,
                        const std::string &bind_ip, int bind_port) {
   std::cout << "Starting HTTP server mode..." << std::endl;
+  // We route CLI bind overrides through the TERNARY_* environment overrides
+  if (!bind_ip.empty()) {
+    ::setenv("TERNARY_BIND_IP", bind_ip.c_str(), 1);
+  }
+  if (bind_port > 0) {
+    ::setenv("TERNARY_BIND_PORT", std::to_string(bind_port).c_str(), 1);
+  }
   auto config_manager = std::make_unique<ConfigurationManager>(config_file);
   HTTPTernaryFissionServer server(std::move(config_manager));
   if (!server.initialize()) {
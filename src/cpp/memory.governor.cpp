@@ -0,0 +1,397 @@
+/*
+ * File: src/cpp/memory.governor.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Memory Governor Implementation
+ * Purpose: Implements reservation against the field memory cap, the reject/shrink/
+ *          evict policies, the watermark reclaimer thread and decision metrics
+ * Reason: We need field memory to stay under a configured budget under any burst
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ *
+ * Carry-over Context:
+ * - Reservations are a CAS loop on one atomic, so admission never blocks while
+ *   the budget has room; the reclaimer mutex is only taken to evict
+ * - Usable memory is read once: physical RAM, lowered to the cgroup v2 memory.max
+ *   when the process runs in a limited container
+ */
+
+#include "memory.governor.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <utility>
+
+namespace TernaryFission {
+namespace Governor {
+
+namespace {
+
+std::mutex g_settings_mutex;
+Settings g_settings;
+std::atomic<std::uint64_t> g_limit_bytes{0};
+
+std::atomic<std::uint64_t> g_committed{0};
+std::atomic<std::uint64_t> g_peak_committed{0};
+
+// Decision counters
+std::atomic<std::uint64_t> g_admitted{0};
+std::atomic<std::uint64_t> g_admitted_after_eviction{0};
+std::atomic<std::uint64_t> g_shrunk{0};
+std::atomic<std::uint64_t> g_shrunk_bytes{0};
+std::atomic<std::uint64_t> g_rejected{0};
+std::atomic<std::uint64_t> g_rejected_bytes{0};
+std::atomic<std::uint64_t> g_evicted_fields{0};
+std::atomic<std::uint64_t> g_evicted_bytes{0};
+std::atomic<std::uint64_t> g_background_reclaims{0};
+
+std::mutex g_reclaimer_mutex;
+const void* g_reclaimer_owner = nullptr;
+Reclaimer g_reclaimer;
+
+std::mutex g_thread_mutex;
+std::condition_variable g_thread_cv;
+std::thread g_thread;
+bool g_thread_running = false;
+
+std::uint64_t usableMemoryBytes() {
+    static const std::uint64_t usable = []() {
+        long pages = ::sysconf(_SC_PHYS_PAGES);
+        long page_size = ::sysconf(_SC_PAGESIZE);
+        std::uint64_t bytes = (pages > 0 && page_size > 0)
+            ? static_cast<std::uint64_t>(pages) * static_cast<std::uint64_t>(page_size) : 0;
+        std::ifstream cgroup("/sys/fs/cgroup/memory.max");
+        std::string value;
+        if (cgroup >> value && value != "max") {
+            try {
+                std::uint64_t cgroup_bytes = std::stoull(value);
+                if (cgroup_bytes > 0 && (bytes == 0 || cgroup_bytes < bytes)) {
+                    bytes = cgroup_bytes;
+                }
+            } catch (const std::exception&) {
+            }
+        }
+        return bytes;
+    }();
+    return usable;
+}
+
+std::uint64_t computeLimit(const Settings& settings) {
+    std::uint64_t limit = settings.max_bytes;
+    if (settings.memory_usage_limit_percent > 0.0 && usableMemoryBytes() > 0) {
+        double share = std::min(settings.memory_usage_limit_percent, 100.0) / 100.0;
+        std::uint64_t percent_limit = static_cast<std::uint64_t>(static_cast<double>(usableMemoryBytes()) * share);
+        limit = limit == 0 ? percent_limit : std::min(limit, percent_limit);
+    }
+    return limit;
+}
+
+bool isEvictPolicy(Policy policy) {
+    return policy == Policy::EvictLowestEnergy || policy == Policy::EvictOldest;
+}
+
+void notePeak(std::uint64_t committed) {
+    std::uint64_t peak = g_peak_committed.load(std::memory_order_relaxed);
+    while (committed > peak &&
+           !g_peak_committed.compare_exchange_weak(peak, committed, std::memory_order_relaxed)) {
+    }
+}
+
+/*
+ * Reserve between `minimum` and `requested` bytes within `limit`; returns bytes reserved or 0
+ */
+std::size_t tryReserve(std::size_t requested, std::size_t minimum, std::uint64_t limit) {
+    std::uint64_t committed = g_committed.load(std::memory_order_relaxed);
+    while (true) {
+        std::uint64_t headroom = committed < limit ? limit - committed : 0;
+        std::size_t grant = static_cast<std::size_t>(std::min<std::uint64_t>(requested, headroom));
+        if (grant < minimum || grant == 0) {
+            return 0;
+        }
+        if (g_committed.compare_exchange_weak(committed, committed + grant, std::memory_order_relaxed)) {
+            notePeak(committed + grant);
+            return grant;
+        }
+    }
+}
+
+std::size_t runReclaimer(std::size_t bytes_needed, Policy policy) {
+    std::lock_guard<std::mutex> lock(g_reclaimer_mutex);
+    if (!g_reclaimer || bytes_needed == 0) {
+        return 0;
+    }
+    std::size_t fields = 0;
+    std::size_t freed = g_reclaimer(bytes_needed, policy, fields);
+    g_evicted_fields.fetch_add(fields, std::memory_order_relaxed);
+    g_evicted_bytes.fetch_add(freed, std::memory_order_relaxed);
+    return freed;
+}
+
+void reclaimerLoop() {
+    std::unique_lock<std::mutex> lock(g_thread_mutex);
+    while (g_thread_running) {
+        int interval_ms = std::max(10, settings().reclaim_interval_ms);
+        g_thread_cv.wait_for(lock, std::chrono::milliseconds(interval_ms), []() { return !g_thread_running; });
+        if (!g_thread_running) {
+            break;
+        }
+        lock.unlock();
+        reclaimToWatermark();
+        lock.lock();
+    }
+}
+
+} // namespace
+
+const char* policyName(Policy policy) {
+    switch (policy) {
+        case Policy::Reject: return "reject";
+        case Policy::Shrink: return "shrink";
+        case Policy::EvictLowestEnergy: return "evict_lowest_energy";
+        case Policy::EvictOldest: return "evict_oldest";
+    }
+    return "unknown";
+}
+
+bool parsePolicy(const std::string& text, Policy& policy) {
+    static const Policy kPolicies[] = {
+        Policy::Reject, Policy::Shrink, Policy::EvictLowestEnergy, Policy::EvictOldest
+    };
+    for (Policy candidate : kPolicies) {
+        if (text == policyName(candidate)) {
+            policy = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* decisionName(Decision decision) {
+    switch (decision) {
+        case Decision::Admitted: return "admitted";
+        case Decision::AdmittedAfterEviction: return "admitted_after_eviction";
+        case Decision::Shrunk: return "shrunk";
+        case Decision::Rejected: return "rejected";
+    }
+    return "unknown";
+}
+
+Settings settings() {
+    std::lock_guard<std::mutex> lock(g_settings_mutex);
+    return g_settings;
+}
+
+void configure(const Settings& settings) {
+    std::lock_guard<std::mutex> lock(g_settings_mutex);
+    g_settings = settings;
+    g_limit_bytes.store(computeLimit(settings), std::memory_order_relaxed);
+}
+
+std::uint64_t limitBytes() {
+    return g_limit_bytes.load(std::memory_order_relaxed);
+}
+
+std::uint64_t committedBytes() {
+    return g_committed.load(std::memory_order_relaxed);
+}
+
+Grant admit(std::size_t requested) {
+    Grant grant;
+    const std::uint64_t limit = limitBytes();
+    if (limit == 0) {
+        notePeak(g_committed.fetch_add(requested, std::memory_order_relaxed) + requested);
+        g_admitted.fetch_add(1, std::memory_order_relaxed);
+        grant.bytes = requested;
+        grant.decision = Decision::Admitted;
+        return grant;
+    }
+    if (tryReserve(requested, requested, limit) == requested) {
+        g_admitted.fetch_add(1, std::memory_order_relaxed);
+        grant.bytes = requested;
+        grant.decision = Decision::Admitted;
+        return grant;
+    }
+
+    const Settings current = settings();
+    if (current.policy == Policy::Shrink) {
+        std::size_t minimum = std::min(requested, std::max<std::size_t>(current.min_field_bytes, 1));
+        grant.bytes = tryReserve(requested, minimum, limit);
+        if (grant.bytes > 0) {
+            g_shrunk.fetch_add(1, std::memory_order_relaxed);
+            g_shrunk_bytes.fetch_add(requested - grant.bytes, std::memory_order_relaxed);
+            grant.decision = Decision::Shrunk;
+            return grant;
+        }
+    } else if (isEvictPolicy(current.policy) && requested <= limit) {
+        std::uint64_t committed = committedBytes();
+        std::size_t needed = committed + requested > limit
+            ? static_cast<std::size_t>(committed + requested - limit) : 0;
+        runReclaimer(needed, current.policy);
+        if (tryReserve(requested, requested, limit) == requested) {
+            g_admitted_after_eviction.fetch_add(1, std::memory_order_relaxed);
+            grant.bytes = requested;
+            grant.decision = Decision::AdmittedAfterEviction;
+            return grant;
+        }
+    }
+
+    g_rejected.fetch_add(1, std::memory_order_relaxed);
+    g_rejected_bytes.fetch_add(requested, std::memory_order_relaxed);
+    grant.bytes = 0;
+    grant.decision = Decision::Rejected;
+    return grant;
+}
+
+void release(std::size_t bytes) {
+    std::uint64_t committed = g_committed.load(std::memory_order_relaxed);
+    while (!g_committed.compare_exchange_weak(committed, committed >= bytes ? committed - bytes : 0,
+                                              std::memory_order_relaxed)) {
+    }
+}
+
+void setReclaimer(const void* owner, Reclaimer reclaimer) {
+    std::lock_guard<std::mutex> lock(g_reclaimer_mutex);
+    g_reclaimer_owner = owner;
+    g_reclaimer = std::move(reclaimer);
+}
+
+void clearReclaimer(const void* owner) {
+    std::lock_guard<std::mutex> lock(g_reclaimer_mutex);
+    if (g_reclaimer_owner == owner) {
+        g_reclaimer_owner = nullptr;
+        g_reclaimer = nullptr;
+    }
+}
+
+void startReclaimer() {
+    std::lock_guard<std::mutex> lock(g_thread_mutex);
+    if (g_thread_running) {
+        return;
+    }
+    g_thread_running = true;
+    g_thread = std::thread(reclaimerLoop);
+}
+
+void stopReclaimer() {
+    {
+        std::lock_guard<std::mutex> lock(g_thread_mutex);
+        if (!g_thread_running) {
+            return;
+        }
+        g_thread_running = false;
+    }
+    g_thread_cv.notify_all();
+    if (g_thread.joinable()) {
+        g_thread.join();
+    }
+}
+
+std::size_t reclaimToWatermark() {
+    const Settings current = settings();
+    const std::uint64_t limit = limitBytes();
+    if (limit == 0 || !isEvictPolicy(current.policy)) {
+        return 0;
+    }
+    const std::uint64_t committed = committedBytes();
+    const double high = static_cast<double>(limit) * current.high_watermark;
+    const double low = static_cast<double>(limit) * current.low_watermark;
+    if (static_cast<double>(committed) <= high) {
+        return 0;
+    }
+    g_background_reclaims.fetch_add(1, std::memory_order_relaxed);
+    return runReclaimer(static_cast<std::size_t>(static_cast<double>(committed) - low), current.policy);
+}
+
+void resetStatistics() {
+    for (auto* counter : {&g_admitted, &g_admitted_after_eviction, &g_shrunk, &g_shrunk_bytes, &g_rejected,
+                          &g_rejected_bytes, &g_evicted_fields, &g_evicted_bytes, &g_background_reclaims}) {
+        counter->store(0, std::memory_order_relaxed);
+    }
+    g_peak_committed.store(committedBytes(), std::memory_order_relaxed);
+}
+
+Json::Value statsToJson() {
+    const Settings current = settings();
+    const std::uint64_t limit = limitBytes();
+    const std::uint64_t committed = committedBytes();
+    Json::Value stats;
+    stats["policy"] = policyName(current.policy);
+    stats["limit_bytes"] = static_cast<Json::UInt64>(limit);
+    stats["max_bytes"] = static_cast<Json::UInt64>(current.max_bytes);
+    stats["memory_usage_limit_percent"] = current.memory_usage_limit_percent;
+    stats["usable_memory_bytes"] = static_cast<Json::UInt64>(usableMemoryBytes());
+    stats["high_watermark"] = current.high_watermark;
+    stats["low_watermark"] = current.low_watermark;
+    stats["min_field_bytes"] = static_cast<Json::UInt64>(current.min_field_bytes);
+    stats["committed_bytes"] = static_cast<Json::UInt64>(committed);
+    stats["peak_committed_bytes"] = static_cast<Json::UInt64>(g_peak_committed.load(std::memory_order_relaxed));
+    stats["utilization"] = limit > 0 ? static_cast<double>(committed) / static_cast<double>(limit) : 0.0;
+
+    Json::Value decisions;
+    decisions["admitted"] = static_cast<Json::UInt64>(g_admitted.load(std::memory_order_relaxed));
+    decisions["admitted_after_eviction"] =
+        static_cast<Json::UInt64>(g_admitted_after_eviction.load(std::memory_order_relaxed));
+    decisions["shrunk"] = static_cast<Json::UInt64>(g_shrunk.load(std::memory_order_relaxed));
+    decisions["shrunk_bytes"] = static_cast<Json::UInt64>(g_shrunk_bytes.load(std::memory_order_relaxed));
+    decisions["rejected"] = static_cast<Json::UInt64>(g_rejected.load(std::memory_order_relaxed));
+    decisions["rejected_bytes"] = static_cast<Json::UInt64>(g_rejected_bytes.load(std::memory_order_relaxed));
+    decisions["evicted_fields"] = static_cast<Json::UInt64>(g_evicted_fields.load(std::memory_order_relaxed));
+    decisions["evicted_bytes"] = static_cast<Json::UInt64>(g_evicted_bytes.load(std::memory_order_relaxed));
+    decisions["background_reclaims"] =
+        static_cast<Json::UInt64>(g_background_reclaims.load(std::memory_order_relaxed));
+    stats["decisions"] = decisions;
+    {
+        std::lock_guard<std::mutex> lock(g_thread_mutex);
+        stats["reclaimer_running"] = g_thread_running;
+    }
+    return stats;
+}
+
+std::string toPrometheus() {
+    std::ostringstream out;
+    out << "# HELP ternary_fission_field_memory_limit_bytes Field memory cap (0 = unlimited)\n"
+        << "# TYPE ternary_fission_field_memory_limit_bytes gauge\n"
+        << "ternary_fission_field_memory_limit_bytes " << limitBytes() << "\n"
+        << "# HELP ternary_fission_field_memory_committed_bytes Bytes committed to field buffers\n"
+        << "# TYPE ternary_fission_field_memory_committed_bytes gauge\n"
+        << "ternary_fission_field_memory_committed_bytes " << committedBytes() << "\n"
+        << "# HELP ternary_fission_field_memory_peak_committed_bytes Peak bytes committed to field buffers\n"
+        << "# TYPE ternary_fission_field_memory_peak_committed_bytes gauge\n"
+        << "ternary_fission_field_memory_peak_committed_bytes "
+        << g_peak_committed.load(std::memory_order_relaxed) << "\n"
+        << "# HELP ternary_fission_field_memory_decisions_total Governor admission decisions\n"
+        << "# TYPE ternary_fission_field_memory_decisions_total counter\n";
+    const std::pair<const char*, const std::atomic<std::uint64_t>*> decisions[] = {
+        {"admitted", &g_admitted}, {"admitted_after_eviction", &g_admitted_after_eviction},
+        {"shrunk", &g_shrunk}, {"rejected", &g_rejected}
+    };
+    for (const auto& decision : decisions) {
+        out << "ternary_fission_field_memory_decisions_total{decision=\"" << decision.first << "\"} "
+            << decision.second->load(std::memory_order_relaxed) << "\n";
+    }
+    out << "# HELP ternary_fission_field_memory_evicted_fields_total Fields evicted by the governor\n"
+        << "# TYPE ternary_fission_field_memory_evicted_fields_total counter\n"
+        << "ternary_fission_field_memory_evicted_fields_total "
+        << g_evicted_fields.load(std::memory_order_relaxed) << "\n"
+        << "# HELP ternary_fission_field_memory_evicted_bytes_total Bytes released by governor evictions\n"
+        << "# TYPE ternary_fission_field_memory_evicted_bytes_total counter\n"
+        << "ternary_fission_field_memory_evicted_bytes_total "
+        << g_evicted_bytes.load(std::memory_order_relaxed) << "\n"
+        << "# HELP ternary_fission_field_memory_shrunk_bytes_total Bytes not materialized because fields were shrunk\n"
+        << "# TYPE ternary_fission_field_memory_shrunk_bytes_total counter\n"
+        << "ternary_fission_field_memory_shrunk_bytes_total "
+        << g_shrunk_bytes.load(std::memory_order_relaxed) << "\n";
+    return out.str();
+}
+
+} // namespace Governor
+} // namespace TernaryFission
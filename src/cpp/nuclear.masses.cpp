@@ -0,0 +1,87 @@
+/*
+ * File: src/cpp/nuclear.masses.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Nuclear Masses Implementation
+ * Purpose: Builds the (Z, A) binding energy and mass excess table from the semi-empirical
+ *          mass formula and the measured light nuclei
+ * Reason: Gives the engine real binding energies and Q-values at one load per nucleus
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ *
+ * Carry-over Context:
+ * - We build at first use rather than at compile time: C++17 has no constexpr sqrt or
+ *   cbrt, and the 45,451 entries take well under a millisecond
+ * - Coefficients are the usual fit (Krane): aV 15.75, aS 17.8, aC 0.711, aA 23.7 and a
+ *   pairing term of 11.18 / sqrt(A); U-235 comes out within 1% of its measured 1783.9 MeV
+ */
+
+#include "nuclear.masses.h"
+
+#include <cmath>
+
+namespace TernaryFission {
+
+namespace {
+
+constexpr double kVolume = 15.75;
+constexpr double kSurface = 17.8;
+constexpr double kCoulomb = 0.711;
+constexpr double kAsymmetry = 23.7;
+constexpr double kPairing = 11.18;
+
+struct MeasuredNucleus {
+    int atomic_number;
+    int mass_number;
+    double binding_energy;  // MeV
+};
+
+// We take the nuclei the formula cannot describe from measurement
+constexpr MeasuredNucleus kLightNuclei[] = {
+    {0, 1, 0.0},       // n
+    {1, 1, 0.0},       // 1H
+    {1, 2, 2.224566},  // 2H
+    {1, 3, 8.481798},  // 3H
+    {2, 3, 7.718043},  // 3He
+    {2, 4, 28.295673}, // 4He
+};
+
+} // namespace
+
+double NuclearMassTable::semiEmpiricalBindingEnergy(int atomic_number, int mass_number) {
+    const double a = mass_number;
+    const double z = atomic_number;
+    const double n = a - z;
+    double binding = kVolume * a - kSurface * std::cbrt(a * a) - kCoulomb * z * (z - 1.0) / std::cbrt(a) -
+                     kAsymmetry * (n - z) * (n - z) / a;
+    if (mass_number % 2 == 0) {
+        const double pairing = kPairing / std::sqrt(a);
+        binding += (atomic_number % 2 == 0) ? pairing : -pairing;
+    }
+    return binding;
+}
+
+NuclearMassTable::NuclearMassTable() : entries_(offset(kMaxMassNumber, kMaxMassNumber) + 1) {
+    for (int a = 1; a <= kMaxMassNumber; ++a) {
+        for (int z = 0; z <= a; ++z) {
+            entries_[offset(z, a)].binding_energy = semiEmpiricalBindingEnergy(z, a);
+        }
+    }
+    for (const MeasuredNucleus& nucleus : kLightNuclei) {
+        entries_[offset(nucleus.atomic_number, nucleus.mass_number)].binding_energy = nucleus.binding_energy;
+    }
+    for (int a = 1; a <= kMaxMassNumber; ++a) {
+        for (int z = 0; z <= a; ++z) {
+            NuclearMass& entry = entries_[offset(z, a)];
+            entry.mass_excess = z * kHydrogenMassExcess + (a - z) * kNeutronMassExcess - entry.binding_energy;
+        }
+    }
+}
+
+const NuclearMassTable& NuclearMassTable::instance() {
+    static const NuclearMassTable table;
+    return table;
+}
+
+} // namespace TernaryFission
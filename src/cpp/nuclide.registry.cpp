@@ -0,0 +1,197 @@
+/*
+ * File: src/cpp/nuclide.registry.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Nuclide Registry Implementation
+ * Purpose: Built-in parent data, symbol parsing and registry construction
+ * Reason: Lets the engine run any registered parent without recomputing its data per event
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ * - 2026-10-17: Mass-number lookup for mass-only callers
+ *
+ * Carry-over Context:
+ * - Ternary probabilities are long-range alpha to binary ratios divided by the alpha
+ *   share of ternary particles, rounded; they are reported with each nuclide, and the
+ *   engine itself always emits the alpha-accompanied split
+ * - Registries hold a handful of parents, so lookups are linear scans
+ */
+
+#include "nuclide.registry.h"
+#include "nuclear.masses.h"
+#include "physics.utilities.h"
+
+#include <cctype>
+#include <stdexcept>
+
+namespace TernaryFission {
+
+namespace {
+
+constexpr int kElementCount = 119;
+
+// We index element symbols by Z; Z = 0 is the free neutron
+const char* const kElementSymbols[kElementCount] = {
+    "n",  "H",  "He", "Li", "Be", "B",  "C",  "N",  "O",  "F",  "Ne", "Na", "Mg", "Al", "Si",
+    "P",  "S",  "Cl", "Ar", "K",  "Ca", "Sc", "Ti", "V",  "Cr", "Mn", "Fe", "Co", "Ni", "Cu",
+    "Zn", "Ga", "Ge", "As", "Se", "Br", "Kr", "Rb", "Sr", "Y",  "Zr", "Nb", "Mo", "Tc", "Ru",
+    "Rh", "Pd", "Ag", "Cd", "In", "Sn", "Sb", "Te", "I",  "Xe", "Cs", "Ba", "La", "Ce", "Pr",
+    "Nd", "Pm", "Sm", "Eu", "Gd", "Tb", "Dy", "Ho", "Er", "Tm", "Yb", "Lu", "Hf", "Ta", "W",
+    "Re", "Os", "Ir", "Pt", "Au", "Hg", "Tl", "Pb", "Bi", "Po", "At", "Rn", "Fr", "Ra", "Ac",
+    "Th", "Pa", "U",  "Np", "Pu", "Am", "Cm", "Bk", "Cf", "Es", "Fm", "Md", "No", "Lr", "Rf",
+    "Db", "Sg", "Bh", "Hs", "Mt", "Ds", "Rg", "Cn", "Nh", "Fl", "Mc", "Lv", "Ts", "Og",
+};
+
+struct BuiltInNuclide {
+    int atomic_number;
+    int mass_number;
+    double light_fragment_mean;
+    double heavy_fragment_mean;
+    double ternary_probability;
+    double alpha_fraction;
+};
+
+constexpr BuiltInNuclide kBuiltInNuclides[] = {
+    {92, 233, 94.0, 139.0, 2.2e-3, 0.90},
+    {92, 235, 95.0, 140.0, 1.9e-3, 0.90},
+    {94, 239, 100.0, 139.0, 2.4e-3, 0.88},
+    {94, 241, 102.0, 139.0, 2.7e-3, 0.88},
+    {98, 252, 106.0, 143.0, 3.7e-3, 0.86},
+};
+
+// We give a default parent without built-in data the U-235 ternary ratios
+constexpr double kDefaultTernaryProbability = 1.9e-3;
+constexpr double kDefaultAlphaFraction = 0.90;
+
+bool equalsIgnoreCase(const std::string& text, const char* symbol) {
+    std::size_t i = 0;
+    for (; symbol[i] != '\0'; ++i) {
+        if (i >= text.size() ||
+            std::tolower(static_cast<unsigned char>(text[i])) != std::tolower(static_cast<unsigned char>(symbol[i]))) {
+            return false;
+        }
+    }
+    return i == text.size();
+}
+
+Nuclide makeNuclide(int atomic_number, int mass_number, double ternary_probability, double alpha_fraction,
+                    const FragmentYieldModel& model) {
+    if (!NuclearMassTable::covers(atomic_number, mass_number)) {
+        throw std::invalid_argument("no mass table entry for " +
+                                    NuclideRegistry::symbolFor(atomic_number, mass_number));
+    }
+    Nuclide nuclide;
+    nuclide.yields = FragmentYields::build(atomic_number, mass_number, model);
+    const NuclearMassTable& masses = NuclearMassTable::instance();
+    const NuclearMass& parent = masses.at(atomic_number, mass_number);
+    nuclide.symbol = NuclideRegistry::symbolFor(atomic_number, mass_number);
+    nuclide.atomic_number = atomic_number;
+    nuclide.mass_number = mass_number;
+    nuclide.mass = mass_number + parent.mass_excess / AMU_TO_MEV;
+    nuclide.binding_energy = parent.binding_energy;
+    nuclide.q_value_offset = masses.at(2, 4).binding_energy - parent.binding_energy;
+    nuclide.ternary_probability = ternary_probability;
+    nuclide.alpha_fraction = alpha_fraction;
+    return nuclide;
+}
+
+} // namespace
+
+std::shared_ptr<const NuclideRegistry> NuclideRegistry::build(int default_atomic_number, int default_mass_number,
+                                                              const FragmentYieldModel& default_model) {
+    std::shared_ptr<NuclideRegistry> registry(new NuclideRegistry());
+    bool default_built_in = false;
+    for (const BuiltInNuclide& built_in : kBuiltInNuclides) {
+        const bool is_default =
+            built_in.atomic_number == default_atomic_number && built_in.mass_number == default_mass_number;
+        FragmentYieldModel model = default_model;
+        if (!is_default) {
+            model.light_fragment_mean = built_in.light_fragment_mean;
+            model.heavy_fragment_mean = built_in.heavy_fragment_mean;
+            model.yield_file.clear();
+        } else {
+            registry->default_index_ = registry->nuclides_.size();
+            default_built_in = true;
+        }
+        registry->nuclides_.push_back(makeNuclide(built_in.atomic_number, built_in.mass_number,
+                                                  built_in.ternary_probability, built_in.alpha_fraction, model));
+    }
+    if (!default_built_in) {
+        registry->default_index_ = registry->nuclides_.size();
+        registry->nuclides_.push_back(makeNuclide(default_atomic_number, default_mass_number,
+                                                  kDefaultTernaryProbability, kDefaultAlphaFraction, default_model));
+    }
+    return registry;
+}
+
+const Nuclide* NuclideRegistry::find(int atomic_number, int mass_number) const {
+    for (const Nuclide& nuclide : nuclides_) {
+        if (nuclide.atomic_number == atomic_number && nuclide.mass_number == mass_number) {
+            return &nuclide;
+        }
+    }
+    return nullptr;
+}
+
+const Nuclide* NuclideRegistry::findByMassNumber(int mass_number) const {
+    if (nuclides_[default_index_].mass_number == mass_number) {
+        return &nuclides_[default_index_];
+    }
+    for (const Nuclide& nuclide : nuclides_) {
+        if (nuclide.mass_number == mass_number) {
+            return &nuclide;
+        }
+    }
+    return nullptr;
+}
+
+const Nuclide* NuclideRegistry::find(const std::string& symbol) const {
+    int atomic_number = 0;
+    int mass_number = 0;
+    if (!parseSymbol(symbol, atomic_number, mass_number)) {
+        return nullptr;
+    }
+    return find(atomic_number, mass_number);
+}
+
+bool NuclideRegistry::parseSymbol(const std::string& symbol, int& atomic_number, int& mass_number) {
+    std::size_t letters = 0;
+    while (letters < symbol.size() && std::isalpha(static_cast<unsigned char>(symbol[letters]))) {
+        ++letters;
+    }
+    std::size_t digits = letters;
+    if (digits < symbol.size() && symbol[digits] == '-') {
+        ++digits;
+    }
+    const std::size_t first_digit = digits;
+    int a = 0;
+    while (digits < symbol.size() && std::isdigit(static_cast<unsigned char>(symbol[digits])) &&
+           digits - first_digit < 4) {
+        a = a * 10 + (symbol[digits] - '0');
+        ++digits;
+    }
+    if (letters == 0 || digits == first_digit || digits != symbol.size() || a <= 0) {
+        return false;
+    }
+    const std::string element = symbol.substr(0, letters);
+    for (int z = 1; z < kElementCount; ++z) {
+        if (equalsIgnoreCase(element, kElementSymbols[z])) {
+            if (a < z) {
+                return false;
+            }
+            atomic_number = z;
+            mass_number = a;
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string NuclideRegistry::symbolFor(int atomic_number, int mass_number) {
+    const std::string element = (atomic_number >= 0 && atomic_number < kElementCount)
+                                    ? kElementSymbols[atomic_number]
+                                    : "Z" + std::to_string(atomic_number);
+    return element + "-" + std::to_string(mass_number);
+}
+
+} // namespace TernaryFission
@@ -0,0 +1,430 @@
+/*
+ * File: src/cpp/perf.counters.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Per-Phase Cycle and Hardware Counter Accounting Implementation
+ * Purpose: Implements phase totals and per-thread perf_event_open counter groups
+ * Reason: We need measured cycles, instructions and cache misses per engine phase
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ * - 2026-10-17: Per-thread latency histogram shards merged on read
+ * - 2026-10-17: Phases at or above the flight recorder's minimum span are recorded there
+ * - 2026-10-17: Field cycle JSON includes CPU budget burn cycles
+ *
+ * Carry-over Context:
+ * - Each thread opens its own counter group (cycles leader plus instructions, cache
+ *   references and cache misses) on first use; one read() returns the whole group
+ * - After the first perf_event_open failure we stop trying and report the error
+ * - Latency shards are leased per thread and returned to a free list at thread exit,
+ *   so their number is bounded by peak thread concurrency, not threads ever created
+ */
+
+#include "perf.counters.h"
+#include "flight.recorder.h"
+#include "latency.histogram.h"
+#include "physics.utilities.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace TernaryFission {
+namespace Perf {
+
+std::atomic<bool> g_hardware_counters_enabled{false};
+
+namespace {
+
+struct alignas(64) PhaseTotals {
+    std::atomic<std::uint64_t> calls{0};
+    std::atomic<std::uint64_t> tsc_cycles{0};
+    std::atomic<std::uint64_t> hardware_calls{0};
+    std::atomic<std::uint64_t> hardware_cycles{0};
+    std::atomic<std::uint64_t> instructions{0};
+    std::atomic<std::uint64_t> cache_references{0};
+    std::atomic<std::uint64_t> cache_misses{0};
+};
+
+std::array<PhaseTotals, static_cast<std::size_t>(Phase::Count)> g_phase_totals;
+
+/*
+ * One thread's latency histograms, in TSC ticks
+ */
+struct alignas(64) LatencyShard {
+    std::array<LatencyHistogram, static_cast<std::size_t>(Phase::Count)> phases;
+};
+
+std::mutex g_shard_mutex;
+std::vector<std::unique_ptr<LatencyShard>> g_shards;
+std::vector<LatencyShard*> g_free_shards;
+
+/*
+ * Thread-local claim on a shard; the shard keeps its counts after release
+ */
+class ShardLease {
+public:
+    ShardLease() {
+        std::lock_guard<std::mutex> lock(g_shard_mutex);
+        if (!g_free_shards.empty()) {
+            shard_ = g_free_shards.back();
+            g_free_shards.pop_back();
+        } else {
+            g_shards.push_back(std::make_unique<LatencyShard>());
+            shard_ = g_shards.back().get();
+        }
+    }
+
+    ~ShardLease() {
+        std::lock_guard<std::mutex> lock(g_shard_mutex);
+        g_free_shards.push_back(shard_);
+    }
+
+    ShardLease(const ShardLease&) = delete;
+    ShardLease& operator=(const ShardLease&) = delete;
+
+    LatencyShard& shard() {
+        return *shard_;
+    }
+
+private:
+    LatencyShard* shard_ = nullptr;
+};
+
+LatencyShard& threadShard() {
+    thread_local ShardLease lease;
+    return lease.shard();
+}
+
+std::array<LatencyHistogram::Snapshot, static_cast<std::size_t>(Phase::Count)> mergedLatencies() {
+    std::array<LatencyHistogram::Snapshot, static_cast<std::size_t>(Phase::Count)> merged;
+    std::lock_guard<std::mutex> lock(g_shard_mutex);
+    for (const auto& shard : g_shards) {
+        for (std::size_t i = 0; i < merged.size(); ++i) {
+            merged[i].merge(shard->phases[i].snapshot());
+        }
+    }
+    return merged;
+}
+
+std::atomic<bool> g_hardware_failed{false};
+std::mutex g_error_mutex;
+std::string g_hardware_error;
+
+void recordHardwareError(const std::string& message) {
+    std::lock_guard<std::mutex> lock(g_error_mutex);
+    if (g_hardware_error.empty()) {
+        g_hardware_error = message;
+    }
+    g_hardware_failed.store(true, std::memory_order_relaxed);
+}
+
+#ifdef __linux__
+int openCounter(std::uint64_t config, int group_fd) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    return static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+
+/*
+ * Per-thread counter group, closed when the thread exits
+ */
+class ThreadCounterGroup {
+public:
+    ThreadCounterGroup() {
+        static const std::uint64_t configs[kCounters] = {
+            PERF_COUNT_HW_CPU_CYCLES,
+            PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_CACHE_REFERENCES,
+            PERF_COUNT_HW_CACHE_MISSES
+        };
+        for (int i = 0; i < kCounters; ++i) {
+            fds_[i] = openCounter(configs[i], i == 0 ? -1 : fds_[0]);
+            if (fds_[i] < 0) {
+                recordHardwareError(std::string("perf_event_open failed: ") + std::strerror(errno));
+                close();
+                return;
+            }
+        }
+    }
+
+    ~ThreadCounterGroup() {
+        close();
+    }
+
+    bool read(HardwareSample& sample) const {
+        if (fds_[0] < 0) {
+            return false;
+        }
+        std::uint64_t values[1 + kCounters];
+        if (::read(fds_[0], values, sizeof(values)) != static_cast<ssize_t>(sizeof(values)) ||
+            values[0] != kCounters) {
+            return false;
+        }
+        sample.cycles = values[1];
+        sample.instructions = values[2];
+        sample.cache_references = values[3];
+        sample.cache_misses = values[4];
+        return true;
+    }
+
+    bool valid() const {
+        return fds_[0] >= 0;
+    }
+
+private:
+    static constexpr int kCounters = 4;
+
+    void close() {
+        for (int i = kCounters - 1; i >= 0; --i) {
+            if (fds_[i] >= 0) {
+                ::close(fds_[i]);
+                fds_[i] = -1;
+            }
+        }
+    }
+
+    int fds_[kCounters] = {-1, -1, -1, -1};
+};
+
+ThreadCounterGroup* threadCounterGroup() {
+    if (g_hardware_failed.load(std::memory_order_relaxed)) {
+        return nullptr;
+    }
+    thread_local ThreadCounterGroup group;
+    return group.valid() ? &group : nullptr;
+}
+#endif
+
+double ratio(std::uint64_t numerator, std::uint64_t denominator) {
+    return denominator > 0 ? static_cast<double>(numerator) / static_cast<double>(denominator) : 0.0;
+}
+
+// We honor TERNARY_PERF_COUNTERS=1 at startup
+const bool g_env_applied = []() {
+    const char* env = std::getenv("TERNARY_PERF_COUNTERS");
+    if (env && std::strcmp(env, "1") == 0) {
+        g_hardware_counters_enabled.store(true, std::memory_order_relaxed);
+    }
+    return true;
+}();
+
+} // namespace
+
+const char* phaseName(Phase phase) {
+    switch (phase) {
+        case Phase::Generate: return "generate";
+        case Phase::Process: return "process";
+        case Phase::Allocate: return "allocate";
+        case Phase::Encrypt: return "encrypt";
+        case Phase::Dissipate: return "dissipate";
+        case Phase::Conservation: return "conservation";
+        case Phase::QueueWait: return "queue_wait";
+        case Phase::LockWait: return "lock_wait";
+        default: return "unknown";
+    }
+}
+
+bool setHardwareCountersEnabled(bool enabled) {
+    if (!enabled) {
+        g_hardware_counters_enabled.store(false, std::memory_order_relaxed);
+        return true;
+    }
+#ifdef __linux__
+    // We probe on the calling thread so the caller learns about failures immediately
+    if (!threadCounterGroup()) {
+        g_hardware_counters_enabled.store(false, std::memory_order_relaxed);
+        return false;
+    }
+    g_hardware_counters_enabled.store(true, std::memory_order_relaxed);
+    return true;
+#else
+    recordHardwareError("perf_event_open is only available on Linux");
+    return false;
+#endif
+}
+
+bool hardwareCountersEnabled() {
+    return g_hardware_counters_enabled.load(std::memory_order_relaxed);
+}
+
+std::string hardwareCountersError() {
+    std::lock_guard<std::mutex> lock(g_error_mutex);
+    return g_hardware_error;
+}
+
+bool readHardwareSample(HardwareSample& sample) {
+#ifdef __linux__
+    ThreadCounterGroup* group = threadCounterGroup();
+    return group && group->read(sample);
+#else
+    (void)sample;
+    return false;
+#endif
+}
+
+void recordPhase(Phase phase, std::uint64_t tsc_cycles, const HardwareSample* hardware) {
+    PhaseTotals& totals = g_phase_totals[static_cast<std::size_t>(phase)];
+    totals.calls.fetch_add(1, std::memory_order_relaxed);
+    totals.tsc_cycles.fetch_add(tsc_cycles, std::memory_order_relaxed);
+    threadShard().phases[static_cast<std::size_t>(phase)].record(tsc_cycles);
+    if (Flight::wantsSpan(tsc_cycles)) {
+        std::uint64_t now = CycleClock::now();
+        Flight::recordSpan(phaseName(phase), "engine", now - tsc_cycles, now);
+    }
+    if (hardware) {
+        totals.hardware_calls.fetch_add(1, std::memory_order_relaxed);
+        totals.hardware_cycles.fetch_add(hardware->cycles, std::memory_order_relaxed);
+        totals.instructions.fetch_add(hardware->instructions, std::memory_order_relaxed);
+        totals.cache_references.fetch_add(hardware->cache_references, std::memory_order_relaxed);
+        totals.cache_misses.fetch_add(hardware->cache_misses, std::memory_order_relaxed);
+    }
+}
+
+std::uint64_t phaseCalls(Phase phase) {
+    return g_phase_totals[static_cast<std::size_t>(phase)].calls.load(std::memory_order_relaxed);
+}
+
+std::uint64_t phaseTscCycles(Phase phase) {
+    return g_phase_totals[static_cast<std::size_t>(phase)].tsc_cycles.load(std::memory_order_relaxed);
+}
+
+void resetPhaseCounters() {
+    for (auto& totals : g_phase_totals) {
+        totals.calls.store(0, std::memory_order_relaxed);
+        totals.tsc_cycles.store(0, std::memory_order_relaxed);
+        totals.hardware_calls.store(0, std::memory_order_relaxed);
+        totals.hardware_cycles.store(0, std::memory_order_relaxed);
+        totals.instructions.store(0, std::memory_order_relaxed);
+        totals.cache_references.store(0, std::memory_order_relaxed);
+        totals.cache_misses.store(0, std::memory_order_relaxed);
+    }
+    std::lock_guard<std::mutex> lock(g_shard_mutex);
+    for (auto& shard : g_shards) {
+        for (auto& histogram : shard->phases) {
+            histogram.reset();
+        }
+    }
+}
+
+Json::Value phaseCountersToJson() {
+    (void)g_env_applied;
+    Json::Value root;
+
+    Json::Value tsc;
+    tsc["ticks_per_second"] = CycleClock::ticksPerSecond();
+    tsc["invariant"] = CycleClock::isInvariant();
+    root["tsc"] = tsc;
+
+    Json::Value hardware;
+    hardware["enabled"] = hardwareCountersEnabled();
+    std::string error = hardwareCountersError();
+    hardware["available"] = error.empty();
+    if (!error.empty()) {
+        hardware["error"] = error;
+    }
+    root["hardware_counters"] = hardware;
+
+    Json::Value phases;
+    for (std::size_t i = 0; i < g_phase_totals.size(); ++i) {
+        const PhaseTotals& totals = g_phase_totals[i];
+        std::uint64_t calls = totals.calls.load(std::memory_order_relaxed);
+        std::uint64_t tsc_cycles = totals.tsc_cycles.load(std::memory_order_relaxed);
+
+        Json::Value phase;
+        phase["calls"] = static_cast<Json::UInt64>(calls);
+        phase["tsc_cycles"] = static_cast<Json::UInt64>(tsc_cycles);
+        phase["avg_tsc_cycles"] = ratio(tsc_cycles, calls);
+        phase["avg_microseconds"] = calls > 0 ? CycleClock::ticksToMicroseconds(tsc_cycles) / calls : 0.0;
+
+        std::uint64_t hardware_calls = totals.hardware_calls.load(std::memory_order_relaxed);
+        if (hardware_calls > 0) {
+            std::uint64_t cycles = totals.hardware_cycles.load(std::memory_order_relaxed);
+            std::uint64_t instructions = totals.instructions.load(std::memory_order_relaxed);
+            std::uint64_t references = totals.cache_references.load(std::memory_order_relaxed);
+            std::uint64_t misses = totals.cache_misses.load(std::memory_order_relaxed);
+
+            Json::Value counters;
+            counters["calls"] = static_cast<Json::UInt64>(hardware_calls);
+            counters["cycles"] = static_cast<Json::UInt64>(cycles);
+            counters["instructions"] = static_cast<Json::UInt64>(instructions);
+            counters["cache_references"] = static_cast<Json::UInt64>(references);
+            counters["cache_misses"] = static_cast<Json::UInt64>(misses);
+            counters["ipc"] = ratio(instructions, cycles);
+            counters["cache_miss_rate"] = ratio(misses, references);
+            counters["avg_instructions"] = ratio(instructions, hardware_calls);
+            phase["hardware"] = counters;
+        }
+        phases[phaseName(static_cast<Phase>(i))] = phase;
+    }
+    root["phases"] = phases;
+
+    return root;
+}
+
+Json::Value phaseLatenciesToJson() {
+    auto merged = mergedLatencies();
+    const double ticks_per_us = CycleClock::ticksPerSecond() / 1e6;
+    Json::Value phases(Json::objectValue);
+    for (std::size_t i = 0; i < merged.size(); ++i) {
+        phases[phaseName(static_cast<Phase>(i))] = merged[i].toJson(ticks_per_us);
+    }
+    return phases;
+}
+
+std::string phaseLatenciesToPrometheus() {
+    static const double quantiles[] = {0.5, 0.9, 0.99, 0.999};
+    auto merged = mergedLatencies();
+    const double ticks_per_second = CycleClock::ticksPerSecond();
+
+    std::ostringstream out;
+    out << std::setprecision(9);
+    out << "# HELP ternary_fission_engine_phase_latency_seconds Engine phase latency\n";
+    out << "# TYPE ternary_fission_engine_phase_latency_seconds summary\n";
+    for (std::size_t i = 0; i < merged.size(); ++i) {
+        const LatencyHistogram::Snapshot& snapshot = merged[i];
+        const char* name = phaseName(static_cast<Phase>(i));
+        for (double q : quantiles) {
+            out << "ternary_fission_engine_phase_latency_seconds{phase=\"" << name << "\",quantile=\"" << q << "\"} "
+                << static_cast<double>(snapshot.percentile(q)) / ticks_per_second << "\n";
+        }
+        out << "ternary_fission_engine_phase_latency_seconds_sum{phase=\"" << name << "\"} "
+            << static_cast<double>(snapshot.sum) / ticks_per_second << "\n";
+        out << "ternary_fission_engine_phase_latency_seconds_count{phase=\"" << name << "\"} "
+            << snapshot.total << "\n";
+    }
+    return out.str();
+}
+
+Json::Value fieldCyclesToJson(const EnergyField& field) {
+    Json::Value cycles;
+    cycles["allocation"] = static_cast<Json::UInt64>(field.allocation_cycles);
+    cycles["encryption"] = static_cast<Json::UInt64>(field.encryption_cycles);
+    cycles["dissipation"] = static_cast<Json::UInt64>(field.dissipation_cycles);
+    cycles["burn"] = static_cast<Json::UInt64>(field.burn_cycles);
+    cycles["total"] = static_cast<Json::UInt64>(field.cpu_cycles);
+    cycles["total_microseconds"] = CycleClock::ticksToMicroseconds(field.cpu_cycles);
+    cycles["nominal"] = static_cast<Json::UInt64>(field.energy_mev * g_energy_field_config.cpu_cycles_per_mev);
+    return cycles;
+}
+
+} // namespace Perf
+} // namespace TernaryFission
@@ -22,6 +22,27 @@
  *               Added JSON serialization for all physics data structures
  *               Added performance monitoring for HTTP API operations
  *               Maintained all existing physics calculation functionality
+ * - 2026-10-17: Added releaseEnergyField so field memory is freed on removal
+ * - 2026-10-17: Trace spans around field create/allocate/encrypt/dissipate
+ * - 2026-10-17: Fields record measured allocation/encryption/dissipation TSC cycles;
+ *               cpu_cycles and entropy now derive from the measured cost
+ * - 2026-10-17: JSON serialization and daemon logging mutexes are ProfiledMutex
+ * - 2026-10-17: Allocation scopes on field create/encrypt/dissipate
+ * - 2026-10-17: Field buffers come from FieldMemory (huge-page/prefaulted mappings);
+ *               fields record allocation and fill page faults and report them as "memory"
+ * - 2026-10-17: Field memory is admitted by the memory governor, which may shrink the
+ *               field or reject it with Governor::MemoryBudgetExceeded
+ * - 2026-10-17: Virtual fields: the pattern is AES-256-CTR so any byte range can be
+ *               regenerated from (field_id, entropy_epoch); virtual fields keep no buffer
+ *               and are read through readEnergyFieldBytes
+ * - 2026-10-17: createEnergyField is describeEnergyField plus materializeEnergyField;
+ *               materializing fields validate without memory and report their state
+ * - 2026-10-17: dissipateEnergyFieldState/dissipateEnergyFieldSlice split dissipation
+ *               so the engine can apply the entropy pass in scheduler slices
+ * - 2026-10-17: uniformRandom/normalRandom/poissonRandom draw from the per-thread
+ *               Sampling generators instead of building a std distribution per call
+ * - 2026-10-17: Momentum directions are isotropic (Sampling::direction) instead of
+ *               uniform angles, which clustered at the poles; no trig per fragment
  *
  * Carry-over Context:
  * - Physics utilities now support complete HTTP API integration for daemon mode
@@ -34,6 +55,13 @@
 
 #include "physics.utilities.h"
 #include "physics.constants.definitions.h"
+#include "trace.ring.h"
+#include "perf.counters.h"
+#include "profiled.mutex.h"
+#include "allocation.tracker.h"
+#include "field.memory.h"
+#include "memory.governor.h"
+#include "random.samplers.h"
 #include <json/json.h>
 
 #include <iostream>
@@ -65,7 +93,6 @@
 namespace TernaryFission {
 
     // Forward declarations for internal utility functions
-    void encryptMemoryPattern(void* memory_ptr, size_t memory_size, uint64_t field_id);
     void applyEntropyToMemory(void* memory_ptr, size_t memory_size, double entropy_factor);
 
     // Global thread-local storage for random number generators
@@ -75,12 +102,12 @@ namespace TernaryFission {
 EnergyFieldConfig g_energy_field_config;
 
 // HTTP API and JSON serialization support
-static std::mutex json_serialization_mutex_;
+static ProfiledMutex json_serialization_mutex_("physics.json_serialization_mutex");
 static std::atomic<uint64_t> json_operations_counter_{0};
 static std::atomic<double> json_serialization_time_total_{0.0};
 
 // Thread-safe logging support for daemon operations
-static std::mutex daemon_logging_mutex_;
+static ProfiledMutex daemon_logging_mutex_("physics.daemon_logging_mutex");
 static std::ofstream daemon_log_file_;
 static std::atomic<bool> daemon_logging_enabled_{false};
 static std::string daemon_log_file_path_;
@@ -98,13 +125,16 @@ std::uint64_t generateFieldId() {
  */
 std::string energyFieldToJSON(const EnergyField& field) {
     auto start_time = std::chrono::high_resolution_clock::now();
-    std::lock_guard<std::mutex> lock(json_serialization_mutex_);
+    std::lock_guard<ProfiledMutex> lock(json_serialization_mutex_);
 
     Json::Value json_field;
     json_field["field_id"] = static_cast<Json::UInt64>(field.field_id);
     json_field["energy_mev"] = field.energy_mev;
     json_field["memory_bytes"] = static_cast<Json::UInt64>(field.memory_bytes);
     json_field["cpu_cycles"] = static_cast<Json::UInt64>(field.cpu_cycles);
+    json_field["measured_cycles"] = Perf::fieldCyclesToJson(field);
+    json_field["memory"] = FieldMemory::fieldMemoryToJson(field);
+    json_field["state"] = fieldStateName(field.state);
     json_field["entropy_factor"] = field.entropy_factor;
     json_field["dissipation_rate"] = field.dissipation_rate;
     json_field["stability_factor"] = field.stability_factor;
@@ -151,7 +181,7 @@ std::string energyFieldToJSON(const EnergyField& field) {
  */
 std::string fissionEventToJSON(const TernaryFissionEvent& event) {
     auto start_time = std::chrono::high_resolution_clock::now();
-    std::lock_guard<std::mutex> lock(json_serialization_mutex_);
+    std::lock_guard<ProfiledMutex> lock(json_serialization_mutex_);
 
     Json::Value json_event;
 
@@ -235,7 +265,7 @@ std::string fissionEventToJSON(const TernaryFissionEvent& event) {
  */
 std::string formatHTTPResponse(const std::string& status, const std::string& message,
                               const Json::Value& data, int http_status_code) {
-    std::lock_guard<std::mutex> lock(json_serialization_mutex_);
+    std::lock_guard<ProfiledMutex> lock(json_serialization_mutex_);
 
     Json::Value response;
     response["status"] = status;
@@ -290,7 +320,7 @@ Json::Value getJSONSerializationMetrics() {
  * We setup thread-safe logging for daemon operations
  */
 bool initializeDaemonLogging(const std::string& log_file_path, bool enable_logging) {
-    std::lock_guard<std::mutex> lock(daemon_logging_mutex_);
+    std::lock_guard<ProfiledMutex> lock(daemon_logging_mutex_);
 
     daemon_log_file_path_ = log_file_path;
     daemon_logging_enabled_.store(enable_logging, std::memory_order_relaxed);
@@ -324,7 +354,7 @@ void writeDaemonLogEntry(const std::string& level, const std::string& message,
         return;
     }
 
-    std::lock_guard<std::mutex> lock(daemon_logging_mutex_);
+    std::lock_guard<ProfiledMutex> lock(daemon_logging_mutex_);
 
     if (daemon_log_file_.is_open()) {
         auto now = std::chrono::system_clock::now();
@@ -343,7 +373,7 @@ void writeDaemonLogEntry(const std::string& level, const std::string& message,
  * We cleanup daemon logging resources
  */
 void cleanupDaemonLogging() {
-    std::lock_guard<std::mutex> lock(daemon_logging_mutex_);
+    std::lock_guard<ProfiledMutex> lock(daemon_logging_mutex_);
 
     if (daemon_log_file_.is_open()) {
         auto now = std::chrono::system_clock::now();
@@ -394,6 +424,17 @@ bool verifyConservationLaws(const TernaryFissionEvent& event, double energy_tole
  * We ensure proper energy and momentum distribution
  */
 void applyConservationLaws(TernaryFissionEvent& event) {
+    Vector3 heavy_direction;
+    Sampling::direction(Sampling::threadSampler().scalar, heavy_direction.x, heavy_direction.y,
+                        heavy_direction.z);
+    applyConservationLaws(event, heavy_direction);
+}
+
+/*
+ * Apply conservation laws along a given heavy fragment direction
+ * We let batch callers supply directions drawn in bulk
+ */
+void applyConservationLaws(TernaryFissionEvent& event, const Vector3& heavy_direction) {
     // Apply momentum conservation by adjusting fragment momenta
     // This is a simplified implementation - real physics would be more complex
 
@@ -407,13 +448,10 @@ void applyConservationLaws(TernaryFissionEvent& event) {
     double p_light = calculateMomentum(event.light_fragment.mass, event.light_fragment.kinetic_energy);
     double p_alpha = calculateMomentum(event.alpha_particle.mass, event.alpha_particle.kinetic_energy);
 
-    // Random momentum directions (simplified)
-    double theta_heavy = uniformRandom(0, 2*M_PI);
-    double phi_heavy = uniformRandom(0, M_PI);
-
-    event.heavy_fragment.momentum.x = p_heavy * sin(phi_heavy) * cos(theta_heavy);
-    event.heavy_fragment.momentum.y = p_heavy * sin(phi_heavy) * sin(theta_heavy);
-    event.heavy_fragment.momentum.z = p_heavy * cos(phi_heavy);
+    // Heavy fragment along the unit direction
+    event.heavy_fragment.momentum.x = p_heavy * heavy_direction.x;
+    event.heavy_fragment.momentum.y = p_heavy * heavy_direction.y;
+    event.heavy_fragment.momentum.z = p_heavy * heavy_direction.z;
 
     // Balance with other fragments for momentum conservation
     double remaining_px = -event.heavy_fragment.momentum.x;
@@ -448,14 +486,12 @@ void generateRandomMomentum(FissionFragment& fragment) {
     double momentum_magnitude = std::sqrt(2.0 * fragment.mass * AMU_TO_KG *
                                         fragment.kinetic_energy * MEV_TO_JOULES);
 
-    // Random spherical coordinates
-    double theta = uniformRandom(0, 2*M_PI);  // Azimuthal angle
-    double phi = uniformRandom(0, M_PI);      // Polar angle
-
-    // Convert to Cartesian coordinates
-    fragment.momentum.x = momentum_magnitude * sin(phi) * cos(theta);
-    fragment.momentum.y = momentum_magnitude * sin(phi) * sin(theta);
-    fragment.momentum.z = momentum_magnitude * cos(phi);
+    // Isotropic direction without trig; uniform angles would cluster at the poles
+    double x, y, z;
+    Sampling::direction(Sampling::threadSampler().scalar, x, y, z);
+    fragment.momentum.x = momentum_magnitude * x;
+    fragment.momentum.y = momentum_magnitude * y;
+    fragment.momentum.z = momentum_magnitude * z;
 }
 
 /*
@@ -463,6 +499,18 @@ void generateRandomMomentum(FissionFragment& fragment) {
  * We map kinetic energy to memory and CPU usage
  */
 EnergyField createEnergyField(double energy_mev) {
+    TF_TRACE_SCOPE("createEnergyField", "field");
+    TF_ALLOC_SCOPE("field.create");
+    EnergyField field = describeEnergyField(energy_mev);
+    materializeEnergyField(field);
+    return field;
+}
+
+/*
+ * Describe an energy field without allocating its memory
+ * We keep this cheap so the event path can register fields immediately
+ */
+EnergyField describeEnergyField(double energy_mev) {
     EnergyField field{};
 
     // Generate unique field ID
@@ -472,45 +520,92 @@ EnergyField createEnergyField(double energy_mev) {
     field.energy_mev = energy_mev;
     field.creation_time = std::chrono::high_resolution_clock::now();
 
-    // Map energy to memory and CPU
+    // Map energy to memory; CPU cost is measured at materialization rather than assumed
     field.memory_bytes = static_cast<size_t>(energy_mev * g_energy_field_config.memory_per_mev);
-    field.cpu_cycles = static_cast<uint64_t>(energy_mev * g_energy_field_config.cpu_cycles_per_mev);
-
-    // Calculate entropy
-    field.entropy_factor = calculateEntropy(field.memory_bytes, field.cpu_cycles);
 
     // Set field properties
     field.dissipation_rate = g_energy_field_config.dissipation_rate_default;
-    field.stability_factor = 1.0 - field.entropy_factor;
     field.interaction_strength = energy_mev / 1000.0;  // Normalized
+    return field;
+}
+
+/*
+ * Allocate and fill the memory of a described field
+ * We measure the allocation and fill and derive entropy from that cost
+ */
+void materializeEnergyField(EnergyField& field) {
+    TF_TRACE_SCOPE("materializeEnergyField", "field");
 
     // Allocate memory for energy field
-    if (g_energy_field_config.use_memory_pool && field.memory_bytes > 0) {
+    if (g_energy_field_config.use_memory_pool && field.memory_bytes > 0 && g_energy_field_config.virtual_fields) {
+        // We keep no buffer; readers regenerate bytes from (field_id, entropy_epoch), so
+        // nothing is resident and the governor has nothing to admit
+        field.memory_requested_bytes = field.memory_bytes;
+        field.memory_backing = static_cast<std::uint8_t>(FieldMemory::Backing::Virtual);
+        FieldMemory::registerVirtual(field.memory_bytes);
+    } else if (g_energy_field_config.use_memory_pool && field.memory_bytes > 0) {
+        // We reserve the bytes with the governor first; it may shrink or refuse the field
+        field.memory_requested_bytes = field.memory_bytes;
+        Governor::Grant grant = Governor::admit(field.memory_bytes);
+        if (grant.decision == Governor::Decision::Rejected) {
+            throw Governor::MemoryBudgetExceeded("energy field of " + std::to_string(field.memory_bytes) +
+                                                 " bytes exceeds the field memory budget");
+        }
+        field.memory_bytes = grant.bytes;
         try {
-            field.memory_ptr = std::malloc(field.memory_bytes);
+            {
+                TF_TRACE_SCOPE("malloc", "field");
+                Perf::PhaseScope phase(Perf::Phase::Allocate);
+                FieldMemory::Block block = FieldMemory::allocate(field.memory_bytes);
+                field.allocation_cycles = phase.stop();
+                field.memory_ptr = block.memory;
+                field.memory_mapped_bytes = block.mapped_bytes;
+                field.memory_backing = static_cast<std::uint8_t>(block.backing);
+                field.allocation_faults = block.faults;
+            }
             if (field.memory_ptr) {
-                // Initialize memory with encrypted pattern
+                // Initialize memory with encrypted pattern; first touch faults pages in here
+                std::uint64_t faults_before = FieldMemory::threadPageFaults();
+                Perf::PhaseScope phase(Perf::Phase::Encrypt);
                 encryptMemoryPattern(field.memory_ptr, field.memory_bytes, field.field_id);
+                field.encryption_cycles = phase.stop();
+                field.fill_faults = FieldMemory::threadPageFaults() - faults_before;
             }
         } catch (const std::exception& e) {
             std::cerr << "Memory allocation failed for energy field: " << e.what() << std::endl;
+            FieldMemory::release(field.memory_ptr, field.memory_mapped_bytes,
+                                 static_cast<FieldMemory::Backing>(field.memory_backing));
             field.memory_ptr = nullptr;
+            field.memory_mapped_bytes = 0;
+            field.memory_backing = static_cast<std::uint8_t>(FieldMemory::Backing::None);
+        }
+        if (!field.memory_ptr) {
+            // We hand the reservation back when nothing was allocated
+            Governor::release(grant.bytes);
             field.memory_bytes = 0;
         }
     }
+    field.cpu_cycles = field.allocation_cycles + field.encryption_cycles;
 
-    return field;
+    // Calculate entropy from the measured cost
+    field.entropy_factor = calculateEntropy(field.memory_bytes, field.cpu_cycles);
+    field.stability_factor = 1.0 - field.entropy_factor;
+    field.state = FieldState::Active;
 }
 
-/*
- * Dissipate energy from a field over time
- * We simulate energy dissipation through entropy increase
- */
-void dissipateEnergyField(EnergyField& field) {
-    if (field.energy_mev <= 0) {
-        return;
+const char* fieldStateName(FieldState state) {
+    switch (state) {
+        case FieldState::Active: return "active";
+        case FieldState::Materializing: return "materializing";
     }
+    return "unknown";
+}
 
+/*
+ * Advance the scalar state of a dissipating field
+ * We apply the energy, entropy and stability updates shared by both dissipation paths
+ */
+static void dissipateFieldScalars(EnergyField& field) {
     // Apply dissipation based on entropy and time
     auto now = std::chrono::high_resolution_clock::now();
     auto time_diff = std::chrono::duration_cast<std::chrono::milliseconds>(now - field.creation_time);
@@ -527,11 +622,89 @@ void dissipateEnergyField(EnergyField& field) {
 
     // Update stability (decreases as entropy increases)
     field.stability_factor = 1.0 - field.entropy_factor;
+}
+
+/*
+ * Dissipate energy from a field over time
+ * We simulate energy dissipation through entropy increase
+ */
+void dissipateEnergyField(EnergyField& field) {
+    TF_TRACE_SCOPE("dissipateEnergyField", "field");
+    TF_ALLOC_SCOPE("field.dissipate");
+    if (field.energy_mev <= 0) {
+        return;
+    }
+    Perf::PhaseScope phase(Perf::Phase::Dissipate);
+
+    dissipateFieldScalars(field);
 
-    // Apply entropy to memory pattern if allocated
+    // Apply entropy to memory pattern if allocated; virtual fields only advance the epoch
     if (field.memory_ptr && field.memory_bytes > 0) {
         applyEntropyToMemory(field.memory_ptr, field.memory_bytes, field.entropy_factor);
     }
+    ++field.entropy_epoch;
+
+    std::uint64_t cycles = phase.stop();
+    field.dissipation_cycles += cycles;
+    field.cpu_cycles += cycles;
+}
+
+/*
+ * Dissipate the scalar state of a field without touching its memory
+ * We leave the entropy pass over the buffer to dissipateEnergyFieldSlice
+ */
+bool dissipateEnergyFieldState(EnergyField& field) {
+    if (field.energy_mev <= 0) {
+        return false;
+    }
+    Perf::PhaseScope phase(Perf::Phase::Dissipate);
+
+    dissipateFieldScalars(field);
+    ++field.entropy_epoch;
+
+    std::uint64_t cycles = phase.stop();
+    field.dissipation_cycles += cycles;
+    field.cpu_cycles += cycles;
+    return true;
+}
+
+/*
+ * Apply the entropy pass to one slice of a field's buffer
+ * We clamp the slice to the buffer and charge its cost to the field
+ */
+void dissipateEnergyFieldSlice(EnergyField& field, size_t offset, size_t length) {
+    if (!field.memory_ptr || offset >= field.memory_bytes) {
+        return;
+    }
+    TF_TRACE_SCOPE("dissipateEnergyFieldSlice", "field");
+    Perf::PhaseScope phase(Perf::Phase::Dissipate);
+
+    length = std::min(length, field.memory_bytes - offset);
+    applyEntropyToMemory(static_cast<unsigned char*>(field.memory_ptr) + offset, length, field.entropy_factor);
+
+    std::uint64_t cycles = phase.stop();
+    field.dissipation_cycles += cycles;
+    field.cpu_cycles += cycles;
+}
+
+/*
+ * Release the backing memory of an energy field
+ * We pair this with createEnergyField wherever a field leaves engine state
+ */
+void releaseEnergyField(EnergyField& field) {
+    if (static_cast<FieldMemory::Backing>(field.memory_backing) == FieldMemory::Backing::Virtual) {
+        FieldMemory::unregisterVirtual(field.memory_bytes);
+    } else {
+        if (field.memory_ptr) {
+            Governor::release(field.memory_bytes);
+        }
+        FieldMemory::release(field.memory_ptr, field.memory_mapped_bytes,
+                             static_cast<FieldMemory::Backing>(field.memory_backing));
+    }
+    field.memory_ptr = nullptr;
+    field.memory_bytes = 0;
+    field.memory_mapped_bytes = 0;
+    field.memory_backing = static_cast<std::uint8_t>(FieldMemory::Backing::None);
 }
 
 /*
@@ -539,11 +712,32 @@ void dissipateEnergyField(EnergyField& field) {
  * We use AES encryption to create realistic CPU load
  */
 void encryptMemoryPattern(void* memory_ptr, size_t memory_size, uint64_t field_id) {
-    if (!memory_ptr || memory_size == 0) {
+    TF_TRACE_SCOPE("encryptMemoryPattern", "field");
+    TF_ALLOC_SCOPE("field.encrypt");
+    generateFieldBytes(field_id, 0, 0.0, 0, memory_ptr, memory_size);
+}
+
+/*
+ * SplitMix64 finalizer
+ * We hash field IDs and byte positions with it so entropy flips need no stored state
+ */
+static inline std::uint64_t mixFieldBits(std::uint64_t value) {
+    value += 0x9E3779B97F4A7C15ULL;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+/*
+ * Generate a byte range of a field's pattern
+ * We run AES-256-CTR with the counter started at offset / 16, so a slice costs only its own length
+ */
+void generateFieldBytes(uint64_t field_id, uint32_t entropy_epoch, double entropy_factor,
+                        size_t offset, void* out, size_t length) {
+    if (!out || length == 0) {
         return;
     }
 
-    // Initialize encryption context
     EVP_CIPHER_CTX* ctx = EVP_CIPHER_CTX_new();
     if (!ctx) {
         return;
@@ -554,40 +748,78 @@ void encryptMemoryPattern(void* memory_ptr, size_t memory_size, uint64_t field_i
     std::memset(key, 0, sizeof(key));
     std::memcpy(key, &field_id, sizeof(field_id));
 
-    // Generate IV
+    // Nonce from the field ID in the high half, big-endian block counter in the low half
     unsigned char iv[16];
-    RAND_bytes(iv, sizeof(iv));
+    std::uint64_t nonce = mixFieldBits(field_id);
+    std::memcpy(iv, &nonce, sizeof(nonce));
+    std::uint64_t block = offset / 16;
+    for (int i = 0; i < 8; ++i) {
+        iv[15 - i] = static_cast<unsigned char>(block >> (8 * i));
+    }
 
-    // Initialize encryption
-    if (EVP_EncryptInit_ex(ctx, EVP_aes_256_cbc(), nullptr, key, iv) != 1) {
+    if (EVP_EncryptInit_ex(ctx, EVP_aes_256_ctr(), nullptr, key, iv) != 1) {
         EVP_CIPHER_CTX_free(ctx);
         return;
     }
 
-    // Encrypt memory in chunks
-    const size_t chunk_size = 1024;
-    unsigned char* mem_bytes = static_cast<unsigned char*>(memory_ptr);
-
-    for (size_t offset = 0; offset < memory_size; offset += chunk_size) {
-        size_t current_chunk = std::min(chunk_size, memory_size - offset);
-
-        // Create temporary buffers
-        std::vector<unsigned char> plaintext(current_chunk);
-        std::vector<unsigned char> ciphertext(current_chunk + 16); // Extra space for padding
+    // Discard the keystream in front of offset within its block
+    int len = 0;
+    unsigned char discard[16] = {0};
+    if (offset % 16 != 0) {
+        EVP_EncryptUpdate(ctx, discard, &len, discard, static_cast<int>(offset % 16));
+    }
 
-        // Fill plaintext with pattern
+    // Fill and encrypt in place one cache-sized chunk at a time
+    const size_t chunk_size = 64 * 1024;
+    unsigned char* mem_bytes = static_cast<unsigned char*>(out);
+    for (size_t done = 0; done < length; done += chunk_size) {
+        size_t current_chunk = std::min(chunk_size, length - done);
+        unsigned char* chunk = mem_bytes + done;
         for (size_t i = 0; i < current_chunk; ++i) {
-            plaintext[i] = static_cast<unsigned char>((offset + i + field_id) % 256);
+            chunk[i] = static_cast<unsigned char>((offset + done + i + field_id) % 256);
         }
+        EVP_EncryptUpdate(ctx, chunk, &len, chunk, static_cast<int>(current_chunk));
+    }
+    EVP_CIPHER_CTX_free(ctx);
+
+    if (entropy_epoch == 0 || entropy_factor <= 0) {
+        return;
+    }
 
-        int len;
-        if (EVP_EncryptUpdate(ctx, ciphertext.data(), &len, plaintext.data(), static_cast<int>(current_chunk)) == 1) {
-            // Copy encrypted data back to memory
-            std::memcpy(mem_bytes + offset, ciphertext.data(), std::min(current_chunk, static_cast<size_t>(len)));
+    // Each dissipation pass changes about entropy_factor% of the bytes; we collapse
+    // entropy_epoch passes into one that changes 1 - (1 - p)^epoch of them. A byte's
+    // hash is fixed, so the changed set only grows with the epoch and slices agree
+    double per_pass = std::min(1.0, entropy_factor * 0.01);
+    double changed = 1.0 - std::pow(1.0 - per_pass, static_cast<double>(entropy_epoch));
+    std::uint64_t threshold = changed >= 1.0 ? UINT64_MAX
+                                             : static_cast<std::uint64_t>(changed * 18446744073709551616.0);
+    std::uint64_t seed = mixFieldBits(field_id ^ 0xD1B54A32D192ED03ULL);
+    for (size_t i = 0; i < length; ++i) {
+        std::uint64_t hash = mixFieldBits(seed + offset + i);
+        if (hash < threshold) {
+            mem_bytes[i] ^= static_cast<unsigned char>(mixFieldBits(hash));
         }
     }
+}
 
-    EVP_CIPHER_CTX_free(ctx);
+/*
+ * Read a slice of an energy field
+ * We copy materialized buffers and regenerate virtual fields
+ */
+size_t readEnergyFieldBytes(const EnergyField& field, size_t offset, void* out, size_t length) {
+    if (!out || offset >= field.memory_bytes) {
+        return 0;
+    }
+    length = std::min(length, field.memory_bytes - offset);
+    if (field.memory_ptr) {
+        std::memcpy(out, static_cast<const unsigned char*>(field.memory_ptr) + offset, length);
+        return length;
+    }
+    if (static_cast<FieldMemory::Backing>(field.memory_backing) == FieldMemory::Backing::Virtual) {
+        generateFieldBytes(field.field_id, field.entropy_epoch, field.entropy_factor, offset, out, length);
+        return length;
+    }
+    return 0;
 }
 
 /*
@@ -725,7 +957,8 @@ bool validateEnergyField(const EnergyField& field) {
     }
 
     // Memory consistency check
-    if (field.memory_bytes > 0 && field.memory_ptr == nullptr) {
+    if (field.memory_bytes > 0 && field.memory_ptr == nullptr && field.state == FieldState::Active &&
+        static_cast<FieldMemory::Backing>(field.memory_backing) != FieldMemory::Backing::Virtual) {
         return false;
     }
 
@@ -765,8 +998,7 @@ std::mt19937_64& getThreadLocalRNG() {
  * We provide convenient random number generation
  */
 double uniformRandom(double min, double max) {
-    std::uniform_real_distribution<double> dist(min, max);
-    return dist(tl_rng);
+    return Sampling::uniform(Sampling::threadSampler().scalar, min, max);
 }
 
 /*
@@ -774,8 +1006,7 @@ double uniformRandom(double min, double max) {
  * We provide normally distributed random numbers
  */
 double normalRandom(double mean, double stddev) {
-    std::normal_distribution<double> dist(mean, stddev);
-    return dist(tl_rng);
+    return mean + stddev * Sampling::normal(Sampling::threadSampler().scalar);
 }
 
 /*
@@ -783,8 +1014,7 @@ double normalRandom(double mean, double stddev) {
  * We model discrete random events
  */
 int poissonRandom(double lambda) {
-    std::poisson_distribution<int> dist(lambda);
-    return dist(tl_rng);
+    return Sampling::poisson(Sampling::threadSampler().scalar, lambda);
 }
 
 /*
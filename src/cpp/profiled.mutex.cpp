@@ -0,0 +1,135 @@
+/*
+ * File: src/cpp/profiled.mutex.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Profiled Mutex - Lock Profile Registry Implementation
+ * Purpose: Implements the lock profile registry, shard assignment and JSON export
+ * Reason: We expose per-lock contention at /api/v1/profile/locks
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ *
+ * Carry-over Context:
+ * - Profiles are never freed; the registry mutex is only taken when a mutex is
+ *   constructed or profiles are exported
+ */
+
+#include "profiled.mutex.h"
+
+#include <map>
+#include <memory>
+
+namespace TernaryFission {
+
+namespace {
+
+std::mutex& registryMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::map<std::string, std::unique_ptr<LockProfile>>& registry() {
+    static std::map<std::string, std::unique_ptr<LockProfile>> profiles;
+    return profiles;
+}
+
+} // namespace
+
+std::size_t LockProfile::assignShard() {
+    static std::atomic<std::size_t> next{0};
+    return next.fetch_add(1, std::memory_order_relaxed) % kLockProfileShards;
+}
+
+std::uint64_t LockProfile::acquisitions() const {
+    std::uint64_t total = 0;
+    for (const auto& shard : shards_) {
+        total += shard.acquisitions.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+std::uint64_t LockProfile::contended() const {
+    std::uint64_t total = 0;
+    for (const auto& shard : shards_) {
+        total += shard.contended.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+std::uint64_t LockProfile::waitNanoseconds() const {
+    std::uint64_t total = 0;
+    for (const auto& shard : shards_) {
+        total += shard.wait_ticks.load(std::memory_order_relaxed);
+    }
+    return static_cast<std::uint64_t>(CycleClock::ticksToNanoseconds(total));
+}
+
+std::uint64_t LockProfile::holdNanoseconds() const {
+    std::uint64_t total = 0;
+    for (const auto& shard : shards_) {
+        total += shard.hold_ticks.load(std::memory_order_relaxed);
+    }
+    return static_cast<std::uint64_t>(CycleClock::ticksToNanoseconds(total));
+}
+
+void LockProfile::reset() {
+    for (auto& shard : shards_) {
+        shard.acquisitions.store(0, std::memory_order_relaxed);
+        shard.contended.store(0, std::memory_order_relaxed);
+        shard.wait_ticks.store(0, std::memory_order_relaxed);
+        shard.hold_ticks.store(0, std::memory_order_relaxed);
+        shard.wait.reset();
+        shard.hold.reset();
+    }
+}
+
+Json::Value LockProfile::toJson() const {
+    LatencyHistogram::Snapshot wait;
+    LatencyHistogram::Snapshot hold;
+    for (const auto& shard : shards_) {
+        wait.merge(shard.wait.snapshot());
+        hold.merge(shard.hold.snapshot());
+    }
+
+    std::uint64_t total = acquisitions();
+    std::uint64_t blocked = contended();
+    const double ticks_per_ns = CycleClock::ticksPerSecond() / 1e9;
+
+    Json::Value json;
+    json["instances"] = static_cast<Json::UInt>(instances_.load(std::memory_order_relaxed));
+    json["acquisitions"] = static_cast<Json::UInt64>(total);
+    json["contended"] = static_cast<Json::UInt64>(blocked);
+    json["contention_rate"] = total > 0 ? static_cast<double>(blocked) / static_cast<double>(total) : 0.0;
+    json["wait_ns"] = static_cast<Json::UInt64>(waitNanoseconds());
+    json["hold_ns"] = static_cast<Json::UInt64>(holdNanoseconds());
+    json["wait_ns_histogram"] = wait.toJson(ticks_per_ns);
+    json["hold_ns_histogram"] = hold.toJson(ticks_per_ns);
+    return json;
+}
+
+LockProfile& lockProfile(const std::string& name) {
+    std::lock_guard<std::mutex> lock(registryMutex());
+    auto& profile = registry()[name];
+    if (!profile) {
+        profile = std::make_unique<LockProfile>(name);
+    }
+    return *profile;
+}
+
+Json::Value lockProfilesToJson() {
+    std::lock_guard<std::mutex> lock(registryMutex());
+    Json::Value locks(Json::objectValue);
+    for (const auto& [name, profile] : registry()) {
+        locks[name] = profile->toJson();
+    }
+    return locks;
+}
+
+void resetLockProfiles() {
+    std::lock_guard<std::mutex> lock(registryMutex());
+    for (auto& [name, profile] : registry()) {
+        profile->reset();
+    }
+}
+
+} // namespace TernaryFission
@@ -0,0 +1,594 @@
+/*
+ * File: src/cpp/random.samplers.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Random Samplers Implementation
+ * Purpose: Implements generator seeding, the ziggurat tables and slow paths, Poisson
+ *          sampling and the bulk fill loops
+ * Reason: Keeps sampling cheap enough to call several times per fission event
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ * - 2026-10-17: Added fillDirections
+ *
+ * Carry-over Context:
+ * - Ziggurat constants are Marsaglia & Tsang's for 256 layers (R = 3.6541528853610088,
+ *   V = 0.00492867323399); layer 0 is the base strip plus the tail beyond R
+ * - Bulk fills work in kBlock-sized chunks on the stack so nothing is allocated
+ * - PTRS follows Hörmann (1993), "The transformed rejection method for generating
+ *   Poisson random variables"
+ */
+
+#include "random.samplers.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <random>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+namespace TernaryFission {
+namespace Sampling {
+
+namespace {
+
+constexpr std::size_t kZigguratLayers = 256;
+constexpr double kZigguratR = 3.6541528853610088;
+constexpr double kZigguratV = 0.00492867323399;
+
+// We draw raw words this many at a time in the bulk loops
+constexpr std::size_t kBlock = 256;
+
+// We step and convert lanes in the widest vectors the target has, via GCC/Clang vector
+// extensions; kLanes is a multiple of every width
+#if defined(__AVX512F__)
+constexpr std::size_t kVectorLanes = 8;
+#elif defined(__AVX2__)
+constexpr std::size_t kVectorLanes = 4;
+#else
+constexpr std::size_t kVectorLanes = 2;
+#endif
+constexpr std::size_t kVectorsPerStep = LaneGenerator::kLanes / kVectorLanes;
+static_assert(LaneGenerator::kLanes % kVectorLanes == 0, "lanes must fill whole vectors");
+
+typedef std::uint64_t LaneVector __attribute__((vector_size(kVectorLanes * sizeof(std::uint64_t))));
+typedef double LaneDoubles __attribute__((vector_size(kVectorLanes * sizeof(double))));
+
+/*
+ * Load table[index[lane]] for every lane
+ * We use hardware gathers where the target has them; the portable loop is scalar loads
+ */
+inline void gatherLanes(const double* table, const LaneVector& index, LaneDoubles& result) {
+#if defined(__AVX512F__)
+    __m512i lanes;
+    std::memcpy(&lanes, &index, sizeof(lanes));
+    const __m512d loaded = _mm512_mask_i64gather_pd(_mm512_setzero_pd(), 0xFF, lanes, table, sizeof(double));
+    std::memcpy(&result, &loaded, sizeof(result));
+#elif defined(__AVX2__)
+    __m256i lanes;
+    std::memcpy(&lanes, &index, sizeof(lanes));
+    const __m256d loaded = _mm256_i64gather_pd(table, lanes, sizeof(double));
+    std::memcpy(&result, &loaded, sizeof(result));
+#else
+    for (std::size_t lane = 0; lane < kVectorLanes; ++lane) {
+        result[lane] = table[index[lane]];
+    }
+#endif
+}
+
+/*
+ * toUnit() on every lane: [1, 2) from the exponent trick, minus 1, plus the 53rd bit
+ */
+inline void unitLanes(const LaneVector& bits, LaneDoubles& result) {
+    const LaneVector one_to_two_bits = (bits >> 12) | 0x3FF0000000000000ULL;
+    const LaneVector half_ulp_bits = (0 - ((bits >> 11) & 1)) & 0x3CA0000000000000ULL;
+    LaneDoubles one_to_two;
+    LaneDoubles half_ulp;
+    std::memcpy(&one_to_two, &one_to_two_bits, sizeof(one_to_two));
+    std::memcpy(&half_ulp, &half_ulp_bits, sizeof(half_ulp));
+    result = (one_to_two - 1.0) + half_ulp;
+}
+
+/*
+ * One bit per lane, set where the lane is all ones
+ */
+inline unsigned laneMask(const LaneVector& lanes) {
+#if defined(__AVX512DQ__)
+    __m512i bits;
+    std::memcpy(&bits, &lanes, sizeof(bits));
+    return _mm512_movepi64_mask(bits);
+#elif defined(__AVX2__)
+    __m256d bits;
+    std::memcpy(&bits, &lanes, sizeof(bits));
+    return static_cast<unsigned>(_mm256_movemask_pd(bits));
+#else
+    unsigned mask = 0;
+    for (std::size_t lane = 0; lane < kVectorLanes; ++lane) {
+        mask |= static_cast<unsigned>(lanes[lane] & 1) << lane;
+    }
+    return mask;
+#endif
+}
+
+/*
+ * Square root on every lane
+ * We call the intrinsics because std::sqrt may set errno and so stays scalar
+ */
+inline void sqrtLanes(const LaneDoubles& value, LaneDoubles& result) {
+#if defined(__AVX512F__)
+    __m512d lanes;
+    std::memcpy(&lanes, &value, sizeof(lanes));
+    const __m512d root = _mm512_mask_sqrt_pd(_mm512_setzero_pd(), 0xFF, lanes);
+    std::memcpy(&result, &root, sizeof(result));
+#elif defined(__AVX2__)
+    __m256d lanes;
+    std::memcpy(&lanes, &value, sizeof(lanes));
+    const __m256d root = _mm256_sqrt_pd(lanes);
+    std::memcpy(&result, &root, sizeof(result));
+#else
+    for (std::size_t lane = 0; lane < kVectorLanes; ++lane) {
+        result[lane] = std::sqrt(value[lane]);
+    }
+#endif
+}
+
+struct ZigguratTables {
+    double x[kZigguratLayers + 1];     // Layer edges; x[0] is the base strip's virtual width
+    double ratio[kZigguratLayers];     // x[i + 1] / x[i]: |u| below this is inside the layer
+    double f[kZigguratLayers + 1];     // exp(-x[i]^2 / 2), the density at each edge
+};
+
+ZigguratTables buildZigguratTables() {
+    ZigguratTables tables;
+    double f = std::exp(-0.5 * kZigguratR * kZigguratR);
+    tables.x[0] = kZigguratV / f;
+    tables.x[1] = kZigguratR;
+    tables.x[kZigguratLayers] = 0.0;
+    for (std::size_t i = 2; i < kZigguratLayers; ++i) {
+        tables.x[i] = std::sqrt(-2.0 * std::log(kZigguratV / tables.x[i - 1] + f));
+        f = std::exp(-0.5 * tables.x[i] * tables.x[i]);
+    }
+    for (std::size_t i = 0; i < kZigguratLayers; ++i) {
+        tables.ratio[i] = tables.x[i + 1] / tables.x[i];
+    }
+    for (std::size_t i = 0; i <= kZigguratLayers; ++i) {
+        tables.f[i] = std::exp(-0.5 * tables.x[i] * tables.x[i]);
+    }
+    return tables;
+}
+
+const ZigguratTables& zigguratTables() {
+    static const ZigguratTables tables = buildZigguratTables();
+    return tables;
+}
+
+/*
+ * Clear the upper halves of the vector registers before scalar libm calls
+ * GCC 12 can leave them dirty after vectorized code (it skipped vzeroupper after reseed()
+ * and before the slow-path exp() in fillNormal); dirty upper halves make every later SSE
+ * instruction, libm's exp and log included, about 10x slower
+ */
+inline void cleanUpperVectorState() {
+#if defined(__AVX__)
+    _mm256_zeroupper();
+#endif
+}
+
+/*
+ * Uniform in (0, 1), safe to take the log of
+ */
+inline double openUnit(Xoshiro256& rng) {
+    return (static_cast<double>(rng() >> 11) + 0.5) * 0x1.0p-53;
+}
+
+/*
+ * Sample beyond R for the base layer (Marsaglia's tail method)
+ */
+double normalTail(Xoshiro256& rng, bool negative) {
+    double x = 0.0;
+    double y = 0.0;
+    do {
+        x = std::log(openUnit(rng)) / kZigguratR;
+        y = std::log(openUnit(rng));
+    } while (-2.0 * y < x * x);
+    return negative ? x - kZigguratR : kZigguratR - x;
+}
+
+/*
+ * Finish a draw that missed the fast path in layer i with abscissa u
+ * We test the wedge (or the tail for layer 0), and start over with fresh draws on rejection
+ */
+double normalSlow(Xoshiro256& rng, const ZigguratTables& tables, std::size_t i, double u) {
+    for (;;) {
+        if (i == 0) {
+            return normalTail(rng, u < 0.0);
+        }
+        // We accept if a uniform height in the wedge falls under the density at x
+        const double x = u * tables.x[i];
+        const double height = tables.f[i + 1] + uniform01(rng) * (tables.f[i] - tables.f[i + 1]);
+        if (height < std::exp(-0.5 * x * x)) {
+            return x;
+        }
+
+        const std::uint64_t bits = rng();
+        i = static_cast<std::size_t>(bits & (kZigguratLayers - 1));
+        u = 2.0 * toUnit(bits) - 1.0;
+        if (std::fabs(u) < tables.ratio[i]) {
+            return u * tables.x[i];
+        }
+    }
+}
+
+std::uint64_t deviceSeed() {
+    // We mix in a counter in case random_device is deterministic on this platform
+    static std::atomic<std::uint64_t> sequence{0};
+    std::random_device device;
+    std::uint64_t seed = (static_cast<std::uint64_t>(device()) << 32) ^ device();
+    std::uint64_t mix = sequence.fetch_add(1, std::memory_order_relaxed);
+    return seed ^ splitMix64(mix);
+}
+
+void seedSampler(ThreadSampler& sampler, std::uint64_t seed) {
+    sampler.scalar.reseed(seed);
+    Xoshiro256 source = sampler.scalar;
+    source.jump();
+    sampler.lanes.seedFrom(source);
+    cleanUpperVectorState();
+}
+
+ThreadSampler makeSampler() {
+    ThreadSampler sampler;
+    seedSampler(sampler, deviceSeed());
+    return sampler;
+}
+
+} // namespace
+
+void Xoshiro256::jump() {
+    static const std::uint64_t kJump[] = {0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+                                          0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL};
+    std::uint64_t s0 = 0;
+    std::uint64_t s1 = 0;
+    std::uint64_t s2 = 0;
+    std::uint64_t s3 = 0;
+    for (std::uint64_t word : kJump) {
+        for (int b = 0; b < 64; ++b) {
+            if (word & (1ULL << b)) {
+                s0 ^= s_[0];
+                s1 ^= s_[1];
+                s2 ^= s_[2];
+                s3 ^= s_[3];
+            }
+            (*this)();
+        }
+    }
+    s_[0] = s0;
+    s_[1] = s1;
+    s_[2] = s2;
+    s_[3] = s3;
+}
+
+void LaneGenerator::seedFrom(Xoshiro256& source) {
+    for (std::size_t lane = 0; lane < kLanes; ++lane) {
+        const std::uint64_t* state = source.state();
+        s0_[lane] = state[0];
+        s1_[lane] = state[1];
+        s2_[lane] = state[2];
+        s3_[lane] = state[3];
+        source.jump();
+    }
+}
+
+void LaneGenerator::fill(std::uint64_t* out, std::size_t n) {
+    // We step local copies so the compiler knows out cannot alias the state
+    LaneVector s0[kVectorsPerStep];
+    LaneVector s1[kVectorsPerStep];
+    LaneVector s2[kVectorsPerStep];
+    LaneVector s3[kVectorsPerStep];
+    std::memcpy(s0, s0_, sizeof(s0));
+    std::memcpy(s1, s1_, sizeof(s1));
+    std::memcpy(s2, s2_, sizeof(s2));
+    std::memcpy(s3, s3_, sizeof(s3));
+
+    for (std::size_t i = 0; i < n; i += kLanes) {
+        LaneVector draw[kVectorsPerStep];
+        for (std::size_t v = 0; v < kVectorsPerStep; ++v) {
+            const LaneVector sum = s0[v] + s3[v];
+            draw[v] = ((sum << 23) | (sum >> 41)) + s0[v];
+            const LaneVector t = s1[v] << 17;
+            s2[v] ^= s0[v];
+            s3[v] ^= s1[v];
+            s1[v] ^= s2[v];
+            s0[v] ^= s3[v];
+            s2[v] ^= t;
+            s3[v] = (s3[v] << 45) | (s3[v] >> 19);
+        }
+
+        if (n - i >= kLanes) {
+            std::memcpy(out + i, draw, sizeof(draw));
+        } else {
+            std::memcpy(out + i, draw, (n - i) * sizeof(std::uint64_t));
+        }
+    }
+
+    std::memcpy(s0_, s0, sizeof(s0));
+    std::memcpy(s1_, s1, sizeof(s1));
+    std::memcpy(s2_, s2, sizeof(s2));
+    std::memcpy(s3_, s3, sizeof(s3));
+}
+
+ThreadSampler& threadSampler() {
+    thread_local ThreadSampler sampler = makeSampler();
+    return sampler;
+}
+
+void seedThread(std::uint64_t seed) {
+    seedSampler(threadSampler(), seed);
+}
+
+double normal(Xoshiro256& rng) {
+    const ZigguratTables& tables = zigguratTables();
+    const std::uint64_t bits = rng();
+    const std::size_t i = static_cast<std::size_t>(bits & (kZigguratLayers - 1));
+    const double u = 2.0 * toUnit(bits) - 1.0;
+    if (std::fabs(u) < tables.ratio[i]) {
+        return u * tables.x[i];
+    }
+    return normalSlow(rng, tables, i, u);
+}
+
+PoissonParams::PoissonParams(double mean) : lambda(mean) {
+    if (lambda < kPoissonInversionLimit) {
+        exp_neg_lambda = std::exp(-lambda);
+        return;
+    }
+    const double sqrt_lambda = std::sqrt(lambda);
+    log_lambda = std::log(lambda);
+    b = 0.931 + 2.53 * sqrt_lambda;
+    a = -0.059 + 0.02483 * b;
+    inv_alpha = 1.1239 + 1.1328 / (b - 3.4);
+    v_r = 0.9277 - 3.6224 / (b - 2.0);
+}
+
+/*
+ * Inversion by sequential search; expected cost is about lambda + 1 steps
+ */
+static inline int poissonInversion(double u, const PoissonParams& params) {
+    int k = 0;
+    double p = params.exp_neg_lambda;
+    double cdf = p;
+    // We stop if p underflows so rounding in the cdf cannot loop forever
+    while (u > cdf && p > 0.0) {
+        ++k;
+        p *= params.lambda / k;
+        cdf += p;
+    }
+    return k;
+}
+
+int poisson(Xoshiro256& rng, const PoissonParams& params) {
+    if (params.lambda <= 0.0) {
+        return 0;
+    }
+    if (params.lambda < kPoissonInversionLimit) {
+        return poissonInversion(uniform01(rng), params);
+    }
+
+    for (;;) {
+        const double u = uniform01(rng) - 0.5;
+        const double v = openUnit(rng);
+        const double us = 0.5 - std::fabs(u);
+        const double k = std::floor((2.0 * params.a / us + params.b) * u + params.lambda + 0.43);
+        if (us >= 0.07 && v <= params.v_r) {
+            return static_cast<int>(k);
+        }
+        if (k < 0.0 || (us < 0.013 && v > us)) {
+            continue;
+        }
+        if (std::log(v) + std::log(params.inv_alpha) - std::log(params.a / (us * us) + params.b) <=
+            -params.lambda + k * params.log_lambda - std::lgamma(k + 1.0)) {
+            return static_cast<int>(k);
+        }
+    }
+}
+
+int poisson(Xoshiro256& rng, double lambda) {
+    return poisson(rng, PoissonParams(lambda));
+}
+
+void fillUniform(double* out, std::size_t n, double min, double max) {
+    LaneGenerator& lanes = threadSampler().lanes;
+    const double scale = max - min;
+    alignas(64) std::uint64_t raw[kBlock];
+    while (n > 0) {
+        const std::size_t count = n < kBlock ? n : kBlock;
+        lanes.fill(raw, (count + kVectorLanes - 1) / kVectorLanes * kVectorLanes);
+        for (std::size_t i = 0; i < count; i += kVectorLanes) {
+            LaneVector bits;
+            std::memcpy(&bits, raw + i, sizeof(bits));
+            LaneDoubles unit;
+            unitLanes(bits, unit);
+            const LaneDoubles value = min + scale * unit;
+            if (i + kVectorLanes <= count) {
+                std::memcpy(out + i, &value, sizeof(value));
+            } else {
+                for (std::size_t lane = 0; i + lane < count; ++lane) {
+                    out[i + lane] = value[lane];
+                }
+            }
+        }
+        out += count;
+        n -= count;
+    }
+}
+
+void fillNormal(double* out, std::size_t n, double mean, double stddev) {
+    ThreadSampler& sampler = threadSampler();
+    const ZigguratTables& tables = zigguratTables();
+    alignas(64) std::uint64_t raw[kBlock];
+    unsigned missed[kBlock / kVectorLanes];
+    while (n > 0) {
+        const std::size_t count = n < kBlock ? n : kBlock;
+        // We fill whole vectors; draws past count are discarded
+        sampler.lanes.fill(raw, (count + kVectorLanes - 1) / kVectorLanes * kVectorLanes);
+
+        // We take the fast path a vector at a time without branching, then patch rejections
+        for (std::size_t i = 0; i < count; i += kVectorLanes) {
+            LaneVector bits;
+            std::memcpy(&bits, raw + i, sizeof(bits));
+            const LaneVector layer = bits & (kZigguratLayers - 1);
+
+            LaneDoubles unit;
+            unitLanes(bits, unit);
+            const LaneDoubles u = 2.0 * unit - 1.0;
+
+            LaneDoubles edge;
+            LaneDoubles ratio;
+            gatherLanes(tables.x, layer, edge);
+            gatherLanes(tables.ratio, layer, ratio);
+            const LaneDoubles abs_u = u < 0.0 ? -u : u;
+            const LaneDoubles value = mean + stddev * (u * edge);
+            const LaneVector outside = reinterpret_cast<LaneVector>(~(abs_u < ratio));
+            missed[i / kVectorLanes] = laneMask(outside);
+
+            if (i + kVectorLanes <= count) {
+                std::memcpy(out + i, &value, sizeof(value));
+            } else {
+                for (std::size_t lane = 0; i + lane < count; ++lane) {
+                    out[i + lane] = value[lane];
+                }
+            }
+        }
+        cleanUpperVectorState();
+
+        // About 1.5% of slots miss, so most vectors have nothing to patch
+        for (std::size_t v = 0; v * kVectorLanes < count; ++v) {
+            for (unsigned mask = missed[v]; mask != 0; mask &= mask - 1) {
+                const std::size_t i = v * kVectorLanes + static_cast<std::size_t>(__builtin_ctz(mask));
+                if (i >= count) {
+                    break;
+                }
+                const std::size_t layer = static_cast<std::size_t>(raw[i] & (kZigguratLayers - 1));
+                const double u = 2.0 * toUnit(raw[i]) - 1.0;
+                out[i] = mean + stddev * normalSlow(sampler.scalar, tables, layer, u);
+            }
+        }
+        out += count;
+        n -= count;
+    }
+}
+
+void fillPoisson(int* out, std::size_t n, double lambda) {
+    ThreadSampler& sampler = threadSampler();
+    const PoissonParams params(lambda);
+    if (lambda <= 0.0) {
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = 0;
+        }
+        return;
+    }
+    if (lambda >= kPoissonInversionLimit) {
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = poisson(sampler.scalar, params);
+        }
+        return;
+    }
+
+    // We tabulate the cdf once and count, for a whole block, the entries below each draw;
+    // the count runs edge-major so it vectorizes across draws, where a search per draw
+    // mispredicts on almost every one. Draws past the last entry redo the sequential search
+    constexpr int kCdfTerms = 64;
+    alignas(64) double cdf[kCdfTerms];
+    double p = params.exp_neg_lambda;
+    cdf[0] = p;
+    int terms = 1;
+    while (terms < kCdfTerms && cdf[terms - 1] < 1.0 - 0x1.0p-53) {
+        p *= lambda / terms;
+        cdf[terms] = cdf[terms - 1] + p;
+        ++terms;
+    }
+
+    std::uint64_t raw[kBlock];
+    while (n > 0) {
+        const std::size_t count = n < kBlock ? n : kBlock;
+        sampler.lanes.fill(raw, count);
+        double u[kBlock];
+        std::int64_t k[kBlock];
+        for (std::size_t i = 0; i < count; ++i) {
+            u[i] = toUnit(raw[i]);
+            k[i] = 0;
+        }
+        for (int j = 0; j < terms; ++j) {
+            const double edge = cdf[j];
+            for (std::size_t i = 0; i < count; ++i) {
+                k[i] += u[i] > edge;
+            }
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = k[i] < terms ? static_cast<int>(k[i]) : poissonInversion(u[i], params);
+        }
+        out += count;
+        n -= count;
+    }
+}
+
+void fillDirections(double* x, double* y, double* z, std::size_t n) {
+    ThreadSampler& sampler = threadSampler();
+    std::uint64_t raw[kBlock];
+    double cx[kBlock];
+    double cy[kBlock];
+    double cz[kBlock];
+    std::uint64_t accepted[kBlock];
+    const std::uint64_t exponent = 0x3FF0000000000000ULL;
+    while (n > 0) {
+        // We draw about 4/3 candidates per vector still wanted, so short fills waste little;
+        // whole vectors only, so kBlock stays the bound
+        const std::size_t wanted = (n + n / 3 + kVectorLanes) & ~(kVectorLanes - 1);
+        const std::size_t count = wanted < kBlock ? wanted : kBlock;
+        sampler.lanes.fill(raw, count);
+        for (std::size_t i = 0; i < count; i += kVectorLanes) {
+            LaneVector bits;
+            std::memcpy(&bits, raw + i, sizeof(bits));
+            const LaneVector high_bits = ((bits >> 32) << 20) | exponent;
+            const LaneVector low_bits = (bits << 32 >> 12) | exponent;
+            LaneDoubles high;
+            LaneDoubles low;
+            std::memcpy(&high, &high_bits, sizeof(high));
+            std::memcpy(&low, &low_bits, sizeof(low));
+            const LaneDoubles u = 2.0 * high - 3.0;
+            const LaneDoubles v = 2.0 * low - 3.0;
+            const LaneDoubles s = u * u + v * v;
+            const LaneDoubles rest = 1.0 - s;
+            const LaneDoubles clamped = rest > 0.0 ? rest : 0.0;
+            LaneDoubles root;
+            sqrtLanes(clamped, root);
+            const LaneDoubles lx = 2.0 * u * root;
+            const LaneDoubles ly = 2.0 * v * root;
+            const LaneDoubles lz = 1.0 - 2.0 * s;
+            const LaneVector inside = reinterpret_cast<LaneVector>(s < 1.0);
+            std::memcpy(cx + i, &lx, sizeof(lx));
+            std::memcpy(cy + i, &ly, sizeof(ly));
+            std::memcpy(cz + i, &lz, sizeof(lz));
+            std::memcpy(accepted + i, &inside, sizeof(inside));
+        }
+        // We compact without a branch on the acceptance; rejected slots are overwritten
+        std::size_t written = 0;
+        for (std::size_t i = 0; i < count && written < n; ++i) {
+            x[written] = cx[i];
+            y[written] = cy[i];
+            z[written] = cz[i];
+            written += accepted[i] & 1;
+        }
+        x += written;
+        y += written;
+        z += written;
+        n -= written;
+    }
+    cleanUpperVectorState();
+}
+
+} // namespace Sampling
+} // namespace TernaryFission
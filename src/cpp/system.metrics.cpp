@@ -66,7 +66,7 @@ double getCPUUsagePercent() {
 }
 
 MemoryUsage getMemoryUsage() {
-    MemoryUsage usage{0.0, 0};
+    MemoryUsage usage{0.0, 0, 0};
 #ifdef __linux__
     std::ifstream status("/proc/self/status");
     std::string line;
@@ -88,6 +88,7 @@ MemoryUsage getMemoryUsage() {
     double percent = total ? (static_cast<double>(rss_bytes) * 100.0) / total : 0.0;
     usage.percent = percent;
     usage.peak_bytes = hwm_bytes;
+    usage.rss_bytes = rss_bytes;
 #elif defined(__APPLE__)
     mach_task_basic_info_data_t info;
     mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
@@ -100,6 +101,7 @@ MemoryUsage getMemoryUsage() {
         double percent = phys_mem ? (static_cast<double>(rss) * 100.0) / phys_mem : 0.0;
         usage.percent = percent;
         usage.peak_bytes = peak;
+        usage.rss_bytes = rss;
     }
 #endif
     return usage;
@@ -20,6 +20,58 @@
  *               Added energy field management API endpoints
  *               Added simulation control API endpoints
  *               Maintained all existing CLI functionality and performance
+ * - 2026-10-17: Engine mutexes record lock wait statistics via CountedLockGuard
+ * - 2026-10-17: Fixed field memory leaks (erase, shutdown, portal expiry), bounded
+ *               fission event history and dissipated fields during continuous mode
+ * - 2026-10-17: Trace spans around simulate/generate/process/updateEnergyFields and the
+ *               state_mutex wait in processFissionEvent
+ * - 2026-10-17: Generate/process phase cycle accounting, measured field cycles in
+ *               field JSON and getFieldCyclesAPI
+ * - 2026-10-17: Engine mutexes are ProfiledMutex; the state_mutex trace span is now the
+ *               mutex's own lock_wait span
+ * - 2026-10-17: Allocation scopes on generate/process; generateFissionEvents batch API
+ * - 2026-10-17: Conservation, queue wait and lock wait phase latencies; phase latency
+ *               percentiles in getSystemStatusAPI
+ * - 2026-10-17: Continuous mode start/stop is logged to the flight recorder and resets
+ *               its watchdog baselines
+ * - 2026-10-17: Field JSON reports backing memory and page faults; getFieldCyclesAPI
+ *               sums allocation/fill faults and mapped bytes
+ * - 2026-10-17: evictEnergyFields is the memory governor's reclaimer; events whose
+ *               field the governor rejects are kept in history without a field
+ * - 2026-10-17: readEnergyFieldBytes serves slices of materialized and virtual fields;
+ *               memory accounting reports virtual field bytes separately
+ * - 2026-10-17: processFissionEvent registers fields as materializing and a FieldFillPool
+ *               allocates and fills them; materializing fields are not dissipated
+ * - 2026-10-17: updateEnergyFields dissipates field state only and schedules the entropy
+ *               pass over field memory on a DissipationScheduler, one slice per lock hold
+ * - 2026-10-17: Active event fields queue their CPU budget with a CpuBurnExecutor, which
+ *               charges measured burn cycles back to the field
+ * - 2026-10-17: Portal loads are kept by ID with their own field IDs and expired by a
+ *               single-threaded TimerWheel instead of a sleeping thread per trigger;
+ *               portals can be extended and cancelled
+ * - 2026-10-17: reset() clears the engine in place behind a reset epoch; events commit
+ *               only in the epoch they were generated in
+ * - 2026-10-17: generateFissionEvents draws heavy fragment directions in bulk; the
+ *               per-fragment momenta that applyConservationLaws overwrote are no longer drawn
+ * - 2026-10-17: Fragment pairs are sampled from alias-table yields (configureFragmentYields)
+ *               built from the configured mass humps instead of a fixed normal mass ratio
+ * - 2026-10-17: Fragments carry binding energies from the NuclearMassTable; yield-table
+ *               events take their atomic masses and Q-value from it instead of 931.5 x a
+ *               proportional mass split
+ * - 2026-10-17: Parents come from a NuclideRegistry (Z, A, yields, Q constants); nuclide
+ *               batches generate each parent's events together and return them in order
+ * - 2026-10-17: Portal start and extension no longer turn a governor rejection into 0/false
+ * - 2026-10-17: Portal start and extension check the reset epoch and drop their field when
+ *               a reset ran meanwhile
+ * - 2026-10-17: Mass-only calls resolve their parent by A across the registry (239 is
+ *               Pu-239, 252 is Cf-252); simulateTernaryFissionEventAPI takes "nuclide"
+ * - 2026-10-17: reset() quiesces workers, the continuous generator and state-changing API
+ *               calls behind an EpochBarrier before it swaps state
+ * - 2026-10-17: Portal timers round the remaining time up; an early expiry re-arms the timer
+ * - 2026-10-17: simulateTernaryFissionEventAPI resolves a named parent once and generates
+ *               all of its events in one grouped batch
+ * - 2026-10-17: The generateFissionEvents overloads share one chunked direction loop
+ *               (sampleHeavyDirections)
  *
  * Carry-over Context:
  * - Engine provides complete HTTP API interface for daemon mode operations
@@ -33,6 +85,14 @@
 #include "ternary.fission.simulation.engine.h"
 #include "physics.utilities.h"
 #include "config.ternary.fission.server.h"
+#include "trace.ring.h"
+#include "perf.counters.h"
+#include "allocation.tracker.h"
+#include "flight.recorder.h"
+#include "field.memory.h"
+#include "field.fill.pool.h"
+#include "random.samplers.h"
+#include "nuclear.masses.h"
 
 #include <iostream>
 #include <iomanip>
@@ -110,6 +170,39 @@ TernaryFissionSimulationEngine::TernaryFissionSimulationEngine(double default_ma
     // Initialize physics utilities
     initializePhysicsUtilities();
 
+    // We let the memory governor evict our fields when field memory hits its cap
+    Governor::setReclaimer(this, [this](std::size_t bytes_needed, Governor::Policy policy,
+                                        std::size_t& fields_evicted) {
+        return evictEnergyFields(bytes_needed, policy, fields_evicted);
+    });
+
+    configureFieldFill(kDefaultFieldFillThreads, kDefaultFieldFillInFlightBytes);
+
+    // We start from the default mass humps; a parent with no valid split keeps the legacy ratio
+    try {
+        configureFragmentYields(FragmentYieldModel());
+    } catch (const std::exception& e) {
+        std::cerr << "Warning: no nuclide registry for parent mass " << default_mass << ": " << e.what()
+                  << std::endl;
+    }
+
+    dissipation_scheduler_ = std::make_unique<DissipationScheduler>(
+        [this](std::uint64_t field_id, std::size_t offset, std::size_t length) {
+            return dissipateFieldSlice(field_id, offset, length);
+        },
+        DissipationScheduler::Settings());
+    dissipation_scheduler_->start();
+
+    portal_timers_ = std::make_unique<TimerWheel>(kPortalTimerTick, kPortalTimerSlots,
+                                                  [this](std::uint64_t portal_id) {
+        expirePortalLoad(portal_id);
+    });
+
+    cpu_burn_executor_ = std::make_unique<CpuBurnExecutor>(
+        [this](std::uint64_t field_id, std::uint64_t cycles) {
+            return chargeFieldBurn(field_id, cycles);
+        });
+
     std::cout << "Ternary Fission Simulation Engine initialized with HTTP API support" << std::endl;
     std::cout << "Default parent nucleus: U-" << static_cast<int>(default_mass) << std::endl;
     std::cout << "Default excitation energy: " << default_energy << " MeV" << std::endl;
@@ -122,6 +215,7 @@ TernaryFissionSimulationEngine::TernaryFissionSimulationEngine(double default_ma
  * We ensure proper cleanup of all resources
  */
 TernaryFissionSimulationEngine::~TernaryFissionSimulationEngine() {
+    Governor::clearReclaimer(this);
     shutdown();
 }
 
@@ -131,13 +225,18 @@ TernaryFissionSimulationEngine::~TernaryFissionSimulationEngine() {
  */
 TernaryFissionEvent TernaryFissionSimulationEngine::simulateTernaryFissionEvent(double parent_mass,
                                                                                 double excitation_energy) {
+    TF_TRACE_SCOPE("simulateTernaryFissionEvent", "engine");
+    EpochBarrier::Scope epoch_scope(epoch_barrier_);
     auto start_time = std::chrono::high_resolution_clock::now();
+    const std::uint64_t epoch = reset_epoch_.load(std::memory_order_acquire);
 
     // Generate the fission event
     TernaryFissionEvent event = generateFissionEvent(parent_mass, excitation_energy);
 
     // Process the event (create energy fields, apply conservation laws)
-    processFissionEvent(event);
+    if (!processFissionEvent(event, epoch)) {
+        return event;
+    }
 
     // Update statistics
     total_events_simulated.fetch_add(1, std::memory_order_relaxed);
@@ -146,7 +245,7 @@ TernaryFissionEvent TernaryFissionSimulationEngine::simulateTernaryFissionEvent(
     auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
 
     {
-        std::lock_guard<std::mutex> lock(computation_time_mutex);
+        std::lock_guard<ProfiledMutex> lock(computation_time_mutex);
         total_computation_time_seconds += duration.count() / 1e6;
     }
 
@@ -160,12 +259,82 @@ TernaryFissionEvent TernaryFissionSimulationEngine::simulateTernaryFissionEvent(
     return simulateTernaryFissionEvent(default_parent_mass, default_excitation_energy);
 }
 
+/*
+ * Simulate events for a mix of registered parents
+ * We resolve every symbol first, generate per nuclide, then process in request order
+ */
+std::vector<TernaryFissionEvent> TernaryFissionSimulationEngine::simulateTernaryFissionEvents(
+    const std::vector<std::string>& nuclides, double excitation_energy) {
+    TF_TRACE_SCOPE("simulateTernaryFissionEvents", "engine");
+    const std::shared_ptr<const NuclideRegistry> registry = std::atomic_load(&nuclides_);
+    if (!registry) {
+        throw std::invalid_argument("no nuclide registry is configured");
+    }
+    std::vector<std::size_t> parents(nuclides.size());
+    for (std::size_t i = 0; i < nuclides.size(); ++i) {
+        const Nuclide* nuclide = registry->find(nuclides[i]);
+        if (!nuclide) {
+            throw std::invalid_argument("unknown nuclide \"" + nuclides[i] + "\"");
+        }
+        parents[i] = registry->indexOf(*nuclide);
+    }
+
+    EpochBarrier::Scope epoch_scope(epoch_barrier_);
+    auto start_time = std::chrono::high_resolution_clock::now();
+    const std::uint64_t epoch = reset_epoch_.load(std::memory_order_acquire);
+    std::vector<TernaryFissionEvent> events(nuclides.size());
+    generateFissionEvents(events.data(), parents.data(), events.size(), *registry, excitation_energy);
+    processFissionEvents(events, epoch, start_time);
+    return events;
+}
+
+/*
+ * Simulate count events of one registered parent
+ * We generate the whole run in one grouped call instead of resolving and generating per event
+ */
+std::vector<TernaryFissionEvent> TernaryFissionSimulationEngine::simulateTernaryFissionEvents(
+    const Nuclide& nuclide, std::size_t count, double excitation_energy) {
+    TF_TRACE_SCOPE("simulateTernaryFissionEvents", "engine");
+    EpochBarrier::Scope epoch_scope(epoch_barrier_);
+    auto start_time = std::chrono::high_resolution_clock::now();
+    const std::uint64_t epoch = reset_epoch_.load(std::memory_order_acquire);
+    std::vector<TernaryFissionEvent> events(count);
+    generateFissionEvents(events.data(), events.size(), nuclide, excitation_energy);
+    processFissionEvents(events, epoch, start_time);
+    return events;
+}
+
+void TernaryFissionSimulationEngine::processFissionEvents(const std::vector<TernaryFissionEvent>& events,
+                                                          std::uint64_t epoch,
+                                                          std::chrono::high_resolution_clock::time_point start_time) {
+    std::uint64_t committed = 0;
+    for (const TernaryFissionEvent& event : events) {
+        if (processFissionEvent(event, epoch)) {
+            ++committed;
+        }
+    }
+    total_events_simulated.fetch_add(committed, std::memory_order_relaxed);
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
+    {
+        std::lock_guard<ProfiledMutex> lock(computation_time_mutex);
+        total_computation_time_seconds += duration.count() / 1e6;
+    }
+}
+
+TernaryFissionEvent TernaryFissionSimulationEngine::simulateTernaryFissionEvent(const std::string& nuclide,
+                                                                                double excitation_energy) {
+    return simulateTernaryFissionEvents(std::vector<std::string>{nuclide}, excitation_energy).front();
+}
+
 /*
  * HTTP API: Simulate ternary fission event with JSON response
  * We provide JSON-formatted response for HTTP API calls
  */
 Json::Value TernaryFissionSimulationEngine::simulateTernaryFissionEventAPI(const Json::Value& request) {
-    std::lock_guard<std::mutex> lock(api_mutex_);
+    TF_TRACE_SCOPE("simulateTernaryFissionEventAPI", "engine");
+    std::lock_guard<ProfiledMutex> lock(api_mutex_);
     api_request_counter_++;
 
     // Parse request parameters
@@ -173,6 +342,23 @@ Json::Value TernaryFissionSimulationEngine::simulateTernaryFissionEventAPI(const
     double excitation_energy = request.get("excitation_energy", default_excitation_energy).asDouble();
     int num_events = request.get("num_events", 1).asInt();
 
+    // We take a named parent over parent_mass when the request gives one, resolving it
+    // once for the whole request; registry keeps it alive while we generate
+    std::shared_ptr<const NuclideRegistry> registry;
+    const Nuclide* parent = nullptr;
+    if (request.isMember("nuclide")) {
+        registry = std::atomic_load(&nuclides_);
+        parent = (registry && request["nuclide"].isString()) ? registry->find(request["nuclide"].asString())
+                                                             : nullptr;
+        if (!parent) {
+            Json::Value error;
+            error["error"] = "Invalid nuclide: must be a registered parent such as \"Cf-252\"";
+            error["status"] = "error";
+            return error;
+        }
+        parent_mass = parent->mass;
+    }
+
     // Validate parameters
     if (parent_mass <= 0 || parent_mass > 300) {
         Json::Value error;
@@ -201,16 +387,31 @@ Json::Value TernaryFissionSimulationEngine::simulateTernaryFissionEventAPI(const
 
     auto start_time = std::chrono::high_resolution_clock::now();
 
-    for (int i = 0; i < num_events; i++) {
+    if (parent) {
+        // We generate a named parent's events as one grouped batch; a failure fails the batch
         try {
-            TernaryFissionEvent event = simulateTernaryFissionEvent(parent_mass, excitation_energy);
-            events_array.append(serializeFissionEventToJSON(event));
+            for (const TernaryFissionEvent& event :
+                 simulateTernaryFissionEvents(*parent, static_cast<std::size_t>(num_events), excitation_energy)) {
+                events_array.append(serializeFissionEventToJSON(event));
+            }
         } catch (const std::exception& e) {
             Json::Value error;
             error["error"] = "Event simulation failed: " + std::string(e.what());
-            error["event_index"] = static_cast<Json::Int64>(i);
+            error["event_index"] = static_cast<Json::Int64>(0);
             events_array.append(error);
         }
+    } else {
+        for (int i = 0; i < num_events; i++) {
+            try {
+                TernaryFissionEvent event = simulateTernaryFissionEvent(parent_mass, excitation_energy);
+                events_array.append(serializeFissionEventToJSON(event));
+            } catch (const std::exception& e) {
+                Json::Value error;
+                error["error"] = "Event simulation failed: " + std::string(e.what());
+                error["event_index"] = static_cast<Json::Int64>(i);
+                events_array.append(error);
+            }
+        }
     }
 
     auto end_time = std::chrono::high_resolution_clock::now();
@@ -237,16 +438,19 @@ Json::Value TernaryFissionSimulationEngine::simulateTernaryFissionEventAPI(const
  * We provide comprehensive system status for monitoring
  */
 Json::Value TernaryFissionSimulationEngine::getSystemStatusAPI() const {
-    std::lock_guard<std::mutex> lock(state_mutex);
+    TF_TRACE_SCOPE("getSystemStatusAPI", "engine");
+    std::lock_guard<ProfiledMutex> lock(state_mutex);
 
     Json::Value status;
     status["simulation_running"] = simulation_state.simulation_running;
     status["continuous_mode_active"] = continuous_mode_active.load();
     status["total_events_simulated"] = static_cast<Json::UInt64>(total_events_simulated.load());
     status["total_energy_fields_created"] = static_cast<Json::UInt64>(total_energy_fields_created.load());
+    status["reset_epoch"] = static_cast<Json::UInt64>(reset_epoch_.load());
+    status["epoch_barrier"] = epoch_barrier_.statsToJson();
 
     {
-        std::lock_guard<std::mutex> time_lock(computation_time_mutex);
+        std::lock_guard<ProfiledMutex> time_lock(computation_time_mutex);
         status["total_computation_time_seconds"] = total_computation_time_seconds;
     }
 
@@ -261,7 +465,7 @@ Json::Value TernaryFissionSimulationEngine::getSystemStatusAPI() const {
     uint64_t total_events = total_events_simulated.load();
     double total_time = 0.0;
     {
-        std::lock_guard<std::mutex> time_lock(computation_time_mutex);
+        std::lock_guard<ProfiledMutex> time_lock(computation_time_mutex);
         total_time = total_computation_time_seconds;
     }
 
@@ -273,6 +477,8 @@ Json::Value TernaryFissionSimulationEngine::getSystemStatusAPI() const {
         status["average_microseconds_per_event"] = 0.0;
     }
 
+    status["phase_latency_us"] = Perf::phaseLatenciesToJson();
+
     status["api_requests_processed"] = static_cast<Json::UInt64>(api_request_counter_);
     status["json_serialization_enabled"] = json_serialization_enabled_;
 
@@ -290,7 +496,7 @@ Json::Value TernaryFissionSimulationEngine::getSystemStatusAPI() const {
  * We provide all active energy fields for monitoring
  */
 Json::Value TernaryFissionSimulationEngine::getEnergyFieldsAPI() const {
-    std::lock_guard<std::mutex> lock(state_mutex);
+    std::lock_guard<ProfiledMutex> lock(state_mutex);
 
     Json::Value response;
     Json::Value fields_array(Json::arrayValue);
@@ -307,6 +513,366 @@ Json::Value TernaryFissionSimulationEngine::getEnergyFieldsAPI() const {
     return response;
 }
 
+/*
+ * HTTP API: Get lock contention counters
+ * We expose per-mutex wait statistics for scaling analysis; counters are process-wide
+ * per lock name, so callers difference two snapshots
+ */
+Json::Value TernaryFissionSimulationEngine::getLockWaitStatisticsAPI() const {
+    auto waits = [](const ProfiledMutex& mutex) {
+        Json::Value json;
+        json["acquisitions"] = static_cast<Json::UInt64>(mutex.profile().acquisitions());
+        json["contended"] = static_cast<Json::UInt64>(mutex.profile().contended());
+        json["wait_ns"] = static_cast<Json::UInt64>(mutex.profile().waitNanoseconds());
+        return json;
+    };
+
+    Json::Value locks;
+    locks["state_mutex"] = waits(state_mutex);
+    locks["queue_mutex"] = waits(queue_mutex);
+    locks["computation_time_mutex"] = waits(computation_time_mutex);
+    locks["api_mutex"] = waits(api_mutex_);
+    return locks;
+}
+
+/*
+ * HTTP API: Get live object counts and field memory
+ * We expose what the engine retains so soak tests can detect growth
+ */
+Json::Value TernaryFissionSimulationEngine::getMemoryAccountingAPI() const {
+    std::lock_guard<ProfiledMutex> lock(state_mutex);
+
+    uint64_t field_bytes = 0;
+    uint64_t virtual_bytes = 0;
+    uint64_t materializing = 0;
+    for (const auto& field : simulation_state.active_energy_fields) {
+        if (field.state == FieldState::Materializing) {
+            materializing++;
+        } else if (field.memory_ptr) {
+            field_bytes += field.memory_bytes;
+        } else if (static_cast<FieldMemory::Backing>(field.memory_backing) == FieldMemory::Backing::Virtual) {
+            virtual_bytes += field.memory_bytes;
+        }
+    }
+
+    Json::Value accounting;
+    accounting["active_energy_fields"] = static_cast<Json::UInt64>(
+        simulation_state.active_energy_fields.size());
+    accounting["field_memory_bytes"] = static_cast<Json::UInt64>(field_bytes);
+    accounting["virtual_field_bytes"] = static_cast<Json::UInt64>(virtual_bytes);
+    accounting["materializing_fields"] = static_cast<Json::UInt64>(materializing);
+    accounting["fission_event_history"] = static_cast<Json::UInt64>(
+        simulation_state.fission_events.size());
+    accounting["event_history_limit"] = static_cast<Json::UInt64>(event_history_limit_);
+    return accounting;
+}
+
+/*
+ * Get measured field cycle totals
+ * We sum the per-field TSC accounting over live fields for capacity planning
+ */
+Json::Value TernaryFissionSimulationEngine::getFieldCyclesAPI() const {
+    std::lock_guard<ProfiledMutex> lock(state_mutex);
+
+    uint64_t allocation = 0;
+    uint64_t encryption = 0;
+    uint64_t dissipation = 0;
+    uint64_t burn = 0;
+    uint64_t allocation_faults = 0;
+    uint64_t fill_faults = 0;
+    uint64_t mapped_bytes = 0;
+    double energy_mev = 0.0;
+    for (const auto& field : simulation_state.active_energy_fields) {
+        allocation += field.allocation_cycles;
+        encryption += field.encryption_cycles;
+        dissipation += field.dissipation_cycles;
+        burn += field.burn_cycles;
+        allocation_faults += field.allocation_faults;
+        fill_faults += field.fill_faults;
+        mapped_bytes += field.memory_mapped_bytes;
+        energy_mev += field.energy_mev;
+    }
+    uint64_t total = allocation + encryption + dissipation + burn;
+
+    Json::Value cycles;
+    cycles["active_energy_fields"] = static_cast<Json::UInt64>(
+        simulation_state.active_energy_fields.size());
+    cycles["allocation_cycles"] = static_cast<Json::UInt64>(allocation);
+    cycles["encryption_cycles"] = static_cast<Json::UInt64>(encryption);
+    cycles["dissipation_cycles"] = static_cast<Json::UInt64>(dissipation);
+    cycles["burn_cycles"] = static_cast<Json::UInt64>(burn);
+    cycles["total_cycles"] = static_cast<Json::UInt64>(total);
+    cycles["total_microseconds"] = CycleClock::ticksToMicroseconds(total);
+    cycles["nominal_cycles"] = energy_mev * g_energy_field_config.cpu_cycles_per_mev;
+    cycles["cycles_per_mev"] = energy_mev > 0.0 ? static_cast<double>(total) / energy_mev : 0.0;
+    cycles["allocation_faults"] = static_cast<Json::UInt64>(allocation_faults);
+    cycles["fill_faults"] = static_cast<Json::UInt64>(fill_faults);
+    cycles["mapped_bytes"] = static_cast<Json::UInt64>(mapped_bytes);
+    return cycles;
+}
+
+/*
+ * Evict active energy fields to release backing memory
+ * We pick victims in policy order and compact the field list in one pass
+ */
+std::size_t TernaryFissionSimulationEngine::evictEnergyFields(std::size_t bytes_needed,
+                                                              Governor::Policy policy,
+                                                              std::size_t& fields_evicted) {
+    fields_evicted = 0;
+    std::lock_guard<ProfiledMutex> lock(state_mutex);
+    auto& fields = simulation_state.active_energy_fields;
+
+    std::vector<std::size_t> order;
+    order.reserve(fields.size());
+    for (std::size_t i = 0; i < fields.size(); ++i) {
+        if (fields[i].memory_ptr) {
+            order.push_back(i);
+        }
+    }
+    if (policy == Governor::Policy::EvictOldest) {
+        std::sort(order.begin(), order.end(), [&fields](std::size_t a, std::size_t b) {
+            return fields[a].creation_time < fields[b].creation_time;
+        });
+    } else {
+        std::sort(order.begin(), order.end(), [&fields](std::size_t a, std::size_t b) {
+            return fields[a].energy_mev < fields[b].energy_mev;
+        });
+    }
+
+    std::size_t released = 0;
+    std::vector<bool> evicted(fields.size(), false);
+    for (std::size_t index : order) {
+        if (released >= bytes_needed) {
+            break;
+        }
+        released += fields[index].memory_bytes;
+        releaseEnergyField(fields[index]);
+        evicted[index] = true;
+        fields_evicted++;
+    }
+
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < fields.size(); ++i) {
+        if (!evicted[i]) {
+            if (kept != i) {
+                fields[kept] = fields[i];
+            }
+            kept++;
+        }
+    }
+    fields.resize(kept);
+    return released;
+}
+
+/*
+ * Read a byte range of an active energy field
+ * We copy a virtual field's descriptor and regenerate its bytes without holding state_mutex
+ */
+bool TernaryFissionSimulationEngine::readEnergyFieldBytes(std::uint64_t field_id, std::size_t offset,
+                                                          std::size_t length, std::string& out) const {
+    EnergyField snapshot;
+    {
+        std::lock_guard<ProfiledMutex> lock(state_mutex);
+        const auto& fields = simulation_state.active_energy_fields;
+        auto it = std::find_if(fields.begin(), fields.end(), [field_id](const EnergyField& field) {
+            return field.field_id == field_id;
+        });
+        if (it == fields.end()) {
+            return false;
+        }
+        length = offset < it->memory_bytes ? std::min(length, it->memory_bytes - offset) : 0;
+        out.resize(length);
+        if (it->memory_ptr) {
+            TernaryFission::readEnergyFieldBytes(*it, offset, &out[0], length);
+            return true;
+        }
+        snapshot = *it;
+    }
+    out.resize(TernaryFission::readEnergyFieldBytes(snapshot, offset, &out[0], length));
+    return true;
+}
+
+/*
+ * Configure asynchronous field materialization
+ * We swap in a new pool; the old one finishes its queue when its last user drops it
+ */
+void TernaryFissionSimulationEngine::configureFieldFill(unsigned threads, std::size_t max_in_flight_bytes) {
+    std::shared_ptr<FieldFillPool> pool;
+    if (threads > 0) {
+        pool = std::make_shared<FieldFillPool>(threads, max_in_flight_bytes,
+                                               [this](EnergyField& field, bool rejected) {
+            completeFieldMaterialization(field, rejected);
+        });
+    }
+    std::atomic_exchange(&field_fill_pool_, pool);
+}
+
+void TernaryFissionSimulationEngine::drainFieldFill() {
+    std::shared_ptr<FieldFillPool> pool = std::atomic_load(&field_fill_pool_);
+    if (pool) {
+        pool->drain();
+    }
+}
+
+/*
+ * Get fill pool statistics
+ * We add the count of registered fields still waiting for memory
+ */
+Json::Value TernaryFissionSimulationEngine::getFieldFillAPI() const {
+    std::shared_ptr<FieldFillPool> pool = std::atomic_load(&field_fill_pool_);
+    Json::Value fill = pool ? pool->statsToJson() : Json::Value(Json::objectValue);
+    fill["enabled"] = pool != nullptr;
+
+    std::lock_guard<ProfiledMutex> lock(state_mutex);
+    fill["materializing_fields"] = static_cast<Json::UInt64>(std::count_if(
+        simulation_state.active_energy_fields.begin(), simulation_state.active_energy_fields.end(),
+        [](const EnergyField& field) { return field.state == FieldState::Materializing; }));
+    return fill;
+}
+
+std::string TernaryFissionSimulationEngine::getFieldFillPrometheus() const {
+    std::shared_ptr<FieldFillPool> pool = std::atomic_load(&field_fill_pool_);
+    return pool ? pool->toPrometheus() : std::string();
+}
+
+/*
+ * Configure time-sliced dissipation
+ * We keep the scheduler and its pending passes and only swap the settings
+ */
+void TernaryFissionSimulationEngine::configureDissipation(const DissipationScheduler::Settings& settings) {
+    dissipation_scheduler_->configure(settings);
+}
+
+void TernaryFissionSimulationEngine::drainDissipation() {
+    dissipation_scheduler_->drain();
+}
+
+Json::Value TernaryFissionSimulationEngine::getDissipationAPI() const {
+    return dissipation_scheduler_->statsToJson();
+}
+
+std::string TernaryFissionSimulationEngine::getDissipationPrometheus() const {
+    return dissipation_scheduler_->toPrometheus();
+}
+
+/*
+ * Apply one entropy slice for the dissipation scheduler
+ * We hold state_mutex for a single slice so other lock holders wait at most one slice
+ */
+bool TernaryFissionSimulationEngine::dissipateFieldSlice(std::uint64_t field_id, std::size_t offset,
+                                                         std::size_t length) {
+    std::lock_guard<ProfiledMutex> lock(state_mutex);
+    auto& fields = simulation_state.active_energy_fields;
+    auto it = std::find_if(fields.begin(), fields.end(), [field_id](const EnergyField& field) {
+        return field.field_id == field_id && field.state == FieldState::Active && field.memory_ptr;
+    });
+    if (it == fields.end()) {
+        return false;
+    }
+    dissipateEnergyFieldSlice(*it, offset, length);
+    return true;
+}
+
+/*
+ * Configure CPU budget burning
+ * We keep queued budgets across reconfiguration; the workers restart with the new settings
+ */
+void TernaryFissionSimulationEngine::configureCpuBurn(const CpuBurnExecutor::Settings& settings) {
+    cpu_burn_executor_->configure(settings);
+}
+
+void TernaryFissionSimulationEngine::drainCpuBurn() {
+    cpu_burn_executor_->drain();
+}
+
+Json::Value TernaryFissionSimulationEngine::getCpuBurnAPI() const {
+    return cpu_burn_executor_->statsToJson();
+}
+
+std::string TernaryFissionSimulationEngine::getCpuBurnPrometheus() const {
+    return cpu_burn_executor_->toPrometheus();
+}
+
+/*
+ * Configure fragment yields for the default parent
+ * We build the new registry before swapping it in, so a bad model leaves the old one serving
+ */
+void TernaryFissionSimulationEngine::configureFragmentYields(const FragmentYieldModel& model) {
+    std::shared_ptr<const NuclideRegistry> registry =
+        NuclideRegistry::build(kDefaultParentAtomicNumber, static_cast<int>(default_parent_mass), model);
+    std::atomic_store(&nuclides_, registry);
+}
+
+std::shared_ptr<const FragmentYields> TernaryFissionSimulationEngine::getFragmentYields() const {
+    const std::shared_ptr<const NuclideRegistry> registry = std::atomic_load(&nuclides_);
+    return registry ? registry->defaultNuclide().yields : nullptr;
+}
+
+std::shared_ptr<const NuclideRegistry> TernaryFissionSimulationEngine::getNuclideRegistry() const {
+    return std::atomic_load(&nuclides_);
+}
+
+void TernaryFissionSimulationEngine::submitFieldBurn(const EnergyField& field) {
+    if (!cpu_burn_executor_->enabled()) {
+        return;
+    }
+    cpu_burn_executor_->submit(field.field_id, field.energy_mev, static_cast<std::uint64_t>(
+        field.energy_mev * g_energy_field_config.cpu_cycles_per_mev));
+}
+
+/*
+ * Charge a burned unit to its field
+ * We count burn cycles in the field's measured total like the other phases
+ */
+bool TernaryFissionSimulationEngine::chargeFieldBurn(std::uint64_t field_id, std::uint64_t cycles) {
+    std::lock_guard<ProfiledMutex> lock(state_mutex);
+    auto& fields = simulation_state.active_energy_fields;
+    auto it = std::find_if(fields.begin(), fields.end(), [field_id](const EnergyField& field) {
+        return field.field_id == field_id;
+    });
+    if (it == fields.end()) {
+        return false;
+    }
+    it->burn_cycles += cycles;
+    it->cpu_cycles += cycles;
+    return true;
+}
+
+/*
+ * Install a field materialized by the fill pool
+ * We match on ID and state, since the field may have expired or been removed meanwhile
+ */
+void TernaryFissionSimulationEngine::completeFieldMaterialization(EnergyField& field, bool rejected) {
+    std::lock_guard<ProfiledMutex> lock(state_mutex);
+    auto& fields = simulation_state.active_energy_fields;
+    auto it = std::find_if(fields.begin(), fields.end(), [&field](const EnergyField& candidate) {
+        return candidate.field_id == field.field_id && candidate.state == FieldState::Materializing;
+    });
+    if (it == fields.end()) {
+        releaseEnergyField(field);
+        return;
+    }
+    if (rejected) {
+        // We drop the field but keep its event, as the synchronous path does
+        fields.erase(it);
+        return;
+    }
+    *it = field;
+    submitFieldBurn(field);
+}
+
+/*
+ * Limit retained fission event history
+ */
+void TernaryFissionSimulationEngine::setEventHistoryLimit(std::size_t max_events) {
+    std::lock_guard<ProfiledMutex> lock(state_mutex);
+    event_history_limit_ = max_events;
+    auto& history = simulation_state.fission_events;
+    if (history.size() > max_events) {
+        history.erase(history.begin(), history.end() - static_cast<std::ptrdiff_t>(max_events));
+    }
+}
+
 /*
  * HTTP API: Start continuous simulation
  * We provide HTTP control for continuous simulation mode
@@ -363,8 +929,9 @@ Json::Value TernaryFissionSimulationEngine::createEnergyFieldAPI(const Json::Val
     }
 
     try {
+        EpochBarrier::Scope epoch_scope(epoch_barrier_);
         EnergyField field = createEnergyField(energy_mev);
-        std::lock_guard<std::mutex> lock(state_mutex);
+        std::lock_guard<ProfiledMutex> lock(state_mutex);
         simulation_state.active_energy_fields.push_back(field);
         total_energy_fields_created.fetch_add(1, std::memory_order_relaxed);
 
@@ -407,6 +974,7 @@ Json::Value TernaryFissionSimulationEngine::serializeFissionEventToJSON(const Te
     auto time_since_epoch = event.timestamp.time_since_epoch();
     auto timestamp_ms = std::chrono::duration_cast<std::chrono::milliseconds>(time_since_epoch).count();
     json_event["timestamp_ms"] = static_cast<Json::Int64>(timestamp_ms);
+    json_event["nuclide"] = NuclideRegistry::symbolFor(event.parent_atomic_number, event.parent_mass_number);
 
     // Fragment data
     Json::Value heavy_fragment;
@@ -505,6 +1073,9 @@ Json::Value TernaryFissionSimulationEngine::serializeEnergyFieldToJSON(const Ene
     json_field["energy_mev"] = field.energy_mev;
     json_field["memory_bytes"] = static_cast<Json::UInt64>(field.memory_bytes);
     json_field["cpu_cycles"] = static_cast<Json::UInt64>(field.cpu_cycles);
+    json_field["measured_cycles"] = Perf::fieldCyclesToJson(field);
+    json_field["memory"] = FieldMemory::fieldMemoryToJson(field);
+    json_field["state"] = fieldStateName(field.state);
     json_field["entropy_factor"] = field.entropy_factor;
     json_field["creation_time_ms"] = static_cast<Json::Int64>(
         std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -544,12 +1115,16 @@ void TernaryFissionSimulationEngine::startContinuousSimulation(double events_per
     continuous_mode_active.store(true);
 
     {
-        std::lock_guard<std::mutex> lock(state_mutex);
+        std::lock_guard<ProfiledMutex> lock(state_mutex);
         simulation_state.simulation_running = true;
     }
 
     continuous_thread = std::thread(&TernaryFissionSimulationEngine::continuousGeneratorFunction, this);
 
+    // We tell the watchdog the rate change is intentional
+    Flight::resetWatchdogBaselines();
+    Flight::recordLog("engine", "continuous simulation started at " + std::to_string(events_per_second) + " events/sec");
+
     std::cout << "Continuous simulation started at " << events_per_second << " events/sec" << std::endl;
 }
 
@@ -565,7 +1140,7 @@ void TernaryFissionSimulationEngine::stopContinuousSimulation() {
     continuous_mode_active.store(false);
 
     {
-        std::lock_guard<std::mutex> lock(state_mutex);
+        std::lock_guard<ProfiledMutex> lock(state_mutex);
         simulation_state.simulation_running = false;
     }
 
@@ -573,54 +1148,205 @@ void TernaryFissionSimulationEngine::stopContinuousSimulation() {
         continuous_thread.join();
     }
 
+    Flight::resetWatchdogBaselines();
+    Flight::recordLog("engine", "continuous simulation stopped");
+
     std::cout << "Continuous simulation stopped" << std::endl;
 }
 
 /*
  * Start a timed portal load
- * We create an energy field and maintain it for the specified duration
+ * We hold the portal's own field IDs and let the timer wheel expire it; a portal started
+ * across a reset is dropped with its field, as events generated before one are
  */
-void TernaryFissionSimulationEngine::startPortalLoad(double duration_seconds, double power_level_mev) {
-    std::thread([this, duration_seconds, power_level_mev]() {
-        EnergyField field = createEnergyField(power_level_mev);
-        {
-            std::lock_guard<std::mutex> lock(state_mutex);
+std::uint64_t TernaryFissionSimulationEngine::startPortalLoad(double duration_seconds, double power_level_mev,
+                                                              double additional_power_mev) {
+    EpochBarrier::Scope epoch_scope(epoch_barrier_);
+    const std::uint64_t epoch = reset_epoch_.load(std::memory_order_acquire);
+    EnergyField field = createEnergyField(power_level_mev + additional_power_mev);
+
+    PortalLoad portal;
+    portal.field_ids.push_back(field.field_id);
+    portal.duration_seconds = duration_seconds;
+    portal.power_level_mev = power_level_mev;
+    portal.additional_power_mev = additional_power_mev;
+    portal.start = std::chrono::system_clock::now();
+    portal.steady_start = std::chrono::steady_clock::now();
+    const double scheduled_seconds = portalDurationSeconds(portal);
+    portal.deadline = portal.steady_start + std::chrono::milliseconds(
+        static_cast<int64_t>(scheduled_seconds * 1000.0));
+
+    {
+        // We publish the field and the portal together, under the locks reset() holds to advance the epoch
+        std::lock_guard<ProfiledMutex> lock(portal_mutex_);
+        std::lock_guard<ProfiledMutex> state_lock(state_mutex);
+        if (epoch == reset_epoch_.load(std::memory_order_relaxed)) {
             simulation_state.active_energy_fields.push_back(field);
+            const std::uint64_t portal_id = next_portal_id_++;
+            portal_loads_.emplace(portal_id, std::move(portal));
+            portal_timers_->schedule(portal_id,
+                                     std::chrono::milliseconds(static_cast<int64_t>(scheduled_seconds * 1000.0)));
+            return portal_id;
         }
+    }
+    releaseEnergyField(field);
+    return 0;
+}
 
-        std::this_thread::sleep_for(
-            std::chrono::milliseconds(static_cast<int64_t>(duration_seconds * 1000.0))
-        );
+/*
+ * Extend an active portal load
+ * We create the extra field before taking the portal lock and drop it if the portal ended or a
+ * reset ran meanwhile; a governor rejection propagates so callers can tell it from an unknown portal
+ */
+bool TernaryFissionSimulationEngine::extendPortalLoad(std::uint64_t portal_id, double additional_power_mev) {
+    EpochBarrier::Scope epoch_scope(epoch_barrier_);
+    const std::uint64_t epoch = reset_epoch_.load(std::memory_order_acquire);
+    {
+        std::lock_guard<ProfiledMutex> lock(portal_mutex_);
+        if (portal_loads_.count(portal_id) == 0) {
+            return false;
+        }
+    }
 
-        {
-            std::lock_guard<std::mutex> lock(state_mutex);
-            if (!simulation_state.active_energy_fields.empty()) {
-                simulation_state.active_energy_fields.pop_back();
-            }
+    EnergyField field = createEnergyField(additional_power_mev);
+
+    {
+        std::lock_guard<ProfiledMutex> lock(portal_mutex_);
+        std::lock_guard<ProfiledMutex> state_lock(state_mutex);
+        auto it = portal_loads_.find(portal_id);
+        if (it != portal_loads_.end() && epoch == reset_epoch_.load(std::memory_order_relaxed)) {
+            simulation_state.active_energy_fields.push_back(field);
+            PortalLoad& portal = it->second;
+            portal.field_ids.push_back(field.field_id);
+            portal.additional_power_mev += additional_power_mev;
+            portal.deadline = portal.steady_start + std::chrono::milliseconds(
+                static_cast<int64_t>(portalDurationSeconds(portal) * 1000.0));
+            // We round up so the wheel never fires before the deadline
+            const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(
+                portal.deadline - std::chrono::steady_clock::now());
+            portal_timers_->schedule(portal_id, std::max(remaining, std::chrono::milliseconds(0)));
+            return true;
+        }
+    }
+    releaseEnergyField(field);
+    return false;
+}
+
+/*
+ * Cancel an active portal load
+ */
+bool TernaryFissionSimulationEngine::cancelPortalLoad(std::uint64_t portal_id) {
+    std::vector<std::uint64_t> field_ids;
+    {
+        std::lock_guard<ProfiledMutex> lock(portal_mutex_);
+        auto it = portal_loads_.find(portal_id);
+        if (it == portal_loads_.end()) {
+            return false;
         }
-    }).detach();
+        field_ids = std::move(it->second.field_ids);
+        portal_loads_.erase(it);
+        portal_timers_->cancel(portal_id);
+    }
+    removeEnergyFields(field_ids);
+    return true;
+}
+
+void TernaryFissionSimulationEngine::expirePortalLoad(std::uint64_t portal_id) {
+    std::vector<std::uint64_t> field_ids;
+    {
+        std::lock_guard<ProfiledMutex> lock(portal_mutex_);
+        auto it = portal_loads_.find(portal_id);
+        if (it == portal_loads_.end()) {
+            return;
+        }
+        // We re-arm a timer that fired before the deadline instead of leaving the portal unexpired
+        const auto remaining = it->second.deadline - std::chrono::steady_clock::now();
+        if (remaining > std::chrono::steady_clock::duration::zero()) {
+            portal_timers_->schedule(portal_id, std::chrono::ceil<std::chrono::milliseconds>(remaining));
+            return;
+        }
+        field_ids = std::move(it->second.field_ids);
+        portal_loads_.erase(it);
+    }
+    removeEnergyFields(field_ids);
 }
 
-void TernaryFissionSimulationEngine::setPortalEventState(
-    std::chrono::system_clock::time_point start,
-    std::chrono::system_clock::time_point end,
-    double estimated_power_mev) {
-    std::lock_guard<std::mutex> lock(state_mutex);
-    portal_start_time_ = start;
-    portal_end_time_ = end;
-    portal_estimated_power_mev_ = estimated_power_mev;
+double TernaryFissionSimulationEngine::portalDurationSeconds(const PortalLoad& portal) {
+    double duration = portal.duration_seconds;
+    if (portal.power_level_mev > 0.0 && portal.additional_power_mev > 0.0) {
+        duration *= 1.0 + portal.additional_power_mev / portal.power_level_mev;
+    }
+    return duration;
+}
+
+/*
+ * Remove fields by ID
+ * We compact the field list in one pass; fields already gone are skipped
+ */
+void TernaryFissionSimulationEngine::removeEnergyFields(const std::vector<std::uint64_t>& field_ids) {
+    std::lock_guard<ProfiledMutex> lock(state_mutex);
+    auto& fields = simulation_state.active_energy_fields;
+    auto removed = std::remove_if(fields.begin(), fields.end(), [&field_ids](EnergyField& field) {
+        if (std::find(field_ids.begin(), field_ids.end(), field.field_id) == field_ids.end()) {
+            return false;
+        }
+        releaseEnergyField(field);
+        return true;
+    });
+    fields.erase(removed, fields.end());
+}
+
+/*
+ * List active portal loads
+ */
+Json::Value TernaryFissionSimulationEngine::getPortalLoadsAPI() const {
+    Json::Value response;
+    Json::Value portals(Json::arrayValue);
+    const auto now = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<ProfiledMutex> lock(portal_mutex_);
+        for (const auto& entry : portal_loads_) {
+            const PortalLoad& portal = entry.second;
+            Json::Value json_portal;
+            json_portal["portal_id"] = static_cast<Json::UInt64>(entry.first);
+            json_portal["power_level_mev"] = portal.power_level_mev;
+            json_portal["additional_power_mev"] = portal.additional_power_mev;
+            json_portal["total_power_mev"] = portal.power_level_mev + portal.additional_power_mev;
+            json_portal["estimated_power_mev"] = calculateEstimatedPower(
+                portal.power_level_mev, static_cast<int>(portal.duration_seconds), portal.additional_power_mev);
+            json_portal["scheduled_duration_seconds"] = portalDurationSeconds(portal);
+            json_portal["remaining_seconds"] = std::max(0.0,
+                std::chrono::duration<double>(portal.deadline - now).count());
+            json_portal["started_at_ms"] = static_cast<Json::Int64>(
+                std::chrono::duration_cast<std::chrono::milliseconds>(portal.start.time_since_epoch()).count());
+            Json::Value field_ids(Json::arrayValue);
+            for (std::uint64_t field_id : portal.field_ids) {
+                field_ids.append(static_cast<Json::UInt64>(field_id));
+            }
+            json_portal["field_ids"] = field_ids;
+            portals.append(json_portal);
+        }
+    }
+    response["active_portals"] = portals.size();
+    response["portals"] = portals;
+    response["timers"] = portal_timers_->statsToJson();
+    return response;
 }
 
 void TernaryFissionSimulationEngine::getPortalEventState(
     double& estimated_power_mev, int& remaining_seconds) const {
-    std::lock_guard<std::mutex> lock(state_mutex);
-    estimated_power_mev = portal_estimated_power_mev_;
-    auto now = std::chrono::system_clock::now();
-    if (now >= portal_end_time_) {
-        remaining_seconds = 0;
-    } else {
-        remaining_seconds = static_cast<int>(
-            std::chrono::duration_cast<std::chrono::seconds>(portal_end_time_ - now).count());
+    estimated_power_mev = 0.0;
+    remaining_seconds = 0;
+    const auto now = std::chrono::steady_clock::now();
+    std::lock_guard<ProfiledMutex> lock(portal_mutex_);
+    for (const auto& entry : portal_loads_) {
+        const PortalLoad& portal = entry.second;
+        estimated_power_mev += calculateEstimatedPower(
+            portal.power_level_mev, static_cast<int>(portal.duration_seconds), portal.additional_power_mev);
+        if (portal.deadline > now) {
+            remaining_seconds = std::max(remaining_seconds, static_cast<int>(
+                std::chrono::duration_cast<std::chrono::seconds>(portal.deadline - now).count()));
+        }
     }
 }
 
@@ -642,7 +1368,7 @@ uint64_t TernaryFissionSimulationEngine::getTotalEnergyFieldsCreated() const {
  * Get total computation time
  */
 double TernaryFissionSimulationEngine::getTotalComputationTimeSeconds() const {
-    std::lock_guard<std::mutex> lock(computation_time_mutex);
+    std::lock_guard<ProfiledMutex> lock(computation_time_mutex);
     return total_computation_time_seconds;
 }
 
@@ -650,7 +1376,7 @@ double TernaryFissionSimulationEngine::getTotalComputationTimeSeconds() const {
  * Print system status
  */
 void TernaryFissionSimulationEngine::printSystemStatus() const {
-    std::lock_guard<std::mutex> lock(state_mutex);
+    std::lock_guard<ProfiledMutex> lock(state_mutex);
 
     std::cout << "\n=== System Status ===" << std::endl;
     std::cout << "Simulation Running: " << (simulation_state.simulation_running ? "Yes" : "No") << std::endl;
@@ -685,9 +1411,30 @@ void TernaryFissionSimulationEngine::shutdown() {
         }
     }
 
+    // We let the fill pool finish so no completion runs against cleared state
+    std::shared_ptr<FieldFillPool> fill_pool =
+        std::atomic_exchange(&field_fill_pool_, std::shared_ptr<FieldFillPool>());
+    if (fill_pool) {
+        fill_pool->drain();
+    }
+
+    // We stop slicing before the fields it slices are released; pending passes are dropped
+    dissipation_scheduler_->stop();
+    cpu_burn_executor_->stop();
+
+    // We discard portal timers; their fields are released with the rest below
+    portal_timers_->stop();
+    {
+        std::lock_guard<ProfiledMutex> lock(portal_mutex_);
+        portal_loads_.clear();
+    }
+
     // Clear remaining data
     {
-        std::lock_guard<std::mutex> lock(state_mutex);
+        std::lock_guard<ProfiledMutex> lock(state_mutex);
+        for (auto& field : simulation_state.active_energy_fields) {
+            releaseEnergyField(field);
+        }
         simulation_state.active_energy_fields.clear();
         simulation_state.fission_events.clear();
     }
@@ -698,12 +1445,142 @@ void TernaryFissionSimulationEngine::shutdown() {
     std::cout << "Simulation engine shutdown complete" << std::endl;
 }
 
+/*
+ * Reset the engine in place
+ * We wait behind the epoch barrier for callers already in the epoch, then hold each lock
+ * only for a swap or a queue clear; fields are released after the barrier reopens and
+ * workers, pools and physics utilities stay warm
+ */
+Json::Value TernaryFissionSimulationEngine::reset() {
+    TF_TRACE_SCOPE("reset", "engine");
+    const auto start_time = std::chrono::steady_clock::now();
+
+    stopContinuousSimulation();
+
+    std::size_t events_discarded = 0;
+    std::vector<EnergyField> fields;
+    std::deque<TernaryFissionEvent> history;
+    std::size_t portals_cancelled = 0;
+    std::uint64_t epoch = 0;
+    std::size_t fills_discarded = 0;
+    std::size_t dissipation_passes_dropped = 0;
+    std::size_t burn_budgets_cancelled = 0;
+
+    // We swap state with no worker or API caller inside the epoch; new callers wait for us
+    const double barrier_wait_us = epoch_barrier_.quiesce([&] {
+        {
+            std::lock_guard<ProfiledMutex> lock(queue_mutex);
+            events_discarded = event_queue.size();
+            std::queue<QueuedFissionEvent>().swap(event_queue);
+        }
+
+        {
+            // We take portal_mutex_ before state_mutex, as startPortalLoad does
+            std::lock_guard<ProfiledMutex> portal_lock(portal_mutex_);
+            portals_cancelled = portal_loads_.size();
+            portal_loads_.clear();
+            portal_timers_->clear();
+
+            std::lock_guard<ProfiledMutex> lock(state_mutex);
+            epoch = reset_epoch_.fetch_add(1, std::memory_order_acq_rel) + 1;
+            fields.swap(simulation_state.active_energy_fields);
+            history.swap(simulation_state.fission_events);
+            simulation_state.total_energy_simulated = 0.0;
+            simulation_state.total_fission_events = 0;
+            simulation_state.peak_memory_usage = 0;
+            simulation_state.simulation_running = false;
+        }
+
+        // We drop pool backlogs; pool work already running finds its field gone and lets it go
+        std::shared_ptr<FieldFillPool> fill_pool = std::atomic_load(&field_fill_pool_);
+        if (fill_pool) {
+            fills_discarded = fill_pool->clear();
+        }
+        dissipation_passes_dropped = dissipation_scheduler_->clear();
+        burn_budgets_cancelled = cpu_burn_executor_->clear();
+
+        total_events_simulated.store(0, std::memory_order_relaxed);
+        total_energy_fields_created.store(0, std::memory_order_relaxed);
+        {
+            std::lock_guard<ProfiledMutex> lock(computation_time_mutex);
+            total_computation_time_seconds = 0.0;
+        }
+    });
+
+    // We unmap field memory last; its cost grows with field count, not with the barrier
+    const auto release_start = std::chrono::steady_clock::now();
+    for (auto& field : fields) {
+        releaseEnergyField(field);
+    }
+    const auto end_time = std::chrono::steady_clock::now();
+    const double reset_us = std::chrono::duration<double, std::micro>(release_start - start_time).count();
+    const double release_us = std::chrono::duration<double, std::micro>(end_time - release_start).count();
+
+    Flight::resetWatchdogBaselines();
+    Flight::recordLog("engine", "engine reset to epoch " + std::to_string(epoch));
+
+    Json::Value summary;
+    summary["reset_epoch"] = static_cast<Json::UInt64>(epoch);
+    summary["fields_released"] = static_cast<Json::UInt64>(fields.size());
+    summary["events_cleared"] = static_cast<Json::UInt64>(history.size());
+    summary["queued_events_discarded"] = static_cast<Json::UInt64>(events_discarded);
+    summary["portals_cancelled"] = static_cast<Json::UInt64>(portals_cancelled);
+    summary["field_fills_discarded"] = static_cast<Json::UInt64>(fills_discarded);
+    summary["dissipation_passes_dropped"] = static_cast<Json::UInt64>(dissipation_passes_dropped);
+    summary["burn_budgets_cancelled"] = static_cast<Json::UInt64>(burn_budgets_cancelled);
+    summary["barrier_wait_us"] = barrier_wait_us;
+    summary["reset_time_us"] = reset_us;
+    summary["release_time_us"] = release_us;
+    return summary;
+}
+
 /*
  * Generate a ternary fission event (private method)
  * We create realistic fission events with proper physics
  */
 TernaryFissionEvent TernaryFissionSimulationEngine::generateFissionEvent(double parent_mass,
                                                                         double excitation_energy) {
+    Vector3 heavy_direction;
+    Sampling::direction(Sampling::threadSampler().scalar, heavy_direction.x, heavy_direction.y,
+                        heavy_direction.z);
+    return generateFissionEvent(parent_mass, excitation_energy, heavy_direction);
+}
+
+/*
+ * Generate a fission event along a given heavy fragment direction
+ * We take the direction from the caller so batches can draw them in bulk
+ */
+TernaryFissionEvent TernaryFissionSimulationEngine::generateFissionEvent(double parent_mass,
+                                                                        double excitation_energy,
+                                                                        const Vector3& heavy_direction) {
+    const std::shared_ptr<const NuclideRegistry> registry = std::atomic_load(&nuclides_);
+    const Nuclide* nuclide =
+        registry ? registry->findByMassNumber(static_cast<int>(parent_mass)) : nullptr;
+    return generateFissionEvent(parent_mass, excitation_energy, heavy_direction, nuclide);
+}
+
+/*
+ * Generate a fission event of a registered parent
+ */
+TernaryFissionEvent TernaryFissionSimulationEngine::generateFissionEvent(const Nuclide& nuclide,
+                                                                        double excitation_energy) {
+    Vector3 heavy_direction;
+    Sampling::direction(Sampling::threadSampler().scalar, heavy_direction.x, heavy_direction.y,
+                        heavy_direction.z);
+    return generateFissionEvent(nuclide.mass, excitation_energy, heavy_direction, &nuclide);
+}
+
+/*
+ * Generate a fission event with fragments from the parent's yields
+ * We sample the fragment pair in O(1) from the nuclide's alias table
+ */
+TernaryFissionEvent TernaryFissionSimulationEngine::generateFissionEvent(double parent_mass,
+                                                                        double excitation_energy,
+                                                                        const Vector3& heavy_direction,
+                                                                        const Nuclide* nuclide) {
+    TF_TRACE_SCOPE("generateFissionEvent", "engine");
+    TF_ALLOC_SCOPE("engine.generate");
+    Perf::PhaseScope phase(Perf::Phase::Generate);
     TernaryFissionEvent event;
     event.timestamp = std::chrono::high_resolution_clock::now();
 
@@ -711,39 +1588,75 @@ TernaryFissionEvent TernaryFissionSimulationEngine::generateFissionEvent(double
     event.event_id = event_id_counter.fetch_add(1, std::memory_order_relaxed);
     event.energy_field_id = generateFieldId();
 
-    // Parent nucleus properties (U-235 defaults)
-    const int parent_atomic_number = 92;
-    const int parent_mass_number = static_cast<int>(parent_mass);
+    // Parent nucleus properties; a mass no registered parent has gets the default element
+    const int parent_atomic_number = nuclide ? nuclide->atomic_number : kDefaultParentAtomicNumber;
+    const int parent_mass_number = nuclide ? nuclide->mass_number : static_cast<int>(parent_mass);
+    event.parent_atomic_number = parent_atomic_number;
+    event.parent_mass_number = parent_mass_number;
 
     // Total mass available for fragments
     double total_fragment_mass = parent_mass;
 
-    // Generate fragment masses using empirical distributions
-    double mass_ratio = normalRandom(1.4, 0.15);
-
     // Alpha particle
     event.alpha_particle.mass = ALPHA_PARTICLE_MASS;
     event.alpha_particle.atomic_number = 2;
     event.alpha_particle.mass_number = 4;
     event.alpha_particle.half_life = 1e100;  // Stable
 
-    // Split remaining mass
+    const NuclearMassTable& masses = NuclearMassTable::instance();
+    event.alpha_particle.binding_energy = masses.at(2, 4).binding_energy;
+
     double remaining_mass = total_fragment_mass - ALPHA_PARTICLE_MASS;
-    event.light_fragment.mass = remaining_mass / (1 + mass_ratio);
-    event.heavy_fragment.mass = remaining_mass - event.light_fragment.mass;
+    bool tabulated_q_value = false;
+    if (nuclide && nuclide->yields) {
+        // Fragment pair from the yield table: one draw, one column lookup
+        const FragmentPair& pair = nuclide->yields->sample(Sampling::threadSampler().scalar());
+        event.light_fragment.mass_number = pair.light_mass_number;
+        event.light_fragment.atomic_number = pair.light_atomic_number;
+        event.heavy_fragment.mass_number = pair.heavy_mass_number;
+        event.heavy_fragment.atomic_number = pair.heavy_atomic_number;
+
+        // Atomic masses and Q-value from the mass table: one load per fragment. The split
+        // conserves Z and N, so Q is the gain in binding energy; the registry holds the
+        // parent and alpha terms
+        const NuclearMass& light = masses.at(pair.light_atomic_number, pair.light_mass_number);
+        const NuclearMass& heavy = masses.at(pair.heavy_atomic_number, pair.heavy_mass_number);
+        event.light_fragment.mass = pair.light_mass_number + light.mass_excess / AMU_TO_MEV;
+        event.heavy_fragment.mass = pair.heavy_mass_number + heavy.mass_excess / AMU_TO_MEV;
+        event.q_value = excitation_energy + light.binding_energy + heavy.binding_energy + nuclide->q_value_offset;
+        tabulated_q_value = true;
+    } else {
+        // Generate fragment masses using empirical distributions
+        double mass_ratio = normalRandom(1.4, 0.15);
+
+        // Split remaining mass
+        event.light_fragment.mass = remaining_mass / (1 + mass_ratio);
+        event.heavy_fragment.mass = remaining_mass - event.light_fragment.mass;
 
-    // Estimate atomic numbers (proportional to mass)
-    double z_ratio = static_cast<double>(parent_atomic_number - 2) / remaining_mass;
-    event.light_fragment.atomic_number = static_cast<int>(event.light_fragment.mass * z_ratio);
-    event.heavy_fragment.atomic_number = parent_atomic_number - 2 - event.light_fragment.atomic_number;
+        // Estimate atomic numbers (proportional to mass)
+        double z_ratio = static_cast<double>(parent_atomic_number - 2) / remaining_mass;
+        event.light_fragment.atomic_number = static_cast<int>(event.light_fragment.mass * z_ratio);
+        event.heavy_fragment.atomic_number = parent_atomic_number - 2 - event.light_fragment.atomic_number;
 
-    // Mass numbers (approximately equal to mass)
-    event.light_fragment.mass_number = static_cast<int>(event.light_fragment.mass + 0.5);
-    event.heavy_fragment.mass_number = static_cast<int>(event.heavy_fragment.mass + 0.5);
+        // Mass numbers (approximately equal to mass)
+        event.light_fragment.mass_number = static_cast<int>(event.light_fragment.mass + 0.5);
+        event.heavy_fragment.mass_number = static_cast<int>(event.heavy_fragment.mass + 0.5);
+    }
+
+    if (NuclearMassTable::covers(event.light_fragment.atomic_number, event.light_fragment.mass_number)) {
+        event.light_fragment.binding_energy =
+            masses.at(event.light_fragment.atomic_number, event.light_fragment.mass_number).binding_energy;
+    }
+    if (NuclearMassTable::covers(event.heavy_fragment.atomic_number, event.heavy_fragment.mass_number)) {
+        event.heavy_fragment.binding_energy =
+            masses.at(event.heavy_fragment.atomic_number, event.heavy_fragment.mass_number).binding_energy;
+    }
 
-    // Calculate Q-value (simplified)
-    event.q_value = excitation_energy + (parent_mass - event.heavy_fragment.mass -
-                    event.light_fragment.mass - event.alpha_particle.mass) * 931.5;  // MeV
+    if (!tabulated_q_value) {
+        // Calculate Q-value (simplified) when the table does not cover the split
+        event.q_value = excitation_energy + (parent_mass - event.heavy_fragment.mass -
+                        event.light_fragment.mass - event.alpha_particle.mass) * 931.5;  // MeV
+    }
 
     // Distribute kinetic energy among fragments
     double total_ke = event.q_value;
@@ -763,13 +1676,11 @@ TernaryFissionEvent TernaryFissionSimulationEngine::generateFissionEvent(double
                                 event.heavy_fragment.kinetic_energy;
     event.binding_energy_released = event.q_value - event.total_kinetic_energy;
 
-    // Generate random momentum directions (conservation will be applied)
-    generateRandomMomentum(event.alpha_particle);
-    generateRandomMomentum(event.light_fragment);
-    generateRandomMomentum(event.heavy_fragment);
-
-    // Apply conservation laws
-    applyConservationLaws(event);
+    // Apply conservation laws; they assign all three momenta from the heavy direction
+    {
+        Perf::PhaseScope conservation(Perf::Phase::Conservation);
+        applyConservationLaws(event, heavy_direction);
+    }
 
     // Calculate conservation errors
     event.energy_conservation_error = std::abs(event.q_value - event.total_kinetic_energy);
@@ -788,30 +1699,167 @@ TernaryFissionEvent TernaryFissionSimulationEngine::generateFissionEvent(double
     return event;
 }
 
+/*
+ * Draw heavy fragment directions for a batch
+ * We fill a 256-direction chunk on the stack per pass, so no batch overload allocates
+ */
+template <typename SampleFn>
+void TernaryFissionSimulationEngine::sampleHeavyDirections(std::size_t count, SampleFn&& sample) {
+    constexpr std::size_t kDirectionChunk = 256;
+    double x[kDirectionChunk];
+    double y[kDirectionChunk];
+    double z[kDirectionChunk];
+    for (std::size_t base = 0; base < count; base += kDirectionChunk) {
+        const std::size_t chunk = std::min(kDirectionChunk, count - base);
+        Sampling::fillDirections(x, y, z, chunk);
+        for (std::size_t i = 0; i < chunk; ++i) {
+            Vector3 heavy_direction;
+            heavy_direction.x = x[i];
+            heavy_direction.y = y[i];
+            heavy_direction.z = z[i];
+            sample(base + i, heavy_direction);
+        }
+    }
+}
+
+/*
+ * Generate a batch of events into caller-owned storage
+ * We write each event in place so the batch itself never allocates
+ */
+std::size_t TernaryFissionSimulationEngine::generateFissionEvents(TernaryFissionEvent* events,
+                                                                  std::size_t count,
+                                                                  double parent_mass,
+                                                                  double excitation_energy) {
+    if (!events) {
+        return 0;
+    }
+    const std::shared_ptr<const NuclideRegistry> registry = std::atomic_load(&nuclides_);
+    const Nuclide* nuclide =
+        registry ? registry->findByMassNumber(static_cast<int>(parent_mass)) : nullptr;
+    sampleHeavyDirections(count, [&](std::size_t i, const Vector3& heavy_direction) {
+        events[i] = generateFissionEvent(parent_mass, excitation_energy, heavy_direction, nuclide);
+    });
+    return count;
+}
+
+/*
+ * Generate a batch of one registered parent into caller-owned storage
+ */
+std::size_t TernaryFissionSimulationEngine::generateFissionEvents(TernaryFissionEvent* events,
+                                                                  std::size_t count,
+                                                                  const Nuclide& nuclide,
+                                                                  double excitation_energy) {
+    if (!events) {
+        return 0;
+    }
+    sampleHeavyDirections(count, [&](std::size_t i, const Vector3& heavy_direction) {
+        events[i] = generateFissionEvent(nuclide.mass, excitation_energy, heavy_direction, &nuclide);
+    });
+    return count;
+}
+
+/*
+ * Generate a batch that mixes registered parents
+ * We run one nuclide's events at a time, so the kernel sees a single parent per pass; a cursor
+ * walks parents to the next slot of that nuclide and the batch itself never allocates
+ */
+std::size_t TernaryFissionSimulationEngine::generateFissionEvents(TernaryFissionEvent* events,
+                                                                  const std::size_t* parents,
+                                                                  std::size_t count,
+                                                                  const NuclideRegistry& registry,
+                                                                  double excitation_energy) {
+    if (!events || !parents) {
+        return 0;
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        if (parents[i] >= registry.size()) {
+            throw std::out_of_range("nuclide index " + std::to_string(parents[i]) + " is outside the registry");
+        }
+    }
+    for (std::size_t index = 0; index < registry.size(); ++index) {
+        const Nuclide& nuclide = registry.at(index);
+        const std::size_t matching =
+            static_cast<std::size_t>(std::count(parents, parents + count, index));
+        std::size_t cursor = 0;
+        sampleHeavyDirections(matching, [&](std::size_t, const Vector3& heavy_direction) {
+            while (parents[cursor] != index) {
+                ++cursor;
+            }
+            events[cursor++] = generateFissionEvent(nuclide.mass, excitation_energy, heavy_direction, &nuclide);
+        });
+    }
+    return count;
+}
+
 /*
  * Process a fission event (private method)
  * We handle event processing and energy field creation
  */
-void TernaryFissionSimulationEngine::processFissionEvent(const TernaryFissionEvent& event) {
-    // Create energy field based on event
+bool TernaryFissionSimulationEngine::processFissionEvent(const TernaryFissionEvent& event, std::uint64_t epoch) {
+    TF_TRACE_SCOPE("processFissionEvent", "engine");
+    TF_ALLOC_SCOPE("engine.process");
+    Perf::PhaseScope phase(Perf::Phase::Process);
+    const std::uint64_t lock_wait_start = threadLockWaitTicks();
+    bool committed = true;
+    // Create energy field based on event; with a fill pool we only register it here
     try {
-        EnergyField energy_field = createEnergyField(event.total_kinetic_energy);
+        std::shared_ptr<FieldFillPool> fill_pool = std::atomic_load(&field_fill_pool_);
+        const bool deferred = fill_pool && !g_energy_field_config.virtual_fields;
+        EnergyField energy_field = deferred ? describeEnergyField(event.total_kinetic_energy)
+                                            : createEnergyField(event.total_kinetic_energy);
         energy_field.field_id = event.energy_field_id;
+        if (deferred) {
+            energy_field.state = FieldState::Materializing;
+        }
 
         {
-            std::lock_guard<std::mutex> lock(state_mutex);
-            simulation_state.active_energy_fields.push_back(energy_field);
-            simulation_state.fission_events.push_back(event);
+            std::lock_guard<ProfiledMutex> lock(state_mutex);
+            // We drop events generated before a reset; reset() advances the epoch under this lock
+            committed = epoch == reset_epoch_.load(std::memory_order_relaxed);
+            if (committed) {
+                simulation_state.active_energy_fields.push_back(energy_field);
+                simulation_state.fission_events.push_back(event);
+                total_energy_fields_created.fetch_add(1, std::memory_order_relaxed);
+
+                // We keep history as a bounded FIFO so memory stays flat
+                auto& history = simulation_state.fission_events;
+                while (history.size() > event_history_limit_) {
+                    history.pop_front();
+                }
+            }
         }
 
-        total_energy_fields_created.fetch_add(1, std::memory_order_relaxed);
+        if (!committed) {
+            releaseEnergyField(energy_field);
+        } else if (deferred) {
+            fill_pool->submit(energy_field);
+        } else {
+            submitFieldBurn(energy_field);
+        }
 
-        // Log event if requested
-        logFissionEvent(event);
+        if (committed) {
+            // Log event if requested
+            logFissionEvent(event);
+        }
 
+    } catch (const Governor::MemoryBudgetExceeded&) {
+        // We keep the event but not its field; the governor counts the rejection
+        std::lock_guard<ProfiledMutex> lock(state_mutex);
+        committed = epoch == reset_epoch_.load(std::memory_order_relaxed);
+        if (committed) {
+            auto& history = simulation_state.fission_events;
+            history.push_back(event);
+            while (history.size() > event_history_limit_) {
+                history.pop_front();
+            }
+        }
     } catch (const std::exception& e) {
         std::cerr << "Error processing fission event: " << e.what() << std::endl;
     }
+
+    // We record every event, including zero waits, so the percentiles are per event
+    Perf::recordPhase(Perf::Phase::LockWait, threadLockWaitTicks() - lock_wait_start, nullptr);
+    return committed;
 }
 
 /*
@@ -822,26 +1870,34 @@ void TernaryFissionSimulationEngine::workerThreadFunction(int thread_id) {
     (void)thread_id;
 
     while (!shutdown_requested.load()) {
-        std::unique_lock<std::mutex> lock(queue_mutex);
-
-        queue_cv.wait(lock, [this] {
-            return !event_queue.empty() || shutdown_requested.load();
-        });
+        {
+            std::unique_lock<ProfiledMutex> lock(queue_mutex);
+            queue_cv.wait(lock, [this] {
+                return !event_queue.empty() || shutdown_requested.load();
+            });
+        }
 
         if (shutdown_requested.load()) {
             break;
         }
 
+        // We join the epoch before popping so a reset waits for the event we take
+        EpochBarrier::Scope epoch_scope(epoch_barrier_);
+        std::unique_lock<ProfiledMutex> lock(queue_mutex);
         if (event_queue.empty()) {
             continue;
         }
 
-        TernaryFissionEvent event = event_queue.front();
+        TernaryFissionEvent event = event_queue.front().event;
+        std::uint64_t queued_ticks = event_queue.front().queued_ticks;
+        std::uint64_t epoch = event_queue.front().epoch;
         event_queue.pop();
         lock.unlock();
 
+        Perf::recordPhase(Perf::Phase::QueueWait, CycleClock::now() - queued_ticks, nullptr);
+
         // Process the event
-        processFissionEvent(event);
+        processFissionEvent(event, epoch);
     }
 }
 
@@ -851,6 +1907,7 @@ void TernaryFissionSimulationEngine::workerThreadFunction(int thread_id) {
  */
 void TernaryFissionSimulationEngine::continuousGeneratorFunction() {
     auto last_event_time = std::chrono::high_resolution_clock::now();
+    auto last_field_update = last_event_time;
     double target_rate = target_events_per_second.load();
     auto target_interval = std::chrono::microseconds(static_cast<long>(1e6 / target_rate));
 
@@ -859,11 +1916,13 @@ void TernaryFissionSimulationEngine::continuousGeneratorFunction() {
 
         if (now - last_event_time >= target_interval) {
             // Generate and queue event
-            TernaryFissionEvent event = generateFissionEvent(default_parent_mass, default_excitation_energy);
-
             {
-                std::lock_guard<std::mutex> lock(queue_mutex);
-                event_queue.push(event);
+                EpochBarrier::Scope epoch_scope(epoch_barrier_);
+                const std::uint64_t epoch = reset_epoch_.load(std::memory_order_acquire);
+                TernaryFissionEvent event = generateFissionEvent(default_parent_mass, default_excitation_energy);
+
+                std::lock_guard<ProfiledMutex> lock(queue_mutex);
+                event_queue.push(QueuedFissionEvent{event, CycleClock::now(), epoch});
             }
             queue_cv.notify_one();
 
@@ -877,6 +1936,12 @@ void TernaryFissionSimulationEngine::continuousGeneratorFunction() {
             }
         }
 
+        // We dissipate fields once per second so expired fields release memory
+        if (now - last_field_update >= std::chrono::seconds(1)) {
+            updateEnergyFields();
+            last_field_update = now;
+        }
+
         // Small sleep to prevent busy waiting
         std::this_thread::sleep_for(std::chrono::microseconds(100));
     }
@@ -884,20 +1949,32 @@ void TernaryFissionSimulationEngine::continuousGeneratorFunction() {
 
 /*
  * Update energy fields (private method)
- * We apply dissipation to active fields
+ * We dissipate field state here and leave the entropy pass over field
+ * memory to the dissipation scheduler, so no field is walked under the lock
  */
 void TernaryFissionSimulationEngine::updateEnergyFields() {
-    std::lock_guard<std::mutex> lock(state_mutex);
+    TF_TRACE_SCOPE("updateEnergyFields", "engine");
+    std::lock_guard<ProfiledMutex> lock(state_mutex);
 
     auto it = simulation_state.active_energy_fields.begin();
     while (it != simulation_state.active_energy_fields.end()) {
+        // We leave fields alone until the fill pool has materialized them
+        if (it->state == FieldState::Materializing) {
+            ++it;
+            continue;
+        }
+
         // Apply dissipation using physics utilities
-        dissipateEnergyField(*it, 1);
+        bool dissipated = dissipateEnergyFieldState(*it);
 
         // Remove fields with very low energy
         if (it->energy_mev < 0.001) {
+            releaseEnergyField(*it);
             it = simulation_state.active_energy_fields.erase(it);
         } else {
+            if (dissipated && it->memory_ptr) {
+                dissipation_scheduler_->schedule(it->field_id, it->memory_bytes);
+            }
             ++it;
         }
     }
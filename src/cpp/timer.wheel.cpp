@@ -0,0 +1,180 @@
+/*
+ * File: src/cpp/timer.wheel.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Timer Wheel Implementation
+ * Purpose: Hashed timer wheel driven by one thread that sleeps until the next tick
+ *          while timers are armed and indefinitely while none are
+ * Reason: Replaces a sleeping thread per portal load
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ * - 2026-10-17: clear() for engine resets
+ *
+ * Carry-over Context:
+ * - Ticks are counted from construction on the steady clock; the thread processes every
+ *   tick in order, catching up after a late wakeup, and jumps ahead only when idle
+ */
+
+#include "timer.wheel.h"
+
+#include <algorithm>
+
+namespace TernaryFission {
+
+TimerWheel::TimerWheel(std::chrono::milliseconds tick, std::size_t slots, Callback callback)
+    : tick_(std::max(tick, std::chrono::milliseconds(1))),
+      callback_(std::move(callback)),
+      start_(std::chrono::steady_clock::now()),
+      slots_(std::max<std::size_t>(1, slots)) {
+    thread_ = std::thread(&TimerWheel::threadLoop, this);
+}
+
+TimerWheel::~TimerWheel() {
+    stop();
+}
+
+void TimerWheel::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopping_) {
+            return;
+        }
+        stopping_ = true;
+        timers_.clear();
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+std::uint64_t TimerWheel::ticksSinceStart(std::chrono::steady_clock::time_point when) const {
+    return static_cast<std::uint64_t>((when - start_) / tick_);
+}
+
+void TimerWheel::schedule(std::uint64_t timer_id, std::chrono::milliseconds delay) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopping_) {
+            return;
+        }
+        const std::uint64_t now_tick = ticksSinceStart(std::chrono::steady_clock::now());
+        if (timers_.empty()) {
+            // We skip the idle gap; there is nothing in the slots we would pass
+            current_tick_ = std::max(current_tick_, now_tick);
+        }
+
+        // We round up, plus the partial tick already elapsed, so no timer fires early
+        const std::uint64_t delay_ticks = static_cast<std::uint64_t>(
+            (std::max(delay, std::chrono::milliseconds(0)) + tick_ - std::chrono::milliseconds(1)) / tick_);
+        const std::uint64_t deadline = std::max(now_tick, current_tick_) + delay_ticks + 1;
+        const std::uint64_t generation = next_generation_++;
+
+        auto it = timers_.find(timer_id);
+        if (it == timers_.end()) {
+            timers_.emplace(timer_id, Timer{deadline, generation});
+            scheduled_.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            it->second = Timer{deadline, generation};
+            rescheduled_.fetch_add(1, std::memory_order_relaxed);
+        }
+        slots_[deadline % slots_.size()].emplace_back(timer_id, generation);
+    }
+    cv_.notify_all();
+}
+
+bool TimerWheel::cancel(std::uint64_t timer_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (timers_.erase(timer_id) == 0) {
+        return false;
+    }
+    cancelled_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+std::size_t TimerWheel::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // We leave stale slot entries for the thread to drop when it next goes idle
+    const std::size_t cleared = timers_.size();
+    timers_.clear();
+    cancelled_.fetch_add(cleared, std::memory_order_relaxed);
+    return cleared;
+}
+
+std::size_t TimerWheel::pending() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return timers_.size();
+}
+
+void TimerWheel::threadLoop() {
+    std::vector<std::uint64_t> due;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopping_) {
+        if (timers_.empty()) {
+            // We drop stale copies left by cancel and reschedule before going idle
+            for (auto& slot : slots_) {
+                slot.clear();
+            }
+            cv_.wait(lock, [this] { return stopping_ || !timers_.empty(); });
+            continue;
+        }
+
+        const auto next_tick_time = start_ + tick_ * static_cast<std::int64_t>(current_tick_ + 1);
+        if (std::chrono::steady_clock::now() < next_tick_time) {
+            cv_.wait_until(lock, next_tick_time);
+            continue;
+        }
+
+        // We process one slot: fire what is due, keep later rounds, drop stale copies
+        current_tick_++;
+        auto& slot = slots_[current_tick_ % slots_.size()];
+        std::size_t kept = 0;
+        for (const auto& entry : slot) {
+            auto it = timers_.find(entry.first);
+            if (it == timers_.end() || it->second.generation != entry.second) {
+                continue;
+            }
+            if (it->second.deadline_tick <= current_tick_) {
+                due.push_back(entry.first);
+                timers_.erase(it);
+            } else {
+                slot[kept++] = entry;
+            }
+        }
+        slot.resize(kept);
+        if (due.empty()) {
+            continue;
+        }
+
+        const auto lateness = std::chrono::steady_clock::now() - (start_ + tick_ * static_cast<std::int64_t>(current_tick_));
+        const auto lateness_us = static_cast<std::uint64_t>(
+            std::max<std::int64_t>(0, std::chrono::duration_cast<std::chrono::microseconds>(lateness).count()));
+        if (lateness_us > max_lateness_us_.load(std::memory_order_relaxed)) {
+            max_lateness_us_.store(lateness_us, std::memory_order_relaxed);
+        }
+
+        lock.unlock();
+        for (std::uint64_t timer_id : due) {
+            fired_.fetch_add(1, std::memory_order_relaxed);
+            callback_(timer_id);
+        }
+        due.clear();
+        lock.lock();
+    }
+}
+
+Json::Value TimerWheel::statsToJson() const {
+    Json::Value stats;
+    stats["tick_ms"] = static_cast<Json::Int64>(tick_.count());
+    stats["slots"] = static_cast<Json::UInt64>(slots_.size());
+    stats["pending"] = static_cast<Json::UInt64>(pending());
+    stats["scheduled"] = static_cast<Json::UInt64>(scheduled_.load(std::memory_order_relaxed));
+    stats["rescheduled"] = static_cast<Json::UInt64>(rescheduled_.load(std::memory_order_relaxed));
+    stats["cancelled"] = static_cast<Json::UInt64>(cancelled_.load(std::memory_order_relaxed));
+    stats["fired"] = static_cast<Json::UInt64>(fired_.load(std::memory_order_relaxed));
+    stats["max_lateness_ms"] = static_cast<double>(max_lateness_us_.load(std::memory_order_relaxed)) / 1000.0;
+    return stats;
+}
+
+} // namespace TernaryFission
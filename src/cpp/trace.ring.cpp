@@ -0,0 +1,223 @@
+/*
+ * File: src/cpp/trace.ring.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Per-Thread Trace Ring Buffers Implementation
+ * Purpose: Implements span recording, ring registry and Chrome trace-event export
+ * Reason: We need low-overhead, runtime-toggleable tracing across engine, HTTP and daemon
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ *
+ * Carry-over Context:
+ * - Ring capacity defaults to 16384 spans per thread (512 KiB) and can be set with
+ *   TERNARY_TRACE_RING_SPANS before the first span is recorded
+ * - The registry mutex is taken only when a thread records its first span and on dump
+ */
+
+#include "trace.ring.h"
+
+#include <json/json.h>
+
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace TernaryFission {
+namespace Trace {
+
+std::atomic<bool> g_tracing_enabled{false};
+
+namespace {
+
+struct Slot {
+    std::atomic<std::uint64_t> sequence{0};   // index + 1 once the slot is complete
+    const char* name = nullptr;
+    const char* category = nullptr;
+    std::uint64_t start = 0;
+    std::uint64_t end = 0;
+};
+
+struct Ring {
+    explicit Ring(std::size_t capacity)
+        : slots(capacity), mask(capacity - 1), tid(static_cast<long>(::syscall(SYS_gettid))) {}
+
+    std::vector<Slot> slots;
+    std::size_t mask;
+    long tid;
+    std::atomic<std::uint64_t> next{0};
+    std::atomic<std::uint64_t> cleared_before{0};
+};
+
+std::size_t computeCapacity() {
+    std::size_t capacity = 16384;
+    if (const char* env = std::getenv("TERNARY_TRACE_RING_SPANS")) {
+        long requested = std::atol(env);
+        if (requested >= 64) {
+            capacity = static_cast<std::size_t>(requested);
+        }
+    }
+    // We round up to a power of two so indexing is a mask
+    std::size_t power = 1;
+    while (power < capacity) {
+        power <<= 1;
+    }
+    return power;
+}
+
+std::mutex& registryMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::vector<std::shared_ptr<Ring>>& registry() {
+    static std::vector<std::shared_ptr<Ring>> rings;
+    return rings;
+}
+
+Ring& threadRing() {
+    thread_local std::shared_ptr<Ring> ring = []() {
+        auto created = std::make_shared<Ring>(ringCapacity());
+        std::lock_guard<std::mutex> lock(registryMutex());
+        registry().push_back(created);
+        return created;
+    }();
+    return *ring;
+}
+
+} // namespace
+
+std::size_t ringCapacity() {
+    static const std::size_t capacity = computeCapacity();
+    return capacity;
+}
+
+void setEnabled(bool enabled) {
+    if (enabled) {
+        // We calibrate before the first span so the signal path never sleeps
+        CycleClock::epoch();
+    }
+    g_tracing_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool toggle() {
+    bool previous = g_tracing_enabled.load(std::memory_order_relaxed);
+    g_tracing_enabled.store(!previous, std::memory_order_relaxed);
+    return !previous;
+}
+
+void recordSpan(const char* name, const char* category, std::uint64_t start_ticks, std::uint64_t end_ticks) {
+    Ring& ring = threadRing();
+    std::uint64_t index = ring.next.load(std::memory_order_relaxed);
+    Slot& slot = ring.slots[index & ring.mask];
+    slot.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.name = name;
+    slot.category = category;
+    slot.start = start_ticks;
+    slot.end = end_ticks;
+    slot.sequence.store(index + 1, std::memory_order_release);
+    ring.next.store(index + 1, std::memory_order_relaxed);
+}
+
+void clear() {
+    std::lock_guard<std::mutex> lock(registryMutex());
+    for (auto& ring : registry()) {
+        ring->cleared_before.store(ring->next.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+}
+
+std::string dumpChromeTrace() {
+    std::vector<std::shared_ptr<Ring>> rings;
+    {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        rings = registry();
+    }
+
+    struct Span {
+        const char* name;
+        const char* category;
+        std::uint64_t start;
+        std::uint64_t end;
+        long tid;
+    };
+
+    // We snapshot first so timestamps can be based on the earliest retained span
+    std::vector<Span> spans;
+    std::vector<long> tids;
+    std::uint64_t base = CycleClock::epoch();
+    for (const auto& ring : rings) {
+        std::uint64_t end = ring->next.load(std::memory_order_acquire);
+        std::uint64_t capacity = ring->slots.size();
+        std::uint64_t begin = std::max(ring->cleared_before.load(std::memory_order_relaxed),
+                                       end > capacity ? end - capacity : 0);
+        tids.push_back(ring->tid);
+
+        for (std::uint64_t index = begin; index < end; ++index) {
+            const Slot& slot = ring->slots[index & ring->mask];
+            if (slot.sequence.load(std::memory_order_acquire) != index + 1) {
+                continue;
+            }
+            Span span{slot.name, slot.category, slot.start, slot.end, ring->tid};
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) != index + 1) {
+                continue;
+            }
+            base = std::min(base, span.start);
+            spans.push_back(span);
+        }
+    }
+
+    const double ticks_per_us = CycleClock::ticksPerSecond() / 1e6;
+    const Json::Int64 pid = static_cast<Json::Int64>(::getpid());
+
+    Json::Value events(Json::arrayValue);
+    for (long tid : tids) {
+        Json::Value thread_name;
+        thread_name["name"] = "thread_name";
+        thread_name["ph"] = "M";
+        thread_name["pid"] = pid;
+        thread_name["tid"] = static_cast<Json::Int64>(tid);
+        thread_name["args"]["name"] = "tid " + std::to_string(tid);
+        events.append(thread_name);
+    }
+    for (const auto& span : spans) {
+        Json::Value event;
+        event["name"] = span.name;
+        event["cat"] = span.category;
+        event["ph"] = "X";
+        event["pid"] = pid;
+        event["tid"] = static_cast<Json::Int64>(span.tid);
+        event["ts"] = static_cast<double>(span.start - base) / ticks_per_us;
+        event["dur"] = static_cast<double>(span.end - span.start) / ticks_per_us;
+        events.append(event);
+    }
+
+    Json::Value trace;
+    trace["traceEvents"] = events;
+    trace["displayTimeUnit"] = "ns";
+    trace["otherData"]["clock"] = CycleClock::isInvariant() ? "invariant_tsc" : "cycle_clock";
+    trace["otherData"]["ticks_per_second"] = CycleClock::ticksPerSecond();
+
+    Json::StreamWriterBuilder builder;
+    builder["indentation"] = "";
+    return Json::writeString(builder, trace);
+}
+
+bool writeChromeTrace(const std::string& path) {
+    std::ofstream out(path);
+    if (!out.is_open()) {
+        return false;
+    }
+    out << dumpChromeTrace();
+    return out.good();
+}
+
+} // namespace Trace
+} // namespace TernaryFission
@@ -0,0 +1,80 @@
+/*
+ * File: tests/allocation_tracker_test.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Allocation Tracker Tests
+ * Purpose: Verifies per-thread counting, scope attribution and that steady-state batch
+ *          event generation into a preallocated buffer performs zero heap allocations
+ * Reason: We want a regression to fail the build when a hot path starts allocating
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ *
+ * Carry-over Context:
+ * - Built with -DTERNARY_ALLOC_TRACKING by make test
+ */
+
+#include "allocation.tracker.h"
+#include "ternary.fission.simulation.engine.h"
+
+#include <cassert>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace TernaryFission;
+
+int main() {
+    static_assert(Alloc::kTrackingCompiledIn, "build with -DTERNARY_ALLOC_TRACKING");
+
+    // We expect a new/delete pair to balance on this thread
+    Alloc::ThreadCounters start = Alloc::threadCounters();
+    {
+        auto buffer = std::make_unique<char[]>(1000);
+        buffer[0] = 1;
+    }
+    Alloc::ThreadCounters used = Alloc::threadCounters() - start;
+    assert(used.allocations == 1);
+    assert(used.frees == 1);
+    assert(used.bytes_allocated >= 1000);
+    assert(used.bytes_allocated == used.bytes_freed);
+
+    // We attribute allocations to the innermost scope only
+    Alloc::resetAllocations();
+    {
+        TF_ALLOC_SCOPE("test.outer");
+        std::vector<int> outer(16);
+        {
+            TF_ALLOC_SCOPE("test.inner");
+            std::vector<int> inner(32);
+            std::vector<int> more(64);
+        }
+        std::vector<int> after(8);
+    }
+    Json::Value scopes = Alloc::allocationsToJson()["scopes"];
+    assert(scopes["test.inner"]["allocations"].asUInt64() == 2);
+    assert(scopes["test.inner"]["frees"].asUInt64() == 2);
+    assert(scopes["test.outer"]["allocations"].asUInt64() == 2);
+    assert(scopes["test.outer"]["frees"].asUInt64() == 2);
+
+    // We require steady-state batch generation to stay off the heap
+    TernaryFissionSimulationEngine engine;
+    std::vector<TernaryFissionEvent> events(1024);
+    engine.generateFissionEvents(events.data(), events.size(), 235.0, 6.5);
+
+    start = Alloc::threadCounters();
+    for (int batch = 0; batch < 16; ++batch) {
+        std::size_t written = engine.generateFissionEvents(events.data(), events.size(), 235.0, 6.5);
+        assert(written == events.size());
+    }
+    used = Alloc::threadCounters() - start;
+    if (used.allocations != 0) {
+        std::cerr << "batch generation allocated " << used.allocations << " times ("
+                  << used.bytes_allocated << " bytes)" << std::endl;
+        return 1;
+    }
+    assert(events.back().event_id > events.front().event_id);
+
+    std::cout << "allocation tracker tests passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,162 @@
+/*
+ * File: tests/cpu_burn_executor_test.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: CPU Burn Executor Tests
+ * Purpose: Verifies that budgets are burned and accounted, that energy weighting and fair
+ *          share split burn time as configured, cancellation and dropped fields, the duty
+ *          cycle, and that engine fields are charged their burn cycles
+ * Reason: The executor turns field energy into real CPU work and must stay in budget
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ */
+
+#include "cpu.burn.executor.h"
+#include "physics.utilities.h"
+#include "ternary.fission.simulation.engine.h"
+
+#include <json/json.h>
+
+#include <cassert>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <vector>
+
+using namespace TernaryFission;
+
+static std::mutex g_mutex;
+static std::map<std::uint64_t, std::uint64_t> g_charged;
+static std::vector<std::uint64_t> g_units;
+static const std::uint64_t kGoneField = 99;
+
+/*
+ * Units of `other` that ran before `field` finished its last unit
+ */
+static std::size_t unitsBeforeLast(std::uint64_t field, std::uint64_t other) {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    std::size_t last = 0;
+    for (std::size_t i = 0; i < g_units.size(); ++i) {
+        if (g_units[i] == field) {
+            last = i;
+        }
+    }
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < last; ++i) {
+        count += g_units[i] == other ? 1 : 0;
+    }
+    return count;
+}
+
+int main() {
+    CpuBurnExecutor executor([](std::uint64_t field_id, std::uint64_t cycles) {
+        std::lock_guard<std::mutex> lock(g_mutex);
+        if (field_id == kGoneField) {
+            return false;
+        }
+        g_charged[field_id] += cycles;
+        g_units.push_back(field_id);
+        return true;
+    });
+
+    CpuBurnExecutor::Settings settings;
+    settings.threads = 1;
+    settings.cpu_usage_limit_percent = 0.0;
+    settings.min_unit_cycles = 200000;
+    settings.block_bytes = 1024;
+    executor.configure(settings);
+    assert(executor.enabled());
+
+    // We warm up the cipher so the first unit does not carry one-time setup cost
+    executor.submit(100, 1.0, 1000000);
+    executor.drain();
+    const Json::Value warm = executor.statsToJson();
+
+    // We burn a budget in units and account measured cycles against it
+    executor.submit(1, 10.0, 2000000);
+    executor.drain();
+    Json::Value stats = executor.statsToJson();
+    assert(stats["completed"].asUInt64() == 2);
+    const std::uint64_t units = stats["units"].asUInt64() - warm["units"].asUInt64();
+    assert(units >= 1 && units <= 10);
+    assert(g_charged[1] >= 2000000);
+    const std::uint64_t budget = stats["completed_budget_cycles"].asUInt64() -
+                                 warm["completed_budget_cycles"].asUInt64();
+    const std::uint64_t burned = stats["completed_burned_cycles"].asUInt64() -
+                                 warm["completed_burned_cycles"].asUInt64();
+    assert(budget == 2000000 && burned == g_charged[1]);
+    assert(static_cast<double>(burned) < 2.0 * static_cast<double>(budget));
+
+    // We give a field three times the energy three times the burn share
+    settings.threads = 0;
+    settings.policy = CpuBurnExecutor::Policy::EnergyWeighted;
+    settings.min_unit_cycles = 100000;
+    executor.configure(settings);
+    executor.submit(2, 1.0, 4000000);
+    executor.submit(3, 3.0, 4000000);
+    settings.threads = 1;
+    executor.configure(settings);
+    executor.drain();
+    std::size_t light_units = unitsBeforeLast(3, 2);
+    assert(light_units >= 5 && light_units <= 26);
+
+    // We alternate fields under fair share whatever their energy
+    settings.threads = 0;
+    settings.policy = CpuBurnExecutor::Policy::FairShare;
+    executor.configure(settings);
+    executor.submit(4, 1.0, 4000000);
+    executor.submit(5, 3.0, 4000000);
+    settings.threads = 1;
+    executor.configure(settings);
+    executor.drain();
+    assert(unitsBeforeLast(4, 5) >= 30);
+
+    // We drop cancelled budgets and budgets of fields that went away
+    settings.threads = 0;
+    executor.configure(settings);
+    assert(!executor.enabled());
+    executor.submit(6, 1.0, 4000000);
+    executor.cancel(6);
+    stats = executor.statsToJson();
+    assert(stats["cancelled"].asUInt64() == 1);
+    assert(stats["pending_fields"].asUInt64() == 0);
+    settings.threads = 1;
+    executor.configure(settings);
+    executor.submit(kGoneField, 1.0, 4000000);
+    executor.drain();
+    assert(executor.statsToJson()["dropped"].asUInt64() == 1);
+
+    // We split the machine-wide limit across the pool's threads
+    settings.threads = 2;
+    settings.cpu_usage_limit_percent = 1e-6;
+    executor.configure(settings);
+    assert(executor.dutyCycle() < 1.0);
+    executor.stop();
+    assert(!executor.toPrometheus().empty());
+
+    // We charge burned cycles to engine fields
+    g_energy_field_config.memory_per_mev = 10000.0;
+    g_energy_field_config.cpu_cycles_per_mev = 10000.0;
+    {
+        TernaryFissionSimulationEngine engine(235.0, 6.5, 1);
+        engine.configureFieldFill(0, 0);
+        CpuBurnExecutor::Settings burn;
+        burn.threads = 1;
+        burn.cpu_usage_limit_percent = 0.0;
+        burn.min_unit_cycles = 100000;
+        engine.configureCpuBurn(burn);
+        for (int i = 0; i < 3; ++i) {
+            engine.simulateTernaryFissionEvent();
+        }
+        engine.drainCpuBurn();
+        Json::Value burn_stats = engine.getCpuBurnAPI();
+        assert(burn_stats["completed"].asUInt64() == 3);
+        Json::Value cycles = engine.getFieldCyclesAPI();
+        assert(cycles["burn_cycles"].asUInt64() >= burn_stats["completed_budget_cycles"].asUInt64());
+        assert(cycles["total_cycles"].asUInt64() > cycles["burn_cycles"].asUInt64());
+    }
+
+    std::cout << "cpu burn executor tests passed" << std::endl;
+    return 0;
+}
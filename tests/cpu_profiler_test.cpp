@@ -0,0 +1,84 @@
+/*
+ * File: tests/cpu_profiler_test.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Sampling CPU Profiler Tests
+ * Purpose: Verifies that a profile captures a busy function, folds stacks and rejects
+ *          concurrent or invalid requests
+ * Reason: We serve these stacks as flamegraph input, so the format must hold
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ */
+
+#include "cpu.profiler.h"
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+
+using namespace TernaryFission::Profiler;
+
+std::atomic<bool> g_spin{true};
+
+// We keep this exported and out of line so the profile can name it
+extern "C" __attribute__((noinline)) void cpu_profiler_test_spin() {
+    volatile std::uint64_t x = 0;
+    while (g_spin.load(std::memory_order_relaxed)) {
+        for (int i = 0; i < 1000; ++i) {
+            x = x + i;
+        }
+    }
+}
+
+int main() {
+    CpuProfileResult result;
+    std::string error;
+
+    CpuProfileOptions invalid;
+    invalid.hz = kMaxSampleHz + 1;
+    assert(runCpuProfile(invalid, result, error) == CpuProfileStatus::InvalidArgument);
+
+    std::thread spinner(cpu_profiler_test_spin);
+
+    std::atomic<int> busy_status{-1};
+    std::thread contender([&busy_status]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        CpuProfileResult ignored;
+        std::string contender_error;
+        CpuProfileOptions options;
+        options.seconds = 1;
+        busy_status = static_cast<int>(runCpuProfile(options, ignored, contender_error));
+    });
+
+    CpuProfileOptions options;
+    options.seconds = 1;
+    options.hz = 499;
+    CpuProfileStatus status = runCpuProfile(options, result, error);
+    contender.join();
+    g_spin = false;
+    spinner.join();
+
+    if (status != CpuProfileStatus::Ok) {
+        std::cerr << "profile failed: " << error << std::endl;
+        return 1;
+    }
+    assert(busy_status.load() == static_cast<int>(CpuProfileStatus::Busy));
+    assert(!cpuProfileRunning());
+    assert(result.samples > 0);
+    assert(result.unique_stacks > 0);
+    assert(result.overhead_percent >= 0.0);
+    assert(result.folded.find("cpu_profiler_test_spin") != std::string::npos);
+
+    // We expect "frame;frame count" lines
+    std::string first = result.folded.substr(0, result.folded.find('\n'));
+    assert(first.rfind(' ') != std::string::npos);
+    assert(std::stoull(first.substr(first.rfind(' ') + 1)) > 0);
+
+    std::cout << "cpu profiler tests passed (" << result.samples << " samples, "
+              << result.overhead_percent << "% overhead)" << std::endl;
+    return 0;
+}
@@ -0,0 +1,141 @@
+/*
+ * File: tests/dissipation_scheduler_test.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Dissipation Scheduler Tests
+ * Purpose: Verifies round-robin slicing across fields, the per-tick byte budget, cursor
+ *          wrap-around, pass coalescing, dropped passes for removed fields, the duty
+ *          cycle and the engine's use of the scheduler during continuous mode
+ * Reason: The scheduler decides how long any lock holder can wait behind dissipation
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ */
+
+#include "dissipation.scheduler.h"
+#include "physics.utilities.h"
+#include "ternary.fission.simulation.engine.h"
+
+#include <json/json.h>
+
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+using namespace TernaryFission;
+
+using Slice = std::tuple<std::uint64_t, std::size_t, std::size_t>;
+
+int main() {
+    std::vector<Slice> slices;
+    std::uint64_t gone_field = 99;
+    DissipationScheduler::Settings settings;
+    settings.slice_bytes = 4096;
+    settings.bytes_per_tick = 4 * 4096;
+    DissipationScheduler scheduler([&](std::uint64_t id, std::size_t offset, std::size_t length) {
+        if (id == gone_field) {
+            return false;
+        }
+        slices.emplace_back(id, offset, length);
+        return true;
+    }, settings);
+    scheduler.configure(settings);
+
+    // We alternate between fields one slice at a time and stop at the tick budget
+    scheduler.schedule(1, 4 * 4096);
+    scheduler.schedule(2, 2 * 4096);
+    std::size_t processed = scheduler.runTick();
+    assert(processed == 4 * 4096);
+    assert(slices.size() == 4);
+    assert(slices[0] == Slice(1, 0, 4096));
+    assert(slices[1] == Slice(2, 0, 4096));
+    assert(slices[2] == Slice(1, 4096, 4096));
+    assert(slices[3] == Slice(2, 4096, 4096));
+    processed = scheduler.runTick();
+    assert(processed == 2 * 4096);
+    assert(slices[5] == Slice(1, 3 * 4096, 4096));
+    assert(scheduler.runTick() == 0);
+    Json::Value stats = scheduler.statsToJson();
+    assert(stats["passes_completed"].asUInt64() == 2);
+    assert(stats["backlog_bytes"].asUInt64() == 0);
+    assert(stats["slices"].asUInt64() == 6);
+
+    // We clamp the last slice to the field and wrap the cursor into the second pass
+    slices.clear();
+    scheduler.schedule(3, 10000);
+    scheduler.schedule(3, 10000);
+    scheduler.runTick();
+    assert(slices.size() == 5);
+    assert(slices[2] == Slice(3, 8192, 10000 - 8192));
+    assert(slices[3] == Slice(3, 0, 4096));
+    while (scheduler.runTick() > 0) {
+    }
+    assert(scheduler.statsToJson()["backlog_bytes"].asUInt64() == 0);
+
+    // We keep at most two passes of backlog per field and count the rest as coalesced
+    scheduler.schedule(4, 8192);
+    scheduler.schedule(4, 8192);
+    scheduler.schedule(4, 8192);
+    stats = scheduler.statsToJson();
+    assert(stats["backlog_bytes"].asUInt64() == 2 * 8192);
+    assert(stats["passes_coalesced"].asUInt64() == 1);
+    while (scheduler.runTick() > 0) {
+    }
+
+    // We drop the pass of a field that went away
+    scheduler.schedule(gone_field, 3 * 4096);
+    scheduler.runTick();
+    stats = scheduler.statsToJson();
+    assert(stats["passes_dropped"].asUInt64() == 1);
+    assert(stats["backlog_bytes"].asUInt64() == 0);
+    assert(stats["pending_fields"].asUInt64() == 0);
+
+    // We derive the thread's duty cycle from the machine-wide limit
+    settings.cpu_usage_limit_percent = 0.0;
+    scheduler.configure(settings);
+    assert(scheduler.dutyCycle() == 1.0);
+    settings.cpu_usage_limit_percent = 1e-6;
+    scheduler.configure(settings);
+    assert(scheduler.dutyCycle() < 1.0);
+
+    // We let the background thread work through a backlog under a throttle
+    settings.cpu_usage_limit_percent = 50.0 / std::max(1u, std::thread::hardware_concurrency());
+    scheduler.configure(settings);
+    slices.clear();
+    scheduler.start();
+    scheduler.schedule(5, 64 * 4096);
+    scheduler.schedule(6, 64 * 4096);
+    scheduler.drain();
+    scheduler.stop();
+    assert(slices.size() == 128);
+    stats = scheduler.statsToJson();
+    assert(stats["duty_cycle"].asDouble() <= 0.5 + 1e-9);
+    assert(stats["slice_time_us"]["count"].asUInt64() > 0);
+    assert(!scheduler.toPrometheus().empty());
+
+    // We dissipate engine field memory through the scheduler in continuous mode
+    g_energy_field_config.memory_per_mev = 10000.0;
+    {
+        TernaryFissionSimulationEngine engine(235.0, 6.5, 1);
+        engine.configureFieldFill(0, 0);
+        for (int i = 0; i < 4; ++i) {
+            engine.simulateTernaryFissionEvent();
+        }
+        engine.startContinuousSimulation(1.0);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1300));
+        engine.stopContinuousSimulation();
+        engine.drainDissipation();
+        Json::Value dissipation = engine.getDissipationAPI();
+        assert(dissipation["running"].asBool());
+        assert(dissipation["passes_scheduled"].asUInt64() >= 4);
+        assert(dissipation["bytes_processed"].asUInt64() > 0);
+        assert(dissipation["backlog_bytes"].asUInt64() == 0);
+        assert(engine.getFieldCyclesAPI()["dissipation_cycles"].asUInt64() > 0);
+    }
+
+    std::cout << "dissipation scheduler tests passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,140 @@
+/*
+ * File: tests/engine_reset_test.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Engine Reset Tests
+ * Purpose: Verifies that an in-place reset under concurrent event load leaves no field,
+ *          event or committed memory from before the reset, keeps pool settings and
+ *          worker threads, and advances the reset epoch
+ * Reason: Simulation reset used to shut the engine down and construct a new one
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ * - 2026-10-17: Portals started and extended during resets never outlive their fields
+ * - 2026-10-17: Field API callers run through the resets; every reset quiesces the
+ *               epoch barrier and leaves no caller inside it
+ */
+
+#include "memory.governor.h"
+#include "physics.utilities.h"
+#include "ternary.fission.simulation.engine.h"
+
+#include <json/json.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace TernaryFission;
+
+int main() {
+    g_energy_field_config.memory_per_mev = 1000.0;
+    g_energy_field_config.cpu_cycles_per_mev = 1000.0;
+
+    TernaryFissionSimulationEngine engine(235.0, 6.5, 2);
+    engine.configureFieldFill(2, 1024 * 1024);
+    CpuBurnExecutor::Settings burn;
+    burn.threads = 1;
+    burn.cpu_usage_limit_percent = 0.0;
+    burn.min_unit_cycles = 10000;
+    engine.configureCpuBurn(burn);
+
+    // We reset repeatedly while the continuous generator and API callers add events
+    std::atomic<bool> running{true};
+    std::vector<std::thread> callers;
+    for (int i = 0; i < 2; ++i) {
+        callers.emplace_back([&engine, &running] {
+            while (running.load()) {
+                engine.simulateTernaryFissionEvent();
+            }
+        });
+    }
+    callers.emplace_back([&engine, &running] {
+        Json::Value request;
+        request["energy_mev"] = 1.0;
+        while (running.load()) {
+            assert(engine.createEnergyFieldAPI(request)["status"].asString() == "success");
+        }
+    });
+    callers.emplace_back([&engine, &running] {
+        std::uint64_t portal = 0;
+        while (running.load()) {
+            if (portal == 0 || !engine.extendPortalLoad(portal, 0.5)) {
+                portal = engine.startPortalLoad(30.0, 1.0);
+            }
+        }
+    });
+
+    const int kResets = 20;
+    for (int i = 1; i <= kResets; ++i) {
+        engine.startContinuousSimulation(5000.0);
+        const std::uint64_t portal = engine.startPortalLoad(30.0, 1.0);
+        assert(portal != 0);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+        Json::Value summary = engine.reset();
+        assert(summary["reset_epoch"].asUInt64() == static_cast<std::uint64_t>(i));
+        assert(summary["portals_cancelled"].asUInt64() >= 1);
+        assert(summary["barrier_wait_us"].asDouble() >= 0.0);
+        assert(!engine.getSystemStatusAPI()["simulation_running"].asBool());
+    }
+
+    running.store(false);
+    for (auto& caller : callers) {
+        caller.join();
+    }
+
+    // We never leave a portal holding a field that a reset already released
+    std::set<std::uint64_t> live_fields;
+    for (const auto& field : engine.getEnergyFieldsAPI()["energy_fields"]) {
+        live_fields.insert(field["field_id"].asUInt64());
+    }
+    for (const auto& portal : engine.getPortalLoadsAPI()["portals"]) {
+        for (const auto& field_id : portal["field_ids"]) {
+            assert(live_fields.count(field_id.asUInt64()) == 1);
+        }
+    }
+
+    // We settle in-flight work from the last epoch, then reset a quiet engine
+    engine.drainFieldFill();
+    engine.drainCpuBurn();
+    Json::Value summary = engine.reset();
+    assert(summary["reset_epoch"].asUInt64() == kResets + 1);
+    engine.drainFieldFill();
+    engine.drainCpuBurn();
+    engine.drainDissipation();
+
+    Json::Value status = engine.getSystemStatusAPI();
+    assert(status["reset_epoch"].asUInt64() == kResets + 1);
+    assert(status["epoch_barrier"]["quiesces"].asUInt64() == kResets + 1);
+    assert(status["epoch_barrier"]["active"].asUInt64() == 0);
+    assert(status["total_events_simulated"].asUInt64() == 0);
+    assert(status["total_energy_fields_created"].asUInt64() == 0);
+    assert(status["active_energy_fields"].asInt64() == 0);
+    Json::Value accounting = engine.getMemoryAccountingAPI();
+    assert(accounting["fission_event_history"].asUInt64() == 0);
+    assert(Governor::committedBytes() == 0);
+    assert(engine.getPortalLoadsAPI()["active_portals"].asUInt() == 0);
+    assert(engine.getPortalLoadsAPI()["timers"]["pending"].asUInt64() == 0);
+
+    // We keep configured pools and settings across the reset
+    assert(engine.getFieldFillAPI()["threads"].asUInt() == 2);
+    assert(engine.getCpuBurnAPI()["threads"].asUInt() == 1);
+
+    // We keep simulating in the new epoch
+    engine.simulateTernaryFissionEvent();
+    engine.drainFieldFill();
+    engine.drainCpuBurn();
+    status = engine.getSystemStatusAPI();
+    assert(status["total_events_simulated"].asUInt64() == 1);
+    assert(status["active_energy_fields"].asInt64() == 1);
+    std::cout << "quiet reset took " << summary["reset_time_us"].asDouble() << " us" << std::endl;
+
+    std::cout << "engine reset tests passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,98 @@
+/*
+ * File: tests/epoch_barrier_test.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Epoch Barrier Tests
+ * Purpose: Verifies that quiesce waits for callers inside the epoch, holds new callers
+ *          out until the swap is done, counts nested scopes once and refuses to wait on
+ *          its own thread
+ * Reason: Engine reset now waits behind an epoch barrier instead of only advancing an epoch
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ */
+
+#include "epoch.barrier.h"
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+using namespace TernaryFission;
+
+int main() {
+    EpochBarrier barrier("test.epoch_barrier");
+
+    // We count a thread once however deeply its scopes nest
+    {
+        EpochBarrier::Scope outer(barrier);
+        EpochBarrier::Scope inner(barrier);
+        assert(barrier.active() == 1);
+
+        // We refuse to quiesce from inside a scope rather than wait on ourselves
+        bool refused = false;
+        try {
+            barrier.quiesce([] {});
+        } catch (const std::logic_error&) {
+            refused = true;
+        }
+        assert(refused);
+    }
+    assert(barrier.active() == 0);
+
+    // We wait for a caller already inside the epoch before swapping
+    std::atomic<bool> inside{false};
+    std::atomic<bool> finished{false};
+    std::thread caller([&] {
+        EpochBarrier::Scope scope(barrier);
+        inside.store(true);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        finished.store(true);
+    });
+    while (!inside.load()) {
+        std::this_thread::yield();
+    }
+    bool finished_before_swap = false;
+    const double waited_us = barrier.quiesce([&] { finished_before_swap = finished.load(); });
+    caller.join();
+    assert(finished_before_swap);
+    assert(waited_us > 10000.0);
+
+    // We hold callers arriving during the swap until the barrier reopens
+    std::atomic<bool> late_entered{false};
+    std::thread late;
+    barrier.quiesce([&] {
+        late = std::thread([&] {
+            EpochBarrier::Scope scope(barrier);
+            late_entered.store(true);
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        assert(!late_entered.load());
+    });
+    late.join();
+    assert(late_entered.load());
+
+    // We reopen the barrier when the swap throws
+    bool rethrown = false;
+    try {
+        barrier.quiesce([] { throw std::runtime_error("swap failed"); });
+    } catch (const std::runtime_error&) {
+        rethrown = true;
+    }
+    assert(rethrown);
+    {
+        EpochBarrier::Scope scope(barrier);
+        assert(barrier.active() == 1);
+    }
+
+    Json::Value stats = barrier.statsToJson();
+    assert(stats["quiesces"].asUInt64() == 3);
+    assert(stats["entries_blocked"].asUInt64() == 1);
+    assert(!stats["closed"].asBool() && stats["active"].asUInt64() == 0);
+
+    std::cout << "epoch barrier tests passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,100 @@
+/*
+ * File: tests/field_fill_pool_test.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Field Fill Pool Tests
+ * Purpose: Verifies that event fields are registered as materializing and become active
+ *          once filled, that the backlog bound applies backpressure, that governor
+ *          rejections drop the field but keep the event, and the synchronous fallback
+ * Reason: The fill pool owns field memory between the event path and engine state
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ */
+
+#include "memory.governor.h"
+#include "physics.utilities.h"
+#include "ternary.fission.simulation.engine.h"
+
+#include <json/json.h>
+
+#include <cassert>
+#include <iostream>
+
+using namespace TernaryFission;
+
+static void simulate(TernaryFissionSimulationEngine& engine, int events) {
+    for (int i = 0; i < events; ++i) {
+        engine.simulateTernaryFissionEvent();
+    }
+}
+
+static bool allActive(const TernaryFissionSimulationEngine& engine) {
+    Json::Value fields = engine.getEnergyFieldsAPI()["energy_fields"];
+    for (const auto& field : fields) {
+        if (field["state"].asString() != "active" || field["memory"]["backing"].asString() == "none") {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main() {
+    // We keep fields at a few MB so the test stays small
+    g_energy_field_config.memory_per_mev = 10000.0;
+
+    {
+        TernaryFissionSimulationEngine engine(235.0, 6.5, 1);
+
+        // We register fields immediately and materialize them on the pool
+        engine.configureFieldFill(2, 64 * 1024 * 1024);
+        simulate(engine, 8);
+        engine.drainFieldFill();
+        Json::Value accounting = engine.getMemoryAccountingAPI();
+        assert(accounting["active_energy_fields"].asUInt64() == 8);
+        assert(accounting["materializing_fields"].asUInt64() == 0);
+        assert(accounting["field_memory_bytes"].asUInt64() > 0);
+        assert(allActive(engine));
+        Json::Value fill = engine.getFieldFillAPI();
+        assert(fill["enabled"].asBool());
+        assert(fill["completed"].asUInt64() == 8);
+        assert(fill["backlog_bytes"].asUInt64() == 0);
+        assert(fill["fill_time_us"]["count"].asUInt64() == 8);
+
+        // We make the event path wait once the backlog is full
+        engine.configureFieldFill(1, 1);
+        simulate(engine, 6);
+        engine.drainFieldFill();
+        fill = engine.getFieldFillAPI();
+        assert(fill["completed"].asUInt64() == 6);
+        assert(fill["backpressure_waits"].asUInt64() >= 1);
+        assert(fill["peak_backlog_bytes"].asUInt64() < 2 * 3000000);
+        assert(allActive(engine));
+
+        // We drop fields the governor rejects but keep their events
+        Governor::Settings governor;
+        governor.max_bytes = 1;
+        Governor::configure(governor);
+        simulate(engine, 2);
+        engine.drainFieldFill();
+        fill = engine.getFieldFillAPI();
+        assert(fill["rejected"].asUInt64() == 2);
+        assert(engine.getMemoryAccountingAPI()["active_energy_fields"].asUInt64() == 14);
+        Governor::configure(Governor::Settings());
+
+        // We fill on the event path when the pool is disabled
+        engine.configureFieldFill(0, 0);
+        simulate(engine, 1);
+        assert(!engine.getFieldFillAPI()["enabled"].asBool());
+        assert(engine.getMemoryAccountingAPI()["active_energy_fields"].asUInt64() == 15);
+        assert(allActive(engine));
+
+        // We leave queued fields to shutdown, which drains the pool before clearing state
+        engine.configureFieldFill(2, 64 * 1024 * 1024);
+        simulate(engine, 4);
+    }
+    assert(Governor::committedBytes() == 0);
+
+    std::cout << "field fill pool tests passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,97 @@
+/*
+ * File: tests/field_memory_test.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Field Memory Tests
+ * Purpose: Verifies the backing fallback chain, prefaulting, release accounting and
+ *          the per-field memory/fault report
+ * Reason: We must never hand an mmap'd buffer to free() or lose a mapping on release
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ *
+ * Carry-over Context:
+ * - Hosts without reserved huge pages exercise the HugeTlb -> TransparentHuge fallback
+ */
+
+#include "field.memory.h"
+#include "physics.utilities.h"
+
+#include <json/json.h>
+
+#include <cassert>
+#include <cstring>
+#include <iostream>
+
+using namespace TernaryFission;
+
+static std::uint64_t liveBytes() {
+    std::uint64_t total = 0;
+    Json::Value stats = FieldMemory::statsToJson();
+    for (const auto& entry : stats["backings"]) {
+        total += entry["live_bytes"].asUInt64();
+    }
+    return total;
+}
+
+int main() {
+    const std::size_t kBytes = 8 * 1024 * 1024 + 100;
+    const FieldMemory::Settings defaults = FieldMemory::settings();
+
+    // We keep small buffers on malloc whatever the mode
+    FieldMemory::Block small = FieldMemory::allocate(4096);
+    assert(small.memory && small.backing == FieldMemory::Backing::Malloc);
+    FieldMemory::release(small.memory, small.mapped_bytes, small.backing);
+
+    // We map large buffers and round the mapping to whole pages
+    FieldMemory::Settings settings = defaults;
+    settings.mode = FieldMemory::Mode::Mmap;
+    FieldMemory::configure(settings);
+    FieldMemory::Block mapped = FieldMemory::allocate(kBytes);
+    assert(mapped.memory && mapped.backing == FieldMemory::Backing::Mmap);
+    assert(mapped.mapped_bytes >= kBytes && mapped.mapped_bytes % 4096 == 0);
+    std::memset(mapped.memory, 0x5a, kBytes);
+    assert(liveBytes() == mapped.mapped_bytes);
+    FieldMemory::release(mapped.memory, mapped.mapped_bytes, mapped.backing);
+    assert(liveBytes() == 0);
+
+    // We expect a prefaulted buffer to take (almost) no faults when first written
+    settings.prefault = true;
+    FieldMemory::configure(settings);
+    FieldMemory::Block prefaulted = FieldMemory::allocate(kBytes);
+    assert(prefaulted.memory && prefaulted.faults > 0);
+    std::uint64_t before = FieldMemory::threadPageFaults();
+    std::memset(prefaulted.memory, 0x5a, kBytes);
+    std::uint64_t touch_faults = FieldMemory::threadPageFaults() - before;
+    assert(touch_faults < kBytes / 4096 / 4);
+    FieldMemory::release(prefaulted.memory, prefaulted.mapped_bytes, prefaulted.backing);
+
+    // We fall back from explicit huge pages without failing the allocation
+    settings = defaults;
+    settings.mode = FieldMemory::Mode::Auto;
+    FieldMemory::configure(settings);
+    FieldMemory::Block automatic = FieldMemory::allocate(kBytes);
+    assert(automatic.memory && automatic.backing != FieldMemory::Backing::Malloc);
+    assert(automatic.mapped_bytes % (2 * 1024 * 1024) == 0 || automatic.backing == FieldMemory::Backing::Mmap);
+    std::memset(automatic.memory, 0x5a, kBytes);
+    FieldMemory::release(automatic.memory, automatic.mapped_bytes, automatic.backing);
+    Json::Value stats = FieldMemory::statsToJson();
+    assert(stats["mode"].asString() == "auto");
+    assert(stats["hugetlb_available"].asBool() || stats["hugetlb_fallbacks"].asUInt64() == 1);
+
+    // We report backing and faults per field and free the mapping on release
+    FieldMemory::configure(defaults);
+    EnergyField field = createEnergyField(10.0);
+    assert(field.memory_ptr && field.memory_mapped_bytes >= field.memory_bytes);
+    Json::Value memory = FieldMemory::fieldMemoryToJson(field);
+    assert(memory["backing"].asString() != "none");
+    assert(memory["expected_4k_faults"].asUInt64() == (field.memory_bytes + 4095) / 4096);
+    assert(memory["allocation_faults"].asUInt64() + memory["fill_faults"].asUInt64() > 0);
+    releaseEnergyField(field);
+    assert(field.memory_ptr == nullptr && field.memory_mapped_bytes == 0);
+    assert(liveBytes() == 0);
+
+    std::cout << "field memory tests passed (" << memory["backing"].asString() << ", "
+              << memory["fault_reduction"].asDouble() << "x fewer faults than 4 KiB pages)" << std::endl;
+    return 0;
+}
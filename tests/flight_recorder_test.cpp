@@ -0,0 +1,152 @@
+/*
+ * File: tests/flight_recorder_test.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Flight Recorder Tests
+ * Purpose: Verifies span, metric and log recording across threads, ring wrap-around,
+ *          atomic dump files and watchdog rate-drop detection
+ * Reason: We only look at flight dumps after an incident, so they must already work
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ */
+
+#include "flight.recorder.h"
+#include "perf.counters.h"
+
+#include <json/json.h>
+
+#include <dirent.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace TernaryFission;
+
+static Json::Value parse(const std::string& text) {
+    Json::Value root;
+    Json::CharReaderBuilder builder;
+    std::string errors;
+    std::istringstream stream(text);
+    bool ok = Json::parseFromStream(builder, stream, &root, &errors);
+    assert(ok && root.isMember("traceEvents"));
+    (void)ok;
+    return root;
+}
+
+static int countEvents(const Json::Value& root, const std::string& phase, const std::string& name) {
+    int count = 0;
+    for (const auto& event : root["traceEvents"]) {
+        if (event["ph"].asString() == phase && event["name"].asString() == name) {
+            count++;
+        }
+    }
+    return count;
+}
+
+int main() {
+    assert(Flight::isEnabled());
+
+    // We record spans, metrics and logs from two threads
+    std::uint64_t start = CycleClock::now();
+    Flight::recordSpan("unit", "test", start, CycleClock::now(), "GET /unit 200");
+    Flight::recordMetric("unit_metric", 42.5);
+    Flight::recordLog("test", std::string(200, 'x'));
+    std::thread worker([]() {
+        std::uint64_t begin = CycleClock::now();
+        Flight::recordSpan("worker", "test", begin, CycleClock::now());
+    });
+    worker.join();
+
+    Json::Value root = parse(Flight::dumpJson("unit"));
+    assert(root["otherData"]["reason"].asString() == "unit");
+    assert(countEvents(root, "X", "unit") == 1);
+    assert(countEvents(root, "X", "worker") == 1);
+    assert(countEvents(root, "C", "unit_metric") == 1);
+    for (const auto& event : root["traceEvents"]) {
+        if (event["name"].asString() == "unit") {
+            assert(event["args"]["detail"].asString() == "GET /unit 200");
+        }
+        if (event["ph"].asString() == "C") {
+            assert(event["args"]["value"].asDouble() == 42.5);
+        }
+        if (event["ph"].asString() == "i") {
+            assert(event["args"]["message"].asString().size() == Flight::kRecordTextBytes - 1);
+        }
+    }
+
+    // We keep only the newest ringCapacity() records per thread
+    const std::size_t total = Flight::ringCapacity() + 50;
+    for (std::size_t i = 0; i < total; ++i) {
+        Flight::recordMetric("wrap", static_cast<double>(i));
+    }
+    root = parse(Flight::dumpJson("wrap"));
+    int wrapped = countEvents(root, "C", "wrap");
+    assert(wrapped > 0 && static_cast<std::size_t>(wrapped) <= Flight::ringCapacity());
+
+    // We only keep spans at or above the minimum span length
+    assert(!Flight::wantsSpan(0));
+
+    // We write dumps into place and leave no temporary file behind
+    char directory[] = "/tmp/flight-test-XXXXXX";
+    if (!::mkdtemp(directory)) {
+        std::cerr << "cannot create " << directory << std::endl;
+        return 1;
+    }
+    Flight::setDumpDirectory(directory);
+    std::string path = Flight::writeDump("api");
+    assert(!path.empty());
+    assert(path.find("-api.json") != std::string::npos);
+    std::ifstream dumped(path);
+    std::stringstream contents;
+    contents << dumped.rdbuf();
+    assert(parse(contents.str())["otherData"]["reason"].asString() == "api");
+    assert(::access((path + ".tmp").c_str(), F_OK) != 0);
+    assert(Flight::statusToJson()["dumps_written"].asUInt64() == 1);
+
+    // We expect the watchdog to flag a rate drop and write an anomaly dump
+    Flight::WatchdogConfig config;
+    config.sample_interval_ms = 50;
+    config.warmup_samples = 3;
+    config.min_events_per_second = 100.0;
+    config.cooldown_seconds = 0;
+    Flight::startWatchdog(config);
+    auto until = std::chrono::steady_clock::now() + std::chrono::milliseconds(400);
+    while (std::chrono::steady_clock::now() < until) {
+        Perf::recordPhase(Perf::Phase::Generate, 1000, nullptr);
+        std::this_thread::sleep_for(std::chrono::microseconds(500));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    Flight::requestDump("signal");
+    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+    Flight::stopWatchdog();
+
+    Json::Value status = Flight::statusToJson();
+    assert(status["watchdog"]["anomalies"].asUInt64() >= 1);
+    assert(status["watchdog"]["last_anomaly"].asString().find("event_rate_drop") == 0);
+    assert(status["dumps_written"].asUInt64() >= 3);
+
+    bool signal_dump = false;
+    if (DIR* listing = ::opendir(directory)) {
+        while (dirent* entry = ::readdir(listing)) {
+            signal_dump = signal_dump || std::string(entry->d_name).find("-signal.json") != std::string::npos;
+        }
+        ::closedir(listing);
+    }
+    assert(signal_dump);
+
+    std::string cleanup = std::string("rm -rf ") + directory;
+    if (std::system(cleanup.c_str()) != 0) {
+        std::cerr << "cannot remove " << directory << std::endl;
+    }
+
+    std::cout << "flight recorder tests passed" << std::endl;
+    return 0;
+}
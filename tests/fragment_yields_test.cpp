@@ -0,0 +1,153 @@
+/*
+ * File: tests/fragment_yields_test.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Fragment Yields Tests
+ * Purpose: Verifies that alias tables reproduce their weights, that model and file yields
+ *          conserve mass and charge with a double-humped mass distribution, and that the
+ *          engine samples its fragments from the configured yields
+ * Reason: Fragment splits now come from alias-table yields instead of a fixed mass ratio
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ * - 2026-10-17: near() and throws() come from test.helpers.h
+ */
+
+#include "fragment.yields.h"
+#include "random.samplers.h"
+#include "ternary.fission.simulation.engine.h"
+#include "test.helpers.h"
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace TernaryFission;
+using namespace TernaryFission::Testing;
+
+namespace {
+
+double expectedLightMass(const FragmentYields& yields) {
+    double mean = 0.0;
+    for (std::size_t i = 0; i < yields.size(); ++i) {
+        mean += yields.probability(i) * yields.pair(i).light_mass_number;
+    }
+    return mean;
+}
+
+double meanLightMass(TernaryFissionSimulationEngine& engine, std::vector<TernaryFissionEvent>& events) {
+    engine.generateFissionEvents(events.data(), events.size(), 235.0, 6.5);
+    double mean = 0.0;
+    for (const TernaryFissionEvent& event : events) {
+        assert(event.light_fragment.mass_number + event.heavy_fragment.mass_number == 231);
+        assert(event.light_fragment.atomic_number + event.heavy_fragment.atomic_number == 90);
+        mean += event.light_fragment.mass_number;
+    }
+    return mean / static_cast<double>(events.size());
+}
+
+} // namespace
+
+int main() {
+    Sampling::seedThread(73);
+    Sampling::Xoshiro256& rng = Sampling::threadSampler().scalar;
+
+    // We reproduce the weights exactly, including a zero weight, and in sampled frequencies
+    const std::vector<double> weights = {1.0, 2.0, 3.0, 0.0, 4.0};
+    AliasTable table(weights);
+    assert(table.size() == weights.size());
+    std::vector<std::size_t> counts(weights.size(), 0);
+    const std::size_t kDraws = 1000000;
+    for (std::size_t i = 0; i < kDraws; ++i) {
+        ++counts[table.sample(rng())];
+    }
+    for (std::size_t i = 0; i < weights.size(); ++i) {
+        assert(near(table.probability(i), weights[i] / 10.0, 1e-9));
+        assert(near(static_cast<double>(counts[i]) / kDraws, weights[i] / 10.0, 0.003));
+    }
+    assert(counts[3] == 0);
+    assert(throws([] { AliasTable empty(std::vector<double>{}); }));
+    assert(throws([] { AliasTable negative(std::vector<double>{1.0, -1.0}); }));
+    assert(throws([] { AliasTable zero(std::vector<double>{0.0, 0.0}); }));
+
+    // We conserve A and Z after the alpha and show both humps with a valley between
+    std::shared_ptr<const FragmentYields> yields = FragmentYields::build(92, 235, FragmentYieldModel());
+    assert(yields->parentAtomicNumber() == 92 && yields->parentMassNumber() == 235);
+    std::map<int, double> mass_yield;
+    double total = 0.0;
+    for (std::size_t i = 0; i < yields->size(); ++i) {
+        const FragmentPair& pair = yields->pair(i);
+        assert(pair.light_mass_number + pair.heavy_mass_number == 231);
+        assert(pair.light_atomic_number + pair.heavy_atomic_number == 90);
+        assert(pair.light_mass_number <= pair.heavy_mass_number);
+        mass_yield[pair.light_mass_number] += yields->probability(i);
+        mass_yield[pair.heavy_mass_number] += yields->probability(i);
+        total += yields->probability(i);
+    }
+    assert(near(total, 1.0, 1e-9));
+    assert(mass_yield[93] > 20.0 * mass_yield[115]);
+    assert(mass_yield[138] > 20.0 * mass_yield[115]);
+    assert(mass_yield[93] > mass_yield[80] && mass_yield[138] > mass_yield[155]);
+    assert(throws([] { FragmentYields::build(3, 6, FragmentYieldModel()); }));
+    FragmentYieldModel flat;
+    flat.light_fragment_sigma = 0.0;
+    assert(throws([&flat] { FragmentYields::build(92, 235, flat); }));
+
+    // We read tabulated yields, skipping comments, and reject malformed lines
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "fragment_yields_test.yields";
+    {
+        std::ofstream file(path);
+        file << "# A Z yield for the light fragment\n95 37 3.0\n\n100 40 1.0  # trailing comment\n";
+    }
+    FragmentYieldModel tabulated;
+    tabulated.yield_file = path.string();
+    std::shared_ptr<const FragmentYields> from_file = FragmentYields::build(92, 235, tabulated);
+    assert(from_file->size() == 2);
+    assert(from_file->pair(0).heavy_mass_number == 136 && from_file->pair(0).heavy_atomic_number == 53);
+    assert(near(from_file->probability(0), 0.75, 1e-9));
+    {
+        std::ofstream file(path);
+        file << "95 37\n";
+    }
+    assert(throws([&tabulated] { FragmentYields::build(92, 235, tabulated); }));
+    std::remove(path.string().c_str());
+    assert(throws([&tabulated] { FragmentYields::build(92, 235, tabulated); }));
+
+    // We sample engine events from the configured yields, batch and single
+    TernaryFissionSimulationEngine engine(235.0, 6.5, 1);
+    std::vector<TernaryFissionEvent> events(20000);
+    std::shared_ptr<const FragmentYields> configured = engine.getFragmentYields();
+    assert(configured);
+    assert(near(meanLightMass(engine, events), expectedLightMass(*configured), 0.2));
+
+    FragmentYieldModel shifted;
+    shifted.light_fragment_mean = 100.0;
+    shifted.light_fragment_sigma = 2.0;
+    shifted.heavy_fragment_mean = 131.0;
+    shifted.heavy_fragment_sigma = 2.0;
+    engine.configureFragmentYields(shifted);
+    assert(near(meanLightMass(engine, events), 100.0, 0.1));
+    const TernaryFissionEvent single = engine.generateFissionEvent(235.0, 6.5);
+    assert(single.light_fragment.mass_number + single.heavy_fragment.mass_number == 231);
+
+    // We keep the current table when a new model fails to build
+    configured = engine.getFragmentYields();
+    assert(throws([&engine, &tabulated] { engine.configureFragmentYields(tabulated); }));
+    assert(engine.getFragmentYields() == configured);
+
+    // We fall back to the legacy mass ratio for a parent the table does not cover
+    const TernaryFissionEvent other = engine.generateFissionEvent(240.0, 6.5);
+    assert(other.light_fragment.atomic_number + other.heavy_fragment.atomic_number == 90);
+    assert(near(other.light_fragment.mass + other.heavy_fragment.mass + other.alpha_particle.mass, 240.0, 1e-9));
+
+    engine.shutdown();
+    std::cout << "fragment yields tests passed (" << yields->size() << " pairs for U-235)" << std::endl;
+    return 0;
+}
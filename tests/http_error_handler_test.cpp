@@ -0,0 +1,88 @@
+/*
+ * File: tests/http_error_handler_test.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: HTTP Error Handler Tests
+ * Purpose: Verifies that the server error handler keeps the status and JSON body a handler
+ *          already sent and only fills in responses that carry no body
+ * Reason: The error handler used to rewrite every 4xx/5xx response to a 500
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ */
+
+#include "config.ternary.fission.server.h"
+#include "http.ternary.fission.server.h"
+#include "ternary.fission.simulation.engine.h"
+
+#include <httplib.h>
+#include <json/json.h>
+
+#include <unistd.h>
+
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace TernaryFission;
+
+namespace {
+
+Json::Value parseBody(const std::string& body) {
+    Json::Value json;
+    Json::CharReaderBuilder builder;
+    std::istringstream stream(body);
+    std::string errors;
+    assert(Json::parseFromStream(builder, stream, &json, &errors));
+    return json;
+}
+
+} // namespace
+
+int main() {
+    const int port = 20000 + static_cast<int>(::getpid() % 20000);
+    ::setenv("TERNARY_BIND_IP", "127.0.0.1", 1);
+    ::setenv("TERNARY_BIND_PORT", std::to_string(port).c_str(), 1);
+
+    auto engine = std::make_shared<TernaryFissionSimulationEngine>(235.0, 6.5, 1);
+    auto server = std::make_unique<HTTPTernaryFissionServer>(std::make_unique<ConfigurationManager>(""));
+    server->setSimulationEngine(engine);
+    assert(server->initialize());
+    std::thread server_thread([&server]() { server->start(); });
+
+    httplib::Client client("127.0.0.1", port);
+    bool ready = false;
+    for (int attempt = 0; attempt < 50 && !ready; ++attempt) {
+        ready = static_cast<bool>(client.Get("/api/v1/health"));
+        if (!ready) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+    }
+    assert(ready);
+
+    // We keep a handler's own 400 and message instead of rewriting them to a 500
+    auto invalid = client.Post("/api/v1/physics/fission", "not json", "application/json");
+    assert(invalid && invalid->status == 400);
+    Json::Value invalid_body = parseBody(invalid->body);
+    assert(invalid_body["error"].asString() == "Invalid JSON payload");
+    assert(invalid_body["status_code"].asInt() == 400);
+
+    // We fill in a JSON error, with the original status, for responses that have no body
+    auto missing = client.Get("/api/v1/no-such-endpoint");
+    assert(missing && missing->status == 404);
+    Json::Value missing_body = parseBody(missing->body);
+    assert(missing_body["error"].asString() == "Not found");
+    assert(missing_body["status_code"].asInt() == 404);
+
+    server->stop();
+    server_thread.join();
+    engine->shutdown();
+
+    std::cout << "http error handler tests passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,125 @@
+/*
+ * File: tests/memory_governor_test.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Memory Governor Tests
+ * Purpose: Verifies reject, shrink and both evict policies at the field memory cap,
+ *          watermark reclamation and that committed bytes return to zero
+ * Reason: The governor is what keeps a burst of high-energy events from OOM-killing us
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ */
+
+#include "memory.governor.h"
+#include "ternary.fission.simulation.engine.h"
+
+#include <json/json.h>
+
+#include <cassert>
+#include <iostream>
+#include <set>
+
+using namespace TernaryFission;
+
+static const std::uint64_t kCap = 64ULL * 1024 * 1024;
+
+static void configure(Governor::Policy policy, double high = 0.90, double low = 0.75) {
+    Governor::Settings settings;
+    settings.max_bytes = kCap;
+    settings.policy = policy;
+    settings.high_watermark = high;
+    settings.low_watermark = low;
+    Governor::configure(settings);
+}
+
+static Json::Value createField(TernaryFissionSimulationEngine& engine, double energy_mev) {
+    Json::Value request;
+    request["energy_mev"] = energy_mev;
+    return engine.createEnergyFieldAPI(request);
+}
+
+static std::multiset<double> liveEnergies(const TernaryFissionSimulationEngine& engine) {
+    std::multiset<double> energies;
+    Json::Value fields = engine.getEnergyFieldsAPI()["energy_fields"];
+    for (const auto& field : fields) {
+        energies.insert(field["energy_mev"].asDouble());
+    }
+    return energies;
+}
+
+int main() {
+    assert(Governor::limitBytes() == 0);
+
+    // We refuse a field that does not fit under the reject policy
+    configure(Governor::Policy::Reject);
+    EnergyField first = createEnergyField(30.0);
+    EnergyField second = createEnergyField(30.0);
+    assert(Governor::committedBytes() == 60000000);
+    bool rejected = false;
+    try {
+        createEnergyField(30.0);
+    } catch (const Governor::MemoryBudgetExceeded&) {
+        rejected = true;
+    }
+    assert(rejected);
+    assert(Governor::committedBytes() == 60000000);
+
+    // We materialize only what fits under the shrink policy
+    configure(Governor::Policy::Shrink);
+    EnergyField shrunk = createEnergyField(30.0);
+    assert(shrunk.memory_ptr != nullptr);
+    assert(shrunk.memory_requested_bytes == 30000000);
+    assert(shrunk.memory_bytes == kCap - 60000000);
+    assert(Governor::committedBytes() == kCap);
+    releaseEnergyField(shrunk);
+    releaseEnergyField(second);
+    releaseEnergyField(first);
+    assert(Governor::committedBytes() == 0);
+
+    Json::Value decisions = Governor::statsToJson()["decisions"];
+    assert(decisions["rejected"].asUInt64() == 1);
+    assert(decisions["shrunk"].asUInt64() == 1);
+    assert(decisions["shrunk_bytes"].asUInt64() == 30000000 - (kCap - 60000000));
+
+    {
+        TernaryFissionSimulationEngine engine(235.0, 6.5, 1);
+
+        // We evict the lowest-energy fields first to make room
+        configure(Governor::Policy::EvictLowestEnergy);
+        createField(engine, 10.0);
+        createField(engine, 20.0);
+        createField(engine, 30.0);
+        Json::Value created = createField(engine, 25.0);
+        assert(created["status"].asString() == "success");
+        assert((liveEnergies(engine) == std::multiset<double>{25.0, 30.0}));
+        assert(Governor::committedBytes() == 55000000);
+
+        // We evict the oldest fields first under evict_oldest
+        configure(Governor::Policy::EvictOldest);
+        created = createField(engine, 20.0);
+        assert(created["status"].asString() == "success");
+        assert((liveEnergies(engine) == std::multiset<double>{25.0, 20.0}));
+
+        // We reclaim down to the low watermark in the background pass
+        configure(Governor::Policy::EvictLowestEnergy, 0.5, 0.25);
+        assert(Governor::reclaimToWatermark() == 45000000);
+        assert(liveEnergies(engine).empty());
+        assert(Governor::committedBytes() == 0);
+
+        // We report a rejection as an API error
+        configure(Governor::Policy::Reject);
+        created = createField(engine, 100.0);
+        assert(created["status"].asString() == "error");
+    }
+    assert(Governor::committedBytes() == 0);
+
+    decisions = Governor::statsToJson()["decisions"];
+    assert(decisions["evicted_fields"].asUInt64() == 5);
+    assert(decisions["background_reclaims"].asUInt64() == 1);
+    assert(Governor::toPrometheus().find("ternary_fission_field_memory_decisions_total{decision=\"shrunk\"} 1") !=
+           std::string::npos);
+
+    std::cout << "memory governor tests passed" << std::endl;
+    return 0;
+}
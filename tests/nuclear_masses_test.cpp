@@ -0,0 +1,98 @@
+/*
+ * File: tests/nuclear_masses_test.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Nuclear Masses Tests
+ * Purpose: Verifies the binding energy and mass excess table against measured nuclei and
+ *          that engine events carry fragment binding energies and table Q-values
+ * Reason: Fragment binding energies and Q-values now come from the (Z, A) mass table
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ * - 2026-10-17: near() comes from test.helpers.h
+ */
+
+#include "nuclear.masses.h"
+#include "physics.utilities.h"
+#include "random.samplers.h"
+#include "ternary.fission.simulation.engine.h"
+#include "test.helpers.h"
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace TernaryFission;
+using namespace TernaryFission::Testing;
+
+int main() {
+    Sampling::seedThread(74);
+    const NuclearMassTable& masses = NuclearMassTable::instance();
+    assert(&masses == &NuclearMassTable::instance());
+
+    // We cover every Z of every A up to the limit and nothing outside it
+    assert(NuclearMassTable::covers(0, 1) && NuclearMassTable::covers(300, 300));
+    assert(!NuclearMassTable::covers(0, 0) && !NuclearMassTable::covers(0, 301));
+    assert(!NuclearMassTable::covers(93, 92) && !NuclearMassTable::covers(-1, 10));
+
+    // We use measured light nuclei and the formula elsewhere, within 1% of measurement
+    assert(masses.at(0, 1).binding_energy == 0.0 && masses.at(1, 1).binding_energy == 0.0);
+    assert(near(masses.at(2, 4).binding_energy, 28.296, 1e-3));
+    assert(near(masses.at(1, 2).binding_energy, 2.225, 1e-3));
+    assert(masses.at(92, 235).binding_energy == NuclearMassTable::semiEmpiricalBindingEnergy(92, 235));
+    assert(near(masses.at(92, 235).binding_energy, 1783.9, 17.8));
+    assert(near(masses.at(26, 56).binding_energy, 492.3, 4.9));
+    assert(near(masses.at(82, 208).binding_energy, 1636.4, 16.4));
+
+    // We peak the binding energy per nucleon in the iron region
+    const double iron = masses.at(26, 56).binding_energy / 56.0;
+    assert(iron > 8.5 && iron > masses.at(92, 235).binding_energy / 235.0);
+    assert(iron > masses.at(8, 16).binding_energy / 16.0);
+
+    // We derive mass excesses from the same binding energies
+    assert(near(masses.at(1, 1).mass_excess, NuclearMassTable::kHydrogenMassExcess, 1e-12));
+    assert(near(masses.at(0, 1).mass_excess, NuclearMassTable::kNeutronMassExcess, 1e-12));
+    assert(near(masses.at(2, 4).mass_excess, 2.4249, 1e-3));
+    assert(near(masses.at(92, 235).mass_excess, 40.92, 15.0));
+
+    // We release about 170-200 MeV in a typical U-235 ternary split, from either column
+    const NuclearMass& parent = masses.at(92, 235);
+    const NuclearMass& light = masses.at(37, 93);
+    const NuclearMass& heavy = masses.at(53, 138);
+    const NuclearMass& alpha = masses.at(2, 4);
+    const double q_binding = light.binding_energy + heavy.binding_energy + alpha.binding_energy -
+                             parent.binding_energy;
+    const double q_excess = parent.mass_excess - light.mass_excess - heavy.mass_excess - alpha.mass_excess;
+    assert(q_binding > 150.0 && q_binding < 230.0);
+    assert(near(q_binding, q_excess, 1e-9));
+
+    // We fill fragment binding energies and take Q-values from the table in engine events
+    TernaryFissionSimulationEngine engine(235.0, 6.5, 1);
+    std::vector<TernaryFissionEvent> events(2000);
+    engine.generateFissionEvents(events.data(), events.size(), 235.0, 6.5);
+    for (const TernaryFissionEvent& event : events) {
+        const NuclearMass& l = masses.at(event.light_fragment.atomic_number, event.light_fragment.mass_number);
+        const NuclearMass& h = masses.at(event.heavy_fragment.atomic_number, event.heavy_fragment.mass_number);
+        assert(event.light_fragment.binding_energy == l.binding_energy);
+        assert(event.heavy_fragment.binding_energy == h.binding_energy);
+        assert(event.alpha_particle.binding_energy == alpha.binding_energy);
+        assert(near(event.q_value,
+                    6.5 + l.binding_energy + h.binding_energy + alpha.binding_energy - parent.binding_energy,
+                    1e-9));
+        assert(near(event.light_fragment.mass,
+                    event.light_fragment.mass_number + l.mass_excess / AMU_TO_MEV, 1e-12));
+        assert(event.q_value > 100.0);
+        assert(event.energy_conserved && event.momentum_conserved);
+    }
+
+    // We keep the mass-deficit Q-value for a parent the yield table does not cover
+    const TernaryFissionEvent other = engine.generateFissionEvent(240.0, 6.5);
+    assert(near(other.q_value, 6.5, 1e-6));
+    assert(other.alpha_particle.binding_energy == alpha.binding_energy);
+
+    engine.shutdown();
+    std::cout << "nuclear masses tests passed (U-235 B=" << parent.binding_energy << " MeV, split Q="
+              << q_binding << " MeV)" << std::endl;
+    return 0;
+}
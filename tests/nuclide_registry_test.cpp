@@ -0,0 +1,187 @@
+/*
+ * File: tests/nuclide_registry_test.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Nuclide Registry Tests
+ * Purpose: Verifies symbol parsing, the precomputed per-parent data, and that single,
+ *          uniform and mixed-parent batches generate each event from its own parent
+ * Reason: Parents now come from a nuclide registry instead of a hard-coded Z = 92
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ * - 2026-10-17: near() and throws() come from test.helpers.h
+ * - 2026-10-17: Mass-only calls resolve Pu-239 and Cf-252; the JSON API takes "nuclide"
+ * - 2026-10-17: Grouped single-parent batches and the API's event count
+ */
+
+#include "nuclear.masses.h"
+#include "nuclide.registry.h"
+#include "random.samplers.h"
+#include "ternary.fission.simulation.engine.h"
+#include "test.helpers.h"
+
+#include <json/json.h>
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace TernaryFission;
+using namespace TernaryFission::Testing;
+
+namespace {
+
+void assertFromParent(const TernaryFissionEvent& event, const Nuclide& nuclide, double excitation_energy) {
+    const NuclearMassTable& masses = NuclearMassTable::instance();
+    assert(event.parent_atomic_number == nuclide.atomic_number);
+    assert(event.parent_mass_number == nuclide.mass_number);
+    assert(event.light_fragment.mass_number + event.heavy_fragment.mass_number == nuclide.mass_number - 4);
+    assert(event.light_fragment.atomic_number + event.heavy_fragment.atomic_number == nuclide.atomic_number - 2);
+    const double q_value = excitation_energy + event.light_fragment.binding_energy +
+                           event.heavy_fragment.binding_energy + masses.at(2, 4).binding_energy -
+                           nuclide.binding_energy;
+    assert(near(event.q_value, q_value, 1e-9));
+    assert(event.energy_conserved && event.momentum_conserved);
+}
+
+} // namespace
+
+int main() {
+    Sampling::seedThread(75);
+
+    // We parse symbols case-insensitively, with or without the dash
+    int z = 0;
+    int a = 0;
+    assert(NuclideRegistry::parseSymbol("Cf-252", z, a) && z == 98 && a == 252);
+    assert(NuclideRegistry::parseSymbol("pu239", z, a) && z == 94 && a == 239);
+    assert(NuclideRegistry::parseSymbol("U-235", z, a) && z == 92 && a == 235);
+    assert(!NuclideRegistry::parseSymbol("Xx-100", z, a));
+    assert(!NuclideRegistry::parseSymbol("U-", z, a));
+    assert(!NuclideRegistry::parseSymbol("U-235m", z, a));
+    assert(!NuclideRegistry::parseSymbol("U-50", z, a));
+    assert(!NuclideRegistry::parseSymbol("", z, a));
+    assert(NuclideRegistry::symbolFor(98, 252) == "Cf-252");
+
+    // We precompute Z, A, mass, Q constants and yields for each built-in parent
+    TernaryFissionSimulationEngine engine(235.0, 6.5, 1);
+    std::shared_ptr<const NuclideRegistry> registry = engine.getNuclideRegistry();
+    assert(registry && registry->size() >= 5);
+    assert(registry->defaultNuclide().symbol == "U-235");
+    assert(engine.getFragmentYields() == registry->defaultNuclide().yields);
+    const NuclearMassTable& masses = NuclearMassTable::instance();
+    for (const char* symbol : {"U-233", "U-235", "Pu-239", "Pu-241", "Cf-252"}) {
+        const Nuclide* nuclide = registry->find(symbol);
+        assert(nuclide && nuclide->symbol == symbol);
+        assert(registry->find(nuclide->atomic_number, nuclide->mass_number) == nuclide);
+        assert(&registry->at(registry->indexOf(*nuclide)) == nuclide);
+        assert(nuclide->yields->parentAtomicNumber() == nuclide->atomic_number);
+        assert(nuclide->yields->parentMassNumber() == nuclide->mass_number);
+        assert(near(nuclide->mass, nuclide->mass_number, 0.1));
+        assert(near(nuclide->q_value_offset,
+                    masses.at(2, 4).binding_energy - masses.at(nuclide->atomic_number, nuclide->mass_number).binding_energy,
+                    1e-9));
+        assert(nuclide->ternary_probability > 1e-3 && nuclide->ternary_probability < 1e-2);
+        assert(nuclide->alpha_fraction > 0.8 && nuclide->alpha_fraction < 1.0);
+    }
+    assert(registry->find("cf252") == registry->find("Cf-252"));
+    assert(registry->find("U-240") == nullptr && registry->find("Fe-56") == nullptr);
+
+    // We generate a uniform batch from its parent's yields: Cf-252 splits around A = 106
+    const Nuclide& californium = *registry->find("Cf-252");
+    std::vector<TernaryFissionEvent> events(4000);
+    engine.generateFissionEvents(events.data(), events.size(), californium, 0.0);
+    double light_mass = 0.0;
+    for (const TernaryFissionEvent& event : events) {
+        assertFromParent(event, californium, 0.0);
+        light_mass += event.light_fragment.mass_number;
+    }
+    assert(near(light_mass / events.size(), 106.0, 3.0));
+    assertFromParent(engine.generateFissionEvent(californium, 1.0), californium, 1.0);
+
+    // We write mixed batches back in request order, each event from its own parent
+    const Nuclide& uranium = *registry->find("U-235");
+    const Nuclide& plutonium = *registry->find("Pu-239");
+    std::vector<std::size_t> parents(events.size());
+    const std::size_t order[] = {registry->indexOf(plutonium), registry->indexOf(uranium),
+                                 registry->indexOf(californium)};
+    for (std::size_t i = 0; i < parents.size(); ++i) {
+        parents[i] = order[(i * 7) % 3];
+    }
+    engine.generateFissionEvents(events.data(), parents.data(), events.size(), *registry, 6.5);
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        assertFromParent(events[i], registry->at(parents[i]), 6.5);
+    }
+    parents[17] = registry->size();
+    assert(throws([&] { engine.generateFissionEvents(events.data(), parents.data(), events.size(), *registry, 6.5); }));
+
+    // We resolve mass-only calls by A across the registry and keep the default element otherwise
+    const TernaryFissionEvent u233 = engine.generateFissionEvent(233.0, 6.5);
+    assertFromParent(u233, *registry->find("U-233"), 6.5);
+    assertFromParent(engine.generateFissionEvent(239.05, 6.5), plutonium, 6.5);
+    assertFromParent(engine.generateFissionEvent(252.08, 6.5), californium, 6.5);
+    engine.generateFissionEvents(events.data(), 64, 252.08, 6.5);
+    for (std::size_t i = 0; i < 64; ++i) {
+        assertFromParent(events[i], californium, 6.5);
+    }
+    assert(registry->findByMassNumber(235) == &registry->defaultNuclide());
+    assert(registry->findByMassNumber(240) == nullptr);
+    const TernaryFissionEvent u240 = engine.generateFissionEvent(240.0, 6.5);
+    assert(u240.parent_atomic_number == 92 && u240.parent_mass_number == 240);
+
+    // We simulate named parents through the engine and reject unknown ones up front
+    g_energy_field_config.memory_per_mev = 1000.0;
+    const std::vector<std::string> names = {"Cf-252", "U-235", "cf252", "Pu-239", "U-235"};
+    const std::vector<TernaryFissionEvent> simulated = engine.simulateTernaryFissionEvents(names, 6.5);
+    assert(simulated.size() == names.size());
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        assertFromParent(simulated[i], *registry->find(names[i]), 6.5);
+    }
+    assert(engine.simulateTernaryFissionEvent("Pu-241", 6.5).parent_atomic_number == 94);
+    bool rejected = false;
+    try {
+        engine.simulateTernaryFissionEvents({"U-235", "Xx-1"}, 6.5);
+    } catch (const std::invalid_argument&) {
+        rejected = true;
+    }
+    assert(rejected);
+
+    // We generate count events of one parent in a single batch
+    const std::vector<TernaryFissionEvent> grouped =
+        engine.simulateTernaryFissionEvents(*registry->find("Cf-252"), 300, 6.5);
+    assert(grouped.size() == 300);
+    for (const TernaryFissionEvent& event : grouped) {
+        assertFromParent(event, *registry->find("Cf-252"), 6.5);
+    }
+
+    // We take a named parent in the JSON API and reject unknown ones
+    Json::Value request;
+    request["nuclide"] = "pu239";
+    request["num_events"] = 3;
+    const std::uint64_t simulated_before = engine.getTotalEventsSimulated();
+    Json::Value response = engine.simulateTernaryFissionEventAPI(request);
+    assert(response["status"].asString() == "success" && response["events"].size() == 3);
+    for (const Json::Value& event : response["events"]) {
+        assert(event["nuclide"].asString() == "Pu-239");
+    }
+    assert(engine.getTotalEventsSimulated() == simulated_before + 3);
+    request["nuclide"] = "Xx-1";
+    assert(engine.simulateTernaryFissionEventAPI(request)["status"].asString() == "error");
+
+    // We rebuild the registry with a new default model and leave the other parents as built in
+    FragmentYieldModel shifted;
+    shifted.light_fragment_mean = 100.0;
+    engine.configureFragmentYields(shifted);
+    std::shared_ptr<const NuclideRegistry> rebuilt = engine.getNuclideRegistry();
+    assert(rebuilt != registry);
+    assert(rebuilt->find("Cf-252")->yields->size() == californium.yields->size());
+    assert(rebuilt->defaultNuclide().yields->size() != uranium.yields->size() ||
+           rebuilt->defaultNuclide().yields->probability(0) != uranium.yields->probability(0));
+
+    engine.shutdown();
+    std::cout << "nuclide registry tests passed (" << registry->size() << " parents)" << std::endl;
+    return 0;
+}
@@ -0,0 +1,182 @@
+/*
+ * File: tests/portal_timer_test.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Portal Timer Tests
+ * Purpose: Verifies timer wheel ordering, rescheduling, cancellation and multi-round
+ *          deadlines, and that engine portal loads run concurrently, extend, cancel and
+ *          expire with their own fields
+ * Reason: Portal loads moved from a sleeping thread per trigger to one timer wheel
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ * - 2026-10-17: Governor rejections of portal starts and extensions throw
+ * - 2026-10-17: Portals extended to deadlines that fall between milliseconds still expire
+ */
+
+#include "memory.governor.h"
+#include "physics.utilities.h"
+#include "ternary.fission.simulation.engine.h"
+#include "timer.wheel.h"
+
+#include <json/json.h>
+
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace TernaryFission;
+
+static std::mutex g_mutex;
+static std::vector<std::pair<std::uint64_t, std::chrono::steady_clock::time_point>> g_fired;
+
+static void waitUntilIdle(const TimerWheel& wheel) {
+    for (int i = 0; i < 400 && wheel.pending() > 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+}
+
+static std::int64_t totalFields(const TernaryFissionSimulationEngine& engine) {
+    return engine.getEnergyFieldsAPI()["total_fields"].asInt64();
+}
+
+int main() {
+    // We fire in deadline order, never early, across more than one rotation
+    {
+        TimerWheel wheel(std::chrono::milliseconds(5), 8, [](std::uint64_t timer_id) {
+            std::lock_guard<std::mutex> lock(g_mutex);
+            g_fired.emplace_back(timer_id, std::chrono::steady_clock::now());
+        });
+        const auto start = std::chrono::steady_clock::now();
+        wheel.schedule(1, std::chrono::milliseconds(30));
+        wheel.schedule(2, std::chrono::milliseconds(10));
+        wheel.schedule(3, std::chrono::milliseconds(60));
+        wheel.schedule(4, std::chrono::milliseconds(20));
+        wheel.schedule(2, std::chrono::milliseconds(50));
+        const bool cancelled = wheel.cancel(4);
+        assert(cancelled);
+        assert(wheel.pending() == 3);
+        waitUntilIdle(wheel);
+
+        std::lock_guard<std::mutex> lock(g_mutex);
+        assert(g_fired.size() == 3);
+        const std::uint64_t order[] = {1, 2, 3};
+        const int delays_ms[] = {30, 50, 60};
+        for (std::size_t i = 0; i < g_fired.size(); ++i) {
+            assert(g_fired[i].first == order[i]);
+            assert(g_fired[i].second - start >= std::chrono::milliseconds(delays_ms[i]));
+        }
+        const bool fired_again = wheel.cancel(1);
+        assert(!fired_again);
+        Json::Value stats = wheel.statsToJson();
+        assert(stats["scheduled"].asUInt64() == 4);
+        assert(stats["rescheduled"].asUInt64() == 1);
+        assert(stats["cancelled"].asUInt64() == 1);
+        assert(stats["fired"].asUInt64() == 3);
+    }
+
+    // We discard armed timers on stop
+    {
+        TimerWheel wheel(std::chrono::milliseconds(5), 8, [](std::uint64_t) {
+            assert(false);
+        });
+        wheel.schedule(1, std::chrono::milliseconds(1000));
+        wheel.stop();
+        assert(wheel.pending() == 0);
+    }
+
+    // We run concurrent portals, each with its own fields
+    g_energy_field_config.memory_per_mev = 1000.0;
+    g_energy_field_config.cpu_cycles_per_mev = 1000.0;
+    {
+        TernaryFissionSimulationEngine engine(235.0, 6.5, 1);
+        engine.configureFieldFill(0, 0);
+
+        const std::uint64_t short_portal = engine.startPortalLoad(0.2, 5.0);
+        const std::uint64_t long_portal = engine.startPortalLoad(30.0, 5.0);
+        assert(short_portal != 0 && long_portal != 0 && short_portal != long_portal);
+        assert(totalFields(engine) == 2);
+
+        double estimated = 0.0;
+        int remaining = 0;
+        engine.getPortalEventState(estimated, remaining);
+        const double expected = calculateEstimatedPower(5.0, 0, 0.0) + calculateEstimatedPower(5.0, 30, 0.0);
+        assert(std::fabs(estimated - expected) < 1e-9);
+        assert(remaining >= 28 && remaining <= 30);
+
+        // We extend by added power: doubling the power doubles the scheduled duration
+        const bool extended = engine.extendPortalLoad(long_portal, 5.0);
+        assert(extended);
+        const bool extended_missing = engine.extendPortalLoad(12345, 5.0);
+        assert(!extended_missing);
+        assert(totalFields(engine) == 3);
+        engine.getPortalEventState(estimated, remaining);
+        assert(remaining >= 58 && remaining <= 60);
+
+        // We let governor rejections through so they are not mistaken for an unknown portal
+        Governor::Settings settings;
+        settings.max_bytes = Governor::committedBytes() + 1;
+        Governor::configure(settings);
+        bool start_rejected = false;
+        bool extend_rejected = false;
+        try {
+            engine.startPortalLoad(30.0, 5.0);
+        } catch (const Governor::MemoryBudgetExceeded&) {
+            start_rejected = true;
+        }
+        try {
+            engine.extendPortalLoad(long_portal, 5.0);
+        } catch (const Governor::MemoryBudgetExceeded&) {
+            extend_rejected = true;
+        }
+        assert(start_rejected && extend_rejected);
+        assert(totalFields(engine) == 3);
+        Governor::configure(Governor::Settings());
+
+        // We expire the short portal from the wheel and keep the long one
+        for (int i = 0; i < 100 && totalFields(engine) > 2; ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        Json::Value loads = engine.getPortalLoadsAPI();
+        assert(loads["active_portals"].asUInt() == 1);
+        assert(loads["portals"][0]["portal_id"].asUInt64() == long_portal);
+        assert(loads["portals"][0]["field_ids"].size() == 2);
+        assert(loads["portals"][0]["additional_power_mev"].asDouble() == 5.0);
+        assert(loads["timers"]["fired"].asUInt64() == 1);
+        assert(totalFields(engine) == 2);
+
+        // We cancel the long portal and release its fields
+        const bool cancelled = engine.cancelPortalLoad(long_portal);
+        assert(cancelled);
+        const bool cancelled_again = engine.cancelPortalLoad(long_portal);
+        assert(!cancelled_again);
+        assert(totalFields(engine) == 0);
+        engine.getPortalEventState(estimated, remaining);
+        assert(estimated == 0.0 && remaining == 0);
+
+        // We expire portals extended to deadlines between whole milliseconds
+        for (int i = 0; i < 8; ++i) {
+            const std::uint64_t portal = engine.startPortalLoad(0.1, 3.0);
+            std::this_thread::sleep_for(std::chrono::microseconds(370 * i + 130));
+            const bool portal_extended = engine.extendPortalLoad(portal, 1.0);
+            assert(portal_extended);
+        }
+        for (int i = 0; i < 100 && engine.getPortalLoadsAPI()["active_portals"].asUInt() > 0; ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        assert(engine.getPortalLoadsAPI()["active_portals"].asUInt() == 0);
+        assert(totalFields(engine) == 0);
+
+        // We leave a portal armed across shutdown
+        const std::uint64_t armed = engine.startPortalLoad(30.0, 1.0);
+        assert(armed != 0);
+    }
+
+    std::cout << "portal timer tests passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,88 @@
+/*
+ * File: tests/profiled_mutex_test.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Profiled Mutex Tests
+ * Purpose: Verifies acquisition, contention, wait and hold accounting, name sharing
+ *          and reset for ProfiledMutex
+ * Reason: We read /api/v1/profile/locks to pick which lock to split, so the numbers
+ *         must add up
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ */
+
+#include "profiled.mutex.h"
+
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace TernaryFission;
+
+int main() {
+    ProfiledMutex first("test.shared");
+    ProfiledMutex second("test.shared");
+    assert(&first.profile() == &second.profile());
+    assert(lockProfilesToJson()["test.shared"]["instances"].asUInt() == 2);
+
+    // We expect uncontended locks to count without waits
+    for (int i = 0; i < 100; ++i) {
+        std::lock_guard<ProfiledMutex> lock(i % 2 ? first : second);
+    }
+    assert(first.profile().acquisitions() == 100);
+    assert(first.profile().contended() == 0);
+    assert(first.profile().waitNanoseconds() == 0);
+
+    // We hold the lock long enough that every other thread must wait
+    ProfiledMutex hot("test.hot");
+    const int kThreads = 4;
+    const int kIterations = 20;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&hot]() {
+            for (int i = 0; i < kIterations; ++i) {
+                std::lock_guard<ProfiledMutex> lock(hot);
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const LockProfile& profile = hot.profile();
+    assert(profile.acquisitions() == kThreads * kIterations);
+    assert(profile.contended() > 0);
+    assert(profile.waitNanoseconds() > 0);
+    assert(profile.holdNanoseconds() >= kThreads * kIterations * 150000ull);
+
+    Json::Value json = profile.toJson();
+    assert(json["hold_ns_histogram"]["count"].asUInt64() == kThreads * kIterations);
+    assert(json["wait_ns_histogram"]["count"].asUInt64() == profile.contended());
+    assert(json["hold_ns_histogram"]["p50"].asDouble() >= 100000.0);
+
+    // We check the mutex works with condition_variable_any like the engine queue
+    std::condition_variable_any cv;
+    bool ready = false;
+    std::thread notifier([&]() {
+        std::lock_guard<ProfiledMutex> lock(hot);
+        ready = true;
+        cv.notify_one();
+    });
+    {
+        std::unique_lock<ProfiledMutex> lock(hot);
+        cv.wait(lock, [&ready] { return ready; });
+    }
+    notifier.join();
+
+    resetLockProfiles();
+    assert(hot.profile().acquisitions() == 0);
+    assert(hot.profile().toJson()["hold_ns_histogram"]["count"].asUInt64() == 0);
+
+    std::cout << "profiled mutex tests passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,184 @@
+/*
+ * File: tests/random_samplers_test.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Random Sampler Tests
+ * Purpose: Verifies the moments and ranges of the uniform, ziggurat normal and Poisson
+ *          samplers in bulk and scalar form, and that seeding is reproducible per thread
+ * Reason: The physics utilities now draw from these samplers instead of std distributions
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ * - 2026-10-17: Direction sampling: unit length, isotropy, and momentum magnitude
+ * - 2026-10-17: near() comes from test.helpers.h
+ */
+
+#include "physics.utilities.h"
+#include "random.samplers.h"
+#include "test.helpers.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace TernaryFission;
+using namespace TernaryFission::Testing;
+
+namespace {
+
+struct Moments {
+    double mean = 0.0;
+    double variance = 0.0;
+};
+
+template <typename T>
+Moments moments(const std::vector<T>& values) {
+    Moments m;
+    for (T v : values) {
+        m.mean += static_cast<double>(v);
+    }
+    m.mean /= static_cast<double>(values.size());
+    for (T v : values) {
+        const double d = static_cast<double>(v) - m.mean;
+        m.variance += d * d;
+    }
+    m.variance /= static_cast<double>(values.size() - 1);
+    return m;
+}
+
+} // namespace
+
+int main() {
+    const std::size_t kSamples = 1000000;
+    Sampling::seedThread(42);
+
+    // We check the uniform range and its first two moments
+    std::vector<double> uniforms(kSamples);
+    Sampling::fillUniform(uniforms.data(), uniforms.size(), -2.0, 6.0);
+    for (double u : uniforms) {
+        assert(u >= -2.0 && u < 6.0);
+    }
+    Moments m = moments(uniforms);
+    assert(near(m.mean, 2.0, 0.02));
+    assert(near(m.variance, 64.0 / 12.0, 0.05));
+
+    // We check the normal moments, tail mass and that both tails are reached
+    std::vector<double> normals(kSamples);
+    Sampling::fillNormal(normals.data(), normals.size(), 1.5, 2.0);
+    m = moments(normals);
+    assert(near(m.mean, 1.5, 0.01));
+    assert(near(m.variance, 4.0, 0.03));
+    std::size_t beyond_two_sigma = 0;
+    double lowest = 0.0;
+    double highest = 0.0;
+    for (double x : normals) {
+        const double z = (x - 1.5) / 2.0;
+        beyond_two_sigma += std::fabs(z) > 2.0;
+        lowest = std::min(lowest, z);
+        highest = std::max(highest, z);
+    }
+    assert(near(static_cast<double>(beyond_two_sigma) / kSamples, 0.0455, 0.002));
+    assert(lowest < -3.7 && highest > 3.7);
+
+    // We check the scalar ziggurat through normalRandom as the engine calls it
+    std::vector<double> scalar_normals(kSamples);
+    for (double& x : scalar_normals) {
+        x = normalRandom(1.4, 0.15);
+    }
+    m = moments(scalar_normals);
+    assert(near(m.mean, 1.4, 0.001));
+    assert(near(std::sqrt(m.variance), 0.15, 0.001));
+
+    // We check Poisson on both sides of the inversion/PTRS switch
+    for (double lambda : {0.5, 4.0, 9.99, 10.0, 35.0, 400.0}) {
+        std::vector<int> counts(kSamples);
+        Sampling::fillPoisson(counts.data(), counts.size(), lambda);
+        for (int k : counts) {
+            assert(k >= 0);
+        }
+        m = moments(counts);
+        assert(near(m.mean, lambda, 0.01 * lambda + 0.01));
+        assert(near(m.variance, lambda, 0.03 * lambda + 0.01));
+
+        std::vector<int> scalar_counts(kSamples / 10);
+        for (int& k : scalar_counts) {
+            k = poissonRandom(lambda);
+        }
+        m = moments(scalar_counts);
+        assert(near(m.mean, lambda, 0.02 * lambda + 0.02));
+    }
+    assert(poissonRandom(0.0) == 0);
+
+    // We reproduce the same stream after reseeding, including the lanes
+    Sampling::seedThread(7);
+    std::vector<double> first(1000);
+    Sampling::fillNormal(first.data(), first.size());
+    const double first_scalar = uniformRandom();
+    Sampling::seedThread(7);
+    std::vector<double> second(1000);
+    Sampling::fillNormal(second.data(), second.size());
+    assert(first == second);
+    assert(uniformRandom() == first_scalar);
+
+    // We reproduce a seeded stream on another thread, and a different seed differs
+    double other_thread_draw = 0.0;
+    std::thread other([&other_thread_draw] {
+        Sampling::seedThread(7);
+        std::vector<double> draws(1000);
+        Sampling::fillNormal(draws.data(), draws.size());
+        other_thread_draw = draws[0];
+    });
+    other.join();
+    assert(other_thread_draw == first[0]);
+    Sampling::seedThread(8);
+    std::vector<double> third(1000);
+    Sampling::fillNormal(third.data(), third.size());
+    assert(third != first);
+
+    // We check directions are unit vectors with uniform z and zero mean in bulk and scalar form
+    std::vector<double> dx(kSamples);
+    std::vector<double> dy(kSamples);
+    std::vector<double> dz(kSamples);
+    Sampling::fillDirections(dx.data(), dy.data(), dz.data(), 17);
+    Sampling::fillDirections(dx.data() + 17, dy.data() + 17, dz.data() + 17, kSamples - 17);
+    for (std::size_t i = 0; i < kSamples / 2; ++i) {
+        Sampling::direction(Sampling::threadSampler().scalar, dx[i], dy[i], dz[i]);
+    }
+    std::size_t polar_cap = 0;
+    for (std::size_t i = 0; i < kSamples; ++i) {
+        assert(near(dx[i] * dx[i] + dy[i] * dy[i] + dz[i] * dz[i], 1.0, 1e-12));
+        polar_cap += dz[i] > 0.9;
+    }
+    // We expect 5% of isotropic directions in the cap above z = 0.9; uniform angles put ~14% there
+    assert(near(static_cast<double>(polar_cap) / kSamples, 0.05, 0.002));
+    for (const std::vector<double>* axis : {&dx, &dy, &dz}) {
+        m = moments(*axis);
+        assert(near(m.mean, 0.0, 0.005));
+        assert(near(m.variance, 1.0 / 3.0, 0.005));
+    }
+
+    // We keep the momentum magnitude from the kinetic energy while the direction varies
+    FissionFragment fragment;
+    fragment.mass = 140.0;
+    fragment.kinetic_energy = 70.0;
+    generateRandomMomentum(fragment);
+    const Vector3 first_momentum = fragment.momentum;
+    generateRandomMomentum(fragment);
+    const double expected = std::sqrt(2.0 * 140.0 * AMU_TO_KG * 70.0 * MEV_TO_JOULES);
+    const Vector3& p = fragment.momentum;
+    assert(near(std::sqrt(p.x * p.x + p.y * p.y + p.z * p.z), expected, expected * 1e-12));
+    assert(p.x != first_momentum.x);
+
+    // We keep odd-sized fills that end mid-lane within range
+    std::vector<double> odd(13);
+    Sampling::fillUniform(odd.data(), odd.size());
+    for (double u : odd) {
+        assert(u >= 0.0 && u < 1.0);
+    }
+
+    std::cout << "random sampler tests passed" << std::endl;
+    return 0;
+}
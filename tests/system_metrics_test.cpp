@@ -20,10 +20,15 @@ int main() {
         return 1;
     }
     MemoryUsage mem = getMemoryUsage();
-    if (mem.percent <= 0.0 || mem.peak_bytes == 0) {
+    if (mem.percent <= 0.0 || mem.peak_bytes == 0 || mem.rss_bytes == 0) {
         std::cerr << "Memory metrics not collected" << std::endl;
         return 1;
     }
-    std::cout << "cpu=" << cpu << " mem%=" << mem.percent << " peak=" << mem.peak_bytes << std::endl;
+    if (mem.rss_bytes > mem.peak_bytes) {
+        std::cerr << "RSS should not exceed peak RSS" << std::endl;
+        return 1;
+    }
+    std::cout << "cpu=" << cpu << " mem%=" << mem.percent << " peak=" << mem.peak_bytes
+              << " rss=" << mem.rss_bytes << std::endl;
     return 0;
 }
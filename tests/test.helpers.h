@@ -0,0 +1,48 @@
+/*
+ * File: tests/test.helpers.h
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Shared Test Helpers
+ * Purpose: Tolerance comparison and exception checks used by the assert-based tests
+ * Reason: The physics tests each carried their own copy of these helpers
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ *
+ * Carry-over Context:
+ * - Header-only; tests include it as "test.helpers.h" from the tests directory
+ */
+
+#ifndef TERNARY_FISSION_TEST_HELPERS_H
+#define TERNARY_FISSION_TEST_HELPERS_H
+
+#include <cmath>
+#include <exception>
+
+namespace TernaryFission {
+namespace Testing {
+
+/*
+ * True when value is within tolerance of expected
+ */
+inline bool near(double value, double expected, double tolerance) {
+    return std::fabs(value - expected) <= tolerance;
+}
+
+/*
+ * True when fn throws a std::exception
+ */
+template <typename Fn>
+bool throws(Fn fn) {
+    try {
+        fn();
+    } catch (const std::exception&) {
+        return true;
+    }
+    return false;
+}
+
+} // namespace Testing
+} // namespace TernaryFission
+
+#endif // TERNARY_FISSION_TEST_HELPERS_H
@@ -0,0 +1,96 @@
+/*
+ * File: tests/trace_ring_test.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Trace Ring Buffer Tests
+ * Purpose: Verifies span recording, runtime toggle, ring wrap-around and Chrome export
+ * Reason: We rely on the trace dump to diagnose slow requests, so its format must hold
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ */
+
+#include "trace.ring.h"
+
+#include <json/json.h>
+
+#include <cassert>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace TernaryFission;
+
+static Json::Value parseTrace() {
+    Json::Value root;
+    Json::CharReaderBuilder builder;
+    std::string errors;
+    std::istringstream stream(Trace::dumpChromeTrace());
+    bool ok = Json::parseFromStream(builder, stream, &root, &errors);
+    assert(ok && root.isMember("traceEvents"));
+    (void)ok;
+    return root;
+}
+
+static int countSpans(const Json::Value& root, const std::string& name) {
+    int count = 0;
+    for (const auto& event : root["traceEvents"]) {
+        if (event["ph"].asString() == "X" && event["name"].asString() == name) {
+            assert(event["cat"].isString());
+            assert(event["ts"].asDouble() >= 0.0);
+            assert(event["dur"].asDouble() >= 0.0);
+            count++;
+        }
+    }
+    return count;
+}
+
+int main() {
+    // We record nothing while tracing is disabled
+    { TF_TRACE_SCOPE("disabled", "test"); }
+    assert(countSpans(parseTrace(), "disabled") == 0);
+
+    Trace::setEnabled(true);
+    { TF_TRACE_SCOPE("outer", "test"); TF_TRACE_SCOPE("inner", "test"); }
+
+    // We record from a second thread into its own ring
+    std::thread worker([]() { TF_TRACE_SCOPE("worker", "test"); });
+    worker.join();
+    Trace::setEnabled(false);
+
+    Json::Value root = parseTrace();
+    assert(countSpans(root, "outer") == 1);
+    assert(countSpans(root, "inner") == 1);
+    assert(countSpans(root, "worker") == 1);
+
+    std::set<Json::Int64> tids;
+    for (const auto& event : root["traceEvents"]) {
+        if (event["ph"].asString() == "X") {
+            tids.insert(event["tid"].asInt64());
+        }
+    }
+    assert(tids.size() == 2);
+
+    // We keep only the newest ringCapacity() spans after wrap-around
+    Trace::clear();
+    Trace::setEnabled(true);
+    const std::size_t total = Trace::ringCapacity() + 100;
+    for (std::size_t i = 0; i < total; ++i) {
+        TF_TRACE_SCOPE("wrap", "test");
+    }
+    Trace::setEnabled(false);
+    assert(static_cast<std::size_t>(countSpans(parseTrace(), "wrap")) == Trace::ringCapacity());
+
+    // We honor the toggle used by the daemon signal handler
+    assert(Trace::toggle());
+    assert(Trace::isEnabled());
+    assert(!Trace::toggle());
+
+    Trace::clear();
+    assert(countSpans(parseTrace(), "wrap") == 0);
+
+    std::cout << "trace ring tests passed (capacity " << Trace::ringCapacity() << ")" << std::endl;
+    return 0;
+}
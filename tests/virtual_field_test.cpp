@@ -0,0 +1,126 @@
+/*
+ * File: tests/virtual_field_test.cpp
+ * Author: bthlops (David StJ)
+ * Date: October 17, 2026
+ * Title: Virtual Energy Field Tests
+ * Purpose: Verifies that field bytes regenerate deterministically from (field_id,
+ *          entropy_epoch), that any slice matches the full range, that a virtual field
+ *          reads the same bytes a materialized one stores, and that nothing is resident
+ * Reason: Readers must not be able to tell a virtual field from a materialized one
+ *
+ * Change Log:
+ * - 2026-10-17: Initial creation
+ */
+
+#include "field.memory.h"
+#include "memory.governor.h"
+#include "physics.utilities.h"
+#include "ternary.fission.simulation.engine.h"
+
+#include <json/json.h>
+
+#include <cassert>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace TernaryFission;
+
+static std::vector<unsigned char> generate(std::uint64_t field_id, std::uint32_t epoch, double entropy,
+                                           std::size_t offset, std::size_t length) {
+    std::vector<unsigned char> bytes(length);
+    generateFieldBytes(field_id, epoch, entropy, offset, bytes.data(), length);
+    return bytes;
+}
+
+static std::uint64_t virtualLogicalBytes() {
+    Json::Value stats = FieldMemory::statsToJson();
+    return stats["backings"]["virtual"]["logical_bytes"].asUInt64();
+}
+
+int main() {
+    const std::size_t kBytes = 256 * 1024 + 7;
+
+    // We regenerate the same bytes every time and any slice matches the full range
+    std::vector<unsigned char> full = generate(42, 0, 0.0, 0, kBytes);
+    assert(full == generate(42, 0, 0.0, 0, kBytes));
+    assert(full != generate(43, 0, 0.0, 0, kBytes));
+    const std::size_t offsets[] = {1, 15, 16, 4093, 65536 + 3, kBytes - 1};
+    for (std::size_t offset : offsets) {
+        std::size_t length = std::min<std::size_t>(70000, kBytes - offset);
+        std::vector<unsigned char> slice = generate(42, 0, 0.0, offset, length);
+        assert(std::memcmp(slice.data(), full.data() + offset, length) == 0);
+    }
+
+    // We flip a growing, slice-consistent set of bytes as the entropy epoch advances
+    std::vector<unsigned char> epoch1 = generate(42, 1, 0.5, 0, kBytes);
+    std::vector<unsigned char> epoch8 = generate(42, 8, 0.5, 0, kBytes);
+    std::size_t changed1 = 0;
+    std::size_t changed8 = 0;
+    for (std::size_t i = 0; i < kBytes; ++i) {
+        changed1 += epoch1[i] != full[i];
+        changed8 += epoch8[i] != full[i];
+        assert(epoch1[i] == full[i] || epoch8[i] == epoch1[i]);
+    }
+    assert(changed1 > 0 && changed1 < kBytes / 100);
+    assert(changed8 > changed1 * 6 && changed8 < changed1 * 10);
+    std::vector<unsigned char> epoch8_slice = generate(42, 8, 0.5, 1000, 5000);
+    assert(std::memcmp(epoch8_slice.data(), epoch8.data() + 1000, 5000) == 0);
+
+    // We store exactly the epoch-0 pattern in a materialized field
+    g_energy_field_config.virtual_fields = false;
+    EnergyField materialized = createEnergyField(1.0);
+    assert(materialized.memory_ptr != nullptr);
+    std::vector<unsigned char> stored(materialized.memory_bytes);
+    assert(readEnergyFieldBytes(materialized, 0, stored.data(), stored.size()) == stored.size());
+    assert(stored == generate(materialized.field_id, 0, 0.0, 0, materialized.memory_bytes));
+    releaseEnergyField(materialized);
+
+    // We keep virtual fields out of memory while reporting their full size
+    g_energy_field_config.virtual_fields = true;
+    EnergyField field = createEnergyField(50.0);
+    assert(field.memory_ptr == nullptr && field.memory_bytes == 50000000);
+    assert(validateEnergyField(field));
+    assert(Governor::committedBytes() == 0);
+    assert(virtualLogicalBytes() == 50000000);
+    Json::Value memory = FieldMemory::fieldMemoryToJson(field);
+    assert(memory["backing"].asString() == "virtual");
+    assert(memory["resident_bytes"].asUInt64() == 0);
+
+    // We clamp reads to the end of the field and regenerate them from the field id
+    std::vector<unsigned char> tail(4096);
+    assert(readEnergyFieldBytes(field, field.memory_bytes - 100, tail.data(), tail.size()) == 100);
+    assert(std::memcmp(tail.data(), generate(field.field_id, 0, 0.0, field.memory_bytes - 100, 100).data(), 100) == 0);
+    assert(readEnergyFieldBytes(field, field.memory_bytes, tail.data(), tail.size()) == 0);
+
+    // We advance the entropy epoch on dissipation instead of touching a buffer
+    dissipateEnergyField(field);
+    assert(field.entropy_epoch == 1);
+    releaseEnergyField(field);
+    assert(virtualLogicalBytes() == 0);
+
+    {
+        // We serve virtual field slices through the engine accessor
+        TernaryFissionSimulationEngine engine(235.0, 6.5, 1);
+        Json::Value request;
+        request["energy_mev"] = 20.0;
+        Json::Value created = engine.createEnergyFieldAPI(request);
+        assert(created["status"].asString() == "success");
+        std::uint64_t field_id = created["energy_field"]["field_id"].asUInt64();
+        assert(engine.getMemoryAccountingAPI()["virtual_field_bytes"].asUInt64() == 20000000);
+        assert(engine.getMemoryAccountingAPI()["field_memory_bytes"].asUInt64() == 0);
+
+        std::string bytes;
+        assert(engine.readEnergyFieldBytes(field_id, 123456, 8192, bytes));
+        assert(bytes.size() == 8192);
+        assert(std::memcmp(bytes.data(), generate(field_id, 0, 0.0, 123456, 8192).data(), 8192) == 0);
+        assert(!engine.readEnergyFieldBytes(field_id + 1000, 0, 16, bytes));
+    }
+    assert(virtualLogicalBytes() == 0);
+    g_energy_field_config.virtual_fields = false;
+
+    std::cout << "virtual field tests passed (" << changed8 << " of " << kBytes
+              << " bytes changed after 8 epochs)" << std::endl;
+    return 0;
+}